@@ -73,6 +73,32 @@ static const char maximum_inference_rate_message[] =
     "If not specified, default value is 0, the inference will run at maximum rate depending on a device capabilities. "
     "Tweaking this value allow better accuracy in power usage measurement by limiting the execution.";
 
+/// @brief message for open-loop arrival rate
+static const char arrival_rate_message[] =
+    "Optional. Enables the open-loop load: requests arrive as a Poisson process with the given mean rate "
+    "(requests per second) regardless of the completion of the previous ones. Latency is measured from the arrival, "
+    "so the time spent waiting for an idle infer request is included. Requires -api async.";
+
+/// @brief message for open-loop arrival trace
+static const char arrival_trace_message[] =
+    "Optional. Enables the open-loop load replaying the arrivals from the given text file: one non-decreasing "
+    "arrival offset in milliseconds from the start per line. The run stops when the trace is over. "
+    "Requires -api async.";
+
+/// @brief message for LLM prompt length
+static const char llm_prompt_message[] =
+    "Optional. Enables the generation loop for stateful LLMs with input_ids, attention_mask, position_ids and "
+    "beam_idx inputs: every sequence resets the model states, runs the prefill of a synthetic prompt of the given "
+    "number of tokens and decodes -llm_new_tokens tokens one by one. Each infer request generates its own sequence, "
+    "-nireq sets the number of concurrent sequences. -niter limits the number of sequences, one sequence per infer "
+    "request is generated if neither -niter nor -t is set. Reports time to the first token (TTFT), time per output "
+    "token (TPOT), inter-token latency and tokens per second. Input shapes don't need to be set.";
+
+/// @brief message for LLM generated tokens
+static const char llm_new_tokens_message[] =
+    "Optional. Number of tokens generated per sequence in the LLM generation loop, including the first token produced "
+    "by the prefill. Default value is 128.";
+
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
@@ -195,6 +221,12 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for latency histogram dump
+static const char latency_histogram_message[] =
+    "Optional. Path to a JSON file to dump the HDR latency histograms of the service time (execution of a request) and "
+    "of the response time (from the arrival, corrected for coordinated omission) with p50/p90/p99/p99.9 to. "
+    "With -llm_prompt the histograms of TTFT, TPOT and inter-token latency are dumped instead.";
+
 // @brief message for report_type option
 static const char report_type_message[] =
     "Optional. Enable collecting statistics report. \"no_counters\" report contains "
@@ -283,6 +315,18 @@ DEFINE_uint64(niter, 0, iterations_count_message);
 /// @brief Time to execute topology in seconds
 DEFINE_uint64(t, 0, execution_time_message);
 
+/// @brief Mean rate of the open-loop Poisson arrivals in requests per second
+DEFINE_double(arrival_rate, 0, arrival_rate_message);
+
+/// @brief Path to a trace of the open-loop arrivals
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
+/// @brief Prompt length of the LLM generation loop
+DEFINE_uint64(llm_prompt, 0, llm_prompt_message);
+
+/// @brief Number of tokens generated per sequence in the LLM generation loop
+DEFINE_uint64(llm_new_tokens, 128, llm_new_tokens_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint64(b, 0, batch_size_message);
@@ -359,6 +403,9 @@ DEFINE_bool(use_device_mem, false, use_device_mem_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint64(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Path to a JSON file to dump the latency histograms
+DEFINE_string(latency_histogram, "", latency_histogram_message);
+
 /// @brief Enables statistics report collecting
 DEFINE_string(report_type, "", report_type_message);
 
@@ -405,6 +452,10 @@ static void show_usage() {
     std::cout << "    -niter  <integer>             " << iterations_count_message << std::endl;
     std::cout << "    -max_irate \"<float>\"        " << maximum_inference_rate_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
+    std::cout << "    -arrival_rate \"<float>\"     " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival_trace  <path>        " << arrival_trace_message << std::endl;
+    std::cout << "    -llm_prompt  <integer>        " << llm_prompt_message << std::endl;
+    std::cout << "    -llm_new_tokens  <integer>    " << llm_new_tokens_message << std::endl;
     std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
     std::cout << "    -b  <integer>                 " << batch_size_message << std::endl;
@@ -438,6 +489,7 @@ static void show_usage() {
     std::cout << std::endl;
     std::cout << "Statistics dumping options:" << std::endl;
     std::cout << "    -latency_percentile     " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -latency_histogram      " << latency_histogram_message << std::endl;
     std::cout << "    -report_type  <type>    " << report_type_message << std::endl;
     std::cout << "    -report_folder          " << report_folder_message << std::endl;
     std::cout << "    -json_stats             " << json_stats_message << std::endl;
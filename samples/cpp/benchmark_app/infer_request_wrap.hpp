@@ -18,12 +18,17 @@
 
 // clang-format off
 
+#include "latency_histogram.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
 // clang-format on
 
-typedef std::function<void(size_t id, size_t group_id, const double latency, const std::exception_ptr& ptr)>
+typedef std::function<void(size_t id,
+                           size_t group_id,
+                           const double latency,
+                           const double response_latency,
+                           const std::exception_ptr& ptr)>
     QueueCallbackFunction;
 
 /// @brief Handles asynchronous callbacks and calculates execution time
@@ -41,12 +46,18 @@ public:
           outputClBuffer() {
         _request.set_callback([&](const std::exception_ptr& ptr) {
             _endTime = Time::now();
-            _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), ptr);
+            _callbackQueue(_id,
+                           _lat_group_id,
+                           get_execution_time_in_milliseconds(),
+                           get_response_time_in_milliseconds(),
+                           ptr);
         });
     }
 
-    void start_async() {
+    /// @param arrivalTime Time the request was supposed to arrive at by the open-loop load, the start time if not set
+    void start_async(const Time::time_point& arrivalTime = {}) {
         _startTime = Time::now();
+        _arrivalTime = arrivalTime == Time::time_point{} ? _startTime : arrivalTime;
         _request.start_async();
     }
 
@@ -56,9 +67,14 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.infer();
         _endTime = Time::now();
-        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), nullptr);
+        _callbackQueue(_id,
+                       _lat_group_id,
+                       get_execution_time_in_milliseconds(),
+                       get_response_time_in_milliseconds(),
+                       nullptr);
     }
 
     std::vector<ov::ProfilingInfo> get_performance_counts() {
@@ -83,6 +99,11 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double get_response_time_in_milliseconds() const {
+        auto responseTime = std::chrono::duration_cast<ns>(_endTime - _arrivalTime);
+        return static_cast<double>(responseTime.count()) * 0.000001;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -96,6 +117,7 @@ public:
 
 private:
     ov::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -116,7 +138,8 @@ public:
                                                                         std::placeholders::_1,
                                                                         std::placeholders::_2,
                                                                         std::placeholders::_3,
-                                                                        std::placeholders::_4)));
+                                                                        std::placeholders::_4,
+                                                                        std::placeholders::_5)));
             _idleIds.push(id);
         }
         _latency_groups.resize(lat_group_n);
@@ -140,6 +163,14 @@ public:
         for (auto& group : _latency_groups) {
             group.clear();
         }
+        _latencyHistogram.reset();
+        _responseHistogram.reset();
+    }
+
+    /// @brief Sets the interval the closed-loop load is expected to issue the requests with, the response time is
+    /// corrected for the requests which were not issued while a request was running longer than the interval
+    void set_expected_interval(double intervalMs) {
+        _expectedIntervalMs = intervalMs;
     }
 
     double get_duration_in_milliseconds() {
@@ -149,12 +180,15 @@ public:
     void put_idle_request(size_t id,
                           size_t lat_group_id,
                           const double latency,
+                          const double response_latency,
                           const std::exception_ptr& ptr = nullptr) {
         std::unique_lock<std::mutex> lock(_mutex);
         if (ptr) {
             inferenceException = ptr;
         } else {
             _latencies.push_back(latency);
+            _latencyHistogram.record(latency);
+            _responseHistogram.record_corrected(response_latency, _expectedIntervalMs);
             if (enable_lat_groups) {
                 _latency_groups[lat_group_id].push_back(latency);
             }
@@ -196,6 +230,16 @@ public:
         return _latency_groups;
     }
 
+    // Should be called when all requests are idle
+    const LatencyHistogram& get_latency_histogram() const {
+        return _latencyHistogram;
+    }
+
+    // Should be called when all requests are idle
+    const LatencyHistogram& get_response_histogram() const {
+        return _responseHistogram;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -206,6 +250,9 @@ private:
     Time::time_point _endTime;
     std::vector<double> _latencies;
     std::vector<std::vector<double>> _latency_groups;
+    LatencyHistogram _latencyHistogram;
+    LatencyHistogram _responseHistogram;
+    double _expectedIntervalMs = 0;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
 };
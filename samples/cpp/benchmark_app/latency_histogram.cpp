@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+// 3 significant decimal digits require 2 * 10^3 distinct values in a bucket, rounded up to a power of 2
+constexpr uint32_t sub_bucket_count_magnitude = 11;
+
+uint32_t bit_length(uint64_t value) {
+    uint32_t length = 0;
+    while (value != 0) {
+        ++length;
+        value >>= 1;
+    }
+    return length;
+}
+
+uint64_t to_nanoseconds(double latency_ms) {
+    return latency_ms > 0 ? static_cast<uint64_t>(std::llround(latency_ms * 1.0e6)) : 0;
+}
+
+double to_milliseconds(uint64_t latency_ns) {
+    return static_cast<double>(latency_ns) * 1.0e-6;
+}
+}  // namespace
+
+LatencyHistogram::LatencyHistogram(double highest_value_ms)
+    : m_highest_value(to_nanoseconds(highest_value_ms)),
+      m_sub_bucket_half_count_magnitude(sub_bucket_count_magnitude - 1),
+      m_sub_bucket_half_count(uint64_t{1} << (sub_bucket_count_magnitude - 1)),
+      m_sub_bucket_mask((uint64_t{1} << sub_bucket_count_magnitude) - 1) {
+    if (m_highest_value < (uint64_t{1} << sub_bucket_count_magnitude)) {
+        throw std::logic_error("The highest value of the latency histogram is too small.");
+    }
+    // each bucket doubles the range covered by the previous one
+    size_t buckets_count = 1;
+    uint64_t smallest_untrackable_value = uint64_t{1} << sub_bucket_count_magnitude;
+    while (smallest_untrackable_value <= m_highest_value) {
+        if (smallest_untrackable_value > UINT64_MAX / 2) {
+            ++buckets_count;
+            break;
+        }
+        smallest_untrackable_value <<= 1;
+        ++buckets_count;
+    }
+    // the lower half of every bucket but the first one is covered by the previous bucket
+    m_counts.resize((buckets_count + 1) * m_sub_bucket_half_count, 0);
+}
+
+size_t LatencyHistogram::counts_index(uint64_t value) const {
+    const size_t bucket_index = bit_length(value | m_sub_bucket_mask) - (m_sub_bucket_half_count_magnitude + 1);
+    const uint64_t sub_bucket_index = value >> bucket_index;
+    return static_cast<size_t>(((bucket_index + 1) << m_sub_bucket_half_count_magnitude) +
+                               (sub_bucket_index - m_sub_bucket_half_count));
+}
+
+uint64_t LatencyHistogram::value_from_index(size_t index) const {
+    size_t bucket_index = index >> m_sub_bucket_half_count_magnitude;
+    uint64_t sub_bucket_index = (index & (m_sub_bucket_half_count - 1)) + m_sub_bucket_half_count;
+    if (bucket_index == 0) {
+        sub_bucket_index -= m_sub_bucket_half_count;
+    } else {
+        --bucket_index;
+    }
+    return sub_bucket_index << bucket_index;
+}
+
+uint64_t LatencyHistogram::highest_equivalent_value(uint64_t value) const {
+    const size_t bucket_index = bit_length(value | m_sub_bucket_mask) - (m_sub_bucket_half_count_magnitude + 1);
+    return ((value >> bucket_index) << bucket_index) + (uint64_t{1} << bucket_index) - 1;
+}
+
+void LatencyHistogram::record(double latency_ms) {
+    const auto value = std::min(to_nanoseconds(latency_ms), m_highest_value);
+    ++m_counts[counts_index(value)];
+    ++m_total_count;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+    m_sum += static_cast<double>(value);
+}
+
+void LatencyHistogram::record_corrected(double latency_ms, double expected_interval_ms) {
+    record(latency_ms);
+    if (expected_interval_ms <= 0) {
+        return;
+    }
+    for (double missed = latency_ms - expected_interval_ms; missed >= expected_interval_ms;
+         missed -= expected_interval_ms) {
+        record(missed);
+    }
+}
+
+void LatencyHistogram::reset() {
+    std::fill(m_counts.begin(), m_counts.end(), 0);
+    m_total_count = 0;
+    m_min = UINT64_MAX;
+    m_max = 0;
+    m_sum = 0;
+}
+
+double LatencyHistogram::min() const {
+    return m_total_count == 0 ? 0.0 : to_milliseconds(m_min);
+}
+
+double LatencyHistogram::max() const {
+    return to_milliseconds(m_max);
+}
+
+double LatencyHistogram::mean() const {
+    return m_total_count == 0 ? 0.0 : to_milliseconds(static_cast<uint64_t>(m_sum / m_total_count));
+}
+
+double LatencyHistogram::percentile(double percentile) const {
+    if (m_total_count == 0) {
+        return 0.0;
+    }
+    const auto requested = std::min(std::max(percentile, 0.0), 100.0);
+    const auto count_at_percentile =
+        std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(requested / 100.0 * m_total_count)));
+    uint64_t running_count = 0;
+    for (size_t i = 0; i < m_counts.size(); ++i) {
+        running_count += m_counts[i];
+        if (running_count >= count_at_percentile) {
+            return to_milliseconds(std::min(highest_equivalent_value(value_from_index(i)), m_max));
+        }
+    }
+    return to_milliseconds(m_max);
+}
+
+nlohmann::json LatencyHistogram::to_json() const {
+    nlohmann::json js;
+    js["count"] = m_total_count;
+    js["min"] = min();
+    js["max"] = max();
+    js["mean"] = mean();
+    js["p50"] = percentile(50.0);
+    js["p90"] = percentile(90.0);
+    js["p99"] = percentile(99.0);
+    js["p99.9"] = percentile(99.9);
+    auto& buckets = js["buckets"];
+    buckets = nlohmann::json::array();
+    for (size_t i = 0; i < m_counts.size(); ++i) {
+        if (m_counts[i] != 0) {
+            buckets.push_back({to_milliseconds(highest_equivalent_value(value_from_index(i))), m_counts[i]});
+        }
+    }
+    return js;
+}
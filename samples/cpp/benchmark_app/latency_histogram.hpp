@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#ifdef JSON_HEADER
+#    include <json.hpp>
+#else
+#    include <nlohmann/json.hpp>
+#endif
+
+/// @brief HDR (high dynamic range) histogram of latencies.
+/// Values are recorded in nanoseconds with 3 significant decimal digits in log-linear buckets, so the memory and
+/// the cost of a record are constant while any percentile is reported with at most 0.1% error.
+class LatencyHistogram {
+public:
+    /// @param highest_value_ms The highest trackable latency, larger values are clamped to it.
+    explicit LatencyHistogram(double highest_value_ms = 3600.0 * 1000.0);
+
+    void record(double latency_ms);
+
+    /// @brief Records the latency and corrects the coordinated omission of a closed-loop load.
+    /// When a request takes longer than the expected interval between requests, the requests which would have been
+    /// issued meanwhile are recorded as well with the latencies they would have seen.
+    void record_corrected(double latency_ms, double expected_interval_ms);
+
+    void reset();
+
+    uint64_t count() const {
+        return m_total_count;
+    }
+
+    double min() const;
+    double max() const;
+    double mean() const;
+    double percentile(double percentile) const;
+
+    /// @brief Returns the summary with p50/p90/p99/p99.9 and the non-empty buckets as [upper bound (ms), count] pairs.
+    nlohmann::json to_json() const;
+
+private:
+    size_t counts_index(uint64_t value) const;
+    uint64_t value_from_index(size_t index) const;
+    uint64_t highest_equivalent_value(uint64_t value) const;
+
+    uint64_t m_highest_value;
+    uint32_t m_sub_bucket_half_count_magnitude;
+    uint64_t m_sub_bucket_half_count;
+    uint64_t m_sub_bucket_mask;
+    std::vector<uint64_t> m_counts;
+    uint64_t m_total_count = 0;
+    uint64_t m_min = UINT64_MAX;
+    uint64_t m_max = 0;
+    double m_sum = 0;
+};
@@ -0,0 +1,242 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "llm_benchmark.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "utils.hpp"
+
+namespace {
+const std::string input_ids_name = "input_ids";
+const std::string attention_mask_name = "attention_mask";
+const std::string position_ids_name = "position_ids";
+const std::string beam_idx_name = "beam_idx";
+
+bool has_name(const ov::Output<const ov::Node>& port, const std::string& name) {
+    return port.get_names().count(name) != 0;
+}
+
+void check_rank(const ov::Output<const ov::Node>& port, int64_t rank) {
+    const auto& shape = port.get_partial_shape();
+    if (shape.rank().is_static() && shape.rank().get_length() != rank) {
+        throw std::logic_error("LLM generation mode expects " + std::to_string(rank) + "D input " +
+                               port.get_any_name() + ", but its shape is " + shape.to_string());
+    }
+}
+
+ov::Tensor create_tensor(const ov::Output<const ov::Node>& port,
+                         const ov::Shape& shape,
+                         const std::function<int64_t(size_t)>& value) {
+    ov::Tensor tensor(port.get_element_type(), shape);
+    if (tensor.get_element_type() == ov::element::i64) {
+        auto data = tensor.data<int64_t>();
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            data[i] = value(i);
+        }
+    } else if (tensor.get_element_type() == ov::element::i32) {
+        auto data = tensor.data<int32_t>();
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            data[i] = static_cast<int32_t>(value(i));
+        }
+    } else {
+        throw std::logic_error("LLM generation mode supports i32 and i64 inputs only, input " +
+                               port.get_any_name() + " has " + port.get_element_type().get_type_name() + " type");
+    }
+    return tensor;
+}
+
+// Synthetic prompt and generated tokens, kept small to fit into any vocabulary
+int64_t token_id(size_t position) {
+    return static_cast<int64_t>(1 + (position * 31) % 97);
+}
+}  // namespace
+
+LLMBenchmark::LLMBenchmark(ov::CompiledModel& compiled_model, size_t concurrency) {
+    for (const auto& input : compiled_model.inputs()) {
+        if (has_name(input, input_ids_name) || has_name(input, attention_mask_name) ||
+            has_name(input, position_ids_name)) {
+            check_rank(input, 2);
+        } else if (has_name(input, beam_idx_name)) {
+            check_rank(input, 1);
+        } else {
+            throw std::logic_error("Input " + input.get_any_name() +
+                                   " isn't supported in LLM generation mode. The supported inputs are input_ids, "
+                                   "attention_mask, position_ids and beam_idx.");
+        }
+        m_inputs.push_back(input);
+    }
+    if (std::none_of(m_inputs.begin(), m_inputs.end(), [](const ov::Output<const ov::Node>& input) {
+            return has_name(input, input_ids_name);
+        })) {
+        throw std::logic_error("LLM generation mode requires the input_ids model input.");
+    }
+
+    for (size_t i = 0; i < concurrency; ++i) {
+        m_requests.push_back(compiled_model.create_infer_request());
+    }
+    if (m_requests.empty() || m_requests.front().query_state().empty()) {
+        throw std::logic_error("LLM generation mode requires a stateful model, the model has no variable states.");
+    }
+}
+
+LLMBenchmark::SequenceTimes LLMBenchmark::generate(ov::InferRequest& request,
+                                                   size_t prompt_length,
+                                                   size_t new_tokens) {
+    SequenceTimes times;
+    times.decode_steps_ms.reserve(new_tokens);
+    request.reset_state();
+
+    size_t past_length = 0;
+    for (size_t token = 0; token < new_tokens; ++token) {
+        const size_t length = token == 0 ? prompt_length : 1;
+        for (const auto& input : m_inputs) {
+            ov::Tensor tensor;
+            if (has_name(input, input_ids_name)) {
+                tensor = create_tensor(input, {1, length}, [&](size_t i) {
+                    return token_id(past_length + i);
+                });
+            } else if (has_name(input, attention_mask_name)) {
+                tensor = create_tensor(input, {1, past_length + length}, [](size_t) {
+                    return 1;
+                });
+            } else if (has_name(input, position_ids_name)) {
+                tensor = create_tensor(input, {1, length}, [&](size_t i) {
+                    return static_cast<int64_t>(past_length + i);
+                });
+            } else {
+                tensor = create_tensor(input, {1}, [](size_t) {
+                    return 0;
+                });
+            }
+            request.set_tensor(input, tensor);
+        }
+
+        auto startTime = Time::now();
+        request.infer();
+        const auto duration_ms = get_duration_ms_till_now(startTime);
+        if (token == 0) {
+            times.ttft_ms = duration_ms;
+        } else {
+            times.decode_steps_ms.push_back(duration_ms);
+        }
+        past_length += length;
+    }
+    return times;
+}
+
+void LLMBenchmark::record(const SequenceTimes& times) {
+    const double decode_ms = std::accumulate(times.decode_steps_ms.begin(), times.decode_steps_ms.end(), 0.0);
+    const size_t tokens = times.decode_steps_ms.size() + 1;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_ttft.record(times.ttft_ms);
+    if (!times.decode_steps_ms.empty()) {
+        m_tpot.record(decode_ms / times.decode_steps_ms.size());
+    }
+    for (const auto step_ms : times.decode_steps_ms) {
+        m_itl.record(step_ms);
+    }
+    const double sequence_ms = times.ttft_ms + decode_ms;
+    if (sequence_ms > 0) {
+        m_sequence_tokens_per_second.push_back(1000.0 * tokens / sequence_ms);
+    }
+    ++m_sequences_count;
+    m_generated_tokens += tokens;
+}
+
+void LLMBenchmark::warm_up(size_t prompt_length) {
+    for (auto& request : m_requests) {
+        generate(request, prompt_length, 2);
+    }
+}
+
+void LLMBenchmark::run(const Config& config) {
+    if (config.prompt_length == 0 || config.new_tokens == 0) {
+        throw std::logic_error("Prompt length and number of generated tokens must be positive.");
+    }
+    if (config.sequences == 0 && config.duration_nanoseconds == 0) {
+        throw std::logic_error("LLM generation mode requires a limit of the number of sequences or of the time.");
+    }
+
+    std::atomic<uint64_t> started_sequences{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto startTime = Time::now();
+    auto run_sequences = [&](ov::InferRequest& request) {
+        try {
+            while (!failed) {
+                if (config.sequences != 0 && started_sequences.fetch_add(1) >= config.sequences) {
+                    break;
+                }
+                if (config.duration_nanoseconds != 0 &&
+                    static_cast<uint64_t>(std::chrono::duration_cast<ns>(Time::now() - startTime).count()) >=
+                        config.duration_nanoseconds) {
+                    break;
+                }
+                record(generate(request, config.prompt_length, config.new_tokens));
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            failed = true;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(m_requests.size());
+    for (auto& request : m_requests) {
+        threads.emplace_back(run_sequences, std::ref(request));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    m_duration_ms = get_duration_ms_till_now(startTime);
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+double LLMBenchmark::get_tokens_per_second() const {
+    return m_duration_ms > 0 ? 1000.0 * m_generated_tokens / m_duration_ms : 0.0;
+}
+
+double LLMBenchmark::get_sequence_tokens_per_second(double percentile) const {
+    if (m_sequence_tokens_per_second.empty()) {
+        return 0.0;
+    }
+    auto sorted = m_sequence_tokens_per_second;
+    std::sort(sorted.begin(), sorted.end());
+    const auto requested = std::min(std::max(percentile, 0.0), 100.0);
+    const auto rank = static_cast<size_t>(std::ceil(requested / 100.0 * sorted.size()));
+    return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+nlohmann::json LLMBenchmark::to_json() const {
+    nlohmann::json js;
+    js["sequences"] = m_sequences_count;
+    js["generated_tokens"] = m_generated_tokens;
+    js["duration"] = m_duration_ms;
+    js["tokens_per_second"] = get_tokens_per_second();
+    js["sequence_tokens_per_second"] = {{"p10", get_sequence_tokens_per_second(10.0)},
+                                        {"p50", get_sequence_tokens_per_second(50.0)},
+                                        {"p90", get_sequence_tokens_per_second(90.0)}};
+    js["ttft"] = m_ttft.to_json();
+    js["tpot"] = m_tpot.to_json();
+    js["inter_token_latency"] = m_itl.to_json();
+    return js;
+}
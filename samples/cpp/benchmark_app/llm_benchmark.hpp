@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <openvino/openvino.hpp>
+#include <vector>
+
+#include "latency_histogram.hpp"
+
+#ifdef JSON_HEADER
+#    include <json.hpp>
+#else
+#    include <nlohmann/json.hpp>
+#endif
+
+/// @brief Generation loop over a stateful LLM (KV cache kept in ReadValue/Assign variables).
+/// Every sequence starts from the reset variable states, runs the prefill of the prompt and then decodes the new
+/// tokens one by one, so the inter-token latency is measured while the KV cache grows. Each infer request drives its
+/// own sequence, the number of requests is the number of concurrent sequences.
+/// The token ids are synthetic, the sampling of the next token is not part of the measurement.
+class LLMBenchmark {
+public:
+    struct Config {
+        size_t prompt_length = 0;
+        /// @brief Tokens generated per sequence including the first one produced by the prefill.
+        size_t new_tokens = 0;
+        /// @brief Limit of the number of sequences, 0 - no limit.
+        uint64_t sequences = 0;
+        /// @brief Time limit, 0 - no limit. The sequences in progress are completed when it expires.
+        uint64_t duration_nanoseconds = 0;
+    };
+
+    /// @throws std::logic_error if the model has no variable states or has inputs other than input_ids,
+    /// attention_mask, position_ids and beam_idx.
+    LLMBenchmark(ov::CompiledModel& compiled_model, size_t concurrency);
+
+    /// @brief Runs a short sequence on every request, the results are not recorded.
+    void warm_up(size_t prompt_length);
+
+    void run(const Config& config);
+
+    /// @brief Time to the first token: prefill of the prompt.
+    const LatencyHistogram& get_ttft_histogram() const {
+        return m_ttft;
+    }
+
+    /// @brief Time per output token: mean decode step latency of a sequence, one value per sequence.
+    const LatencyHistogram& get_tpot_histogram() const {
+        return m_tpot;
+    }
+
+    /// @brief Inter-token latency: every decode step of every sequence.
+    const LatencyHistogram& get_itl_histogram() const {
+        return m_itl;
+    }
+
+    uint64_t get_sequences_count() const {
+        return m_sequences_count;
+    }
+
+    uint64_t get_generated_tokens() const {
+        return m_generated_tokens;
+    }
+
+    double get_duration_in_milliseconds() const {
+        return m_duration_ms;
+    }
+
+    /// @brief Generated tokens per second over all concurrent sequences.
+    double get_tokens_per_second() const;
+
+    /// @brief Percentile of the generation rate of a single sequence in tokens per second.
+    double get_sequence_tokens_per_second(double percentile) const;
+
+    nlohmann::json to_json() const;
+
+private:
+    struct SequenceTimes {
+        double ttft_ms = 0;
+        std::vector<double> decode_steps_ms;
+    };
+
+    SequenceTimes generate(ov::InferRequest& request, size_t prompt_length, size_t new_tokens);
+    void record(const SequenceTimes& times);
+
+    std::vector<ov::InferRequest> m_requests;
+    std::vector<ov::Output<const ov::Node>> m_inputs;
+
+    std::mutex m_mutex;
+    LatencyHistogram m_ttft;
+    LatencyHistogram m_tpot;
+    LatencyHistogram m_itl;
+    std::vector<double> m_sequence_tokens_per_second;
+    uint64_t m_sequences_count = 0;
+    uint64_t m_generated_tokens = 0;
+    double m_duration_ms = 0;
+};
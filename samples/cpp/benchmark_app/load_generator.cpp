@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "load_generator.hpp"
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+ArrivalSchedule ArrivalSchedule::poisson(double rate, uint64_t seed) {
+    if (rate <= 0) {
+        throw std::logic_error("The rate of the open-loop load must be positive.");
+    }
+    ArrivalSchedule schedule;
+    schedule.m_rate = rate;
+    schedule.m_generator.seed(seed);
+    schedule.m_interval_s = std::exponential_distribution<double>(rate);
+    return schedule;
+}
+
+ArrivalSchedule ArrivalSchedule::from_trace(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open the arrival trace file: " + path);
+    }
+    ArrivalSchedule schedule;
+    std::string line;
+    double previous_ms = 0;
+    while (std::getline(file, line)) {
+        if (line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
+        }
+        const double offset_ms = std::stod(line);
+        if (offset_ms < previous_ms) {
+            throw std::logic_error("Arrival offsets of the trace " + path + " must be non-decreasing.");
+        }
+        previous_ms = offset_ms;
+        schedule.m_trace.emplace_back(static_cast<int64_t>(offset_ms * 1.0e6));
+    }
+    if (schedule.m_trace.empty()) {
+        throw std::logic_error("The arrival trace file is empty: " + path);
+    }
+    const auto span_s = static_cast<double>(schedule.m_trace.back().count()) * 1.0e-9;
+    schedule.m_rate = span_s > 0 ? static_cast<double>(schedule.m_trace.size()) / span_s : 0;
+    return schedule;
+}
+
+bool ArrivalSchedule::next(std::chrono::nanoseconds& offset) {
+    if (!m_trace.empty()) {
+        if (m_trace_position == m_trace.size()) {
+            return false;
+        }
+        offset = m_trace[m_trace_position++];
+        return true;
+    }
+    m_last_arrival += std::chrono::nanoseconds(static_cast<int64_t>(m_interval_s(m_generator) * 1.0e9));
+    offset = m_last_arrival;
+    return true;
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+/// @brief Arrival times of the requests of an open-loop load.
+/// Requests arrive independently of the completion of the previous ones, either as a Poisson process with the given
+/// rate or by replaying the arrival offsets from a trace file.
+class ArrivalSchedule {
+public:
+    /// @param rate Mean number of requests per second.
+    static ArrivalSchedule poisson(double rate, uint64_t seed = 0);
+
+    /// @param path Text file with the arrival offsets in milliseconds from the start, one non-decreasing offset
+    /// per line.
+    static ArrivalSchedule from_trace(const std::string& path);
+
+    /// @brief Returns the offset of the next arrival from the start of the benchmark.
+    /// @return false when the trace is over.
+    bool next(std::chrono::nanoseconds& offset);
+
+    /// @brief Mean number of requests per second.
+    double rate() const {
+        return m_rate;
+    }
+
+private:
+    ArrivalSchedule() = default;
+
+    double m_rate = 0;
+    std::vector<std::chrono::nanoseconds> m_trace;
+    size_t m_trace_position = 0;
+    std::mt19937_64 m_generator;
+    std::exponential_distribution<double> m_interval_s;
+    std::chrono::nanoseconds m_last_arrival{0};
+};
@@ -4,8 +4,10 @@
 
 #include <algorithm>
 #include <chrono>
+#include <fstream>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
 #include <utility>
@@ -32,6 +34,8 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "llm_benchmark.hpp"
+#include "load_generator.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -152,6 +156,35 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
                 "Number of iterations should be greater than number of infer requests when using sync API.");
         }
     }
+    if (FLAGS_arrival_rate < 0) {
+        throw std::logic_error("The arrival rate must be positive. Please set -arrival_rate option correctly.");
+    }
+    if (FLAGS_arrival_rate > 0 || !FLAGS_arrival_trace.empty()) {
+        if (FLAGS_arrival_rate > 0 && !FLAGS_arrival_trace.empty()) {
+            throw std::logic_error("-arrival_rate and -arrival_trace options are mutually exclusive.");
+        }
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Open-loop load set by -arrival_rate or -arrival_trace requires -api async.");
+        }
+        if (FLAGS_max_irate > 0) {
+            throw std::logic_error("-max_irate limits the closed-loop load only, it cannot be used together with "
+                                   "-arrival_rate or -arrival_trace.");
+        }
+    }
+    if (FLAGS_llm_prompt > 0) {
+        if (FLAGS_llm_new_tokens == 0) {
+            throw std::logic_error("The number of generated tokens must be positive. Please set -llm_new_tokens "
+                                   "option correctly.");
+        }
+        if (FLAGS_arrival_rate > 0 || !FLAGS_arrival_trace.empty() || FLAGS_max_irate > 0) {
+            throw std::logic_error("-llm_prompt cannot be used together with -arrival_rate, -arrival_trace or "
+                                   "-max_irate.");
+        }
+        if (FLAGS_b > 0 || !FLAGS_data_shape.empty() || !FLAGS_i.empty()) {
+            throw std::logic_error("-b, -data_shape and -i options aren't used with -llm_prompt, the input tensors "
+                                   "are generated for every step of the generation loop.");
+        }
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -641,6 +674,9 @@ int main(int argc, char* argv[]) {
         // require -shape, -data_shape, or -i to be specified.
         const bool compile_only = isFlagSetInCommandLine("niter") && FLAGS_niter == 0;
 
+        // The generation loop of a stateful LLM creates the input tensors for every step, so no data shapes are needed
+        const bool llm_mode = FLAGS_llm_prompt > 0 && !compile_only;
+
         if (FLAGS_load_from_file && !isNetworkCompiled) {
             if (!FLAGS_mean_values.empty() || !FLAGS_scale_values.empty()) {
                 throw std::runtime_error("--mean_values and --scale_values aren't supported with --load_from_file. "
@@ -681,7 +717,7 @@ int main(int argc, char* argv[]) {
                                               FLAGS_scale_values,
                                               FLAGS_mean_values,
                                               compiledModel.inputs(),
-                                              compile_only);
+                                              compile_only || llm_mode);
             if (batchSize == 0) {
                 batchSize = 1;
             }
@@ -730,7 +766,7 @@ int main(int argc, char* argv[]) {
                                               FLAGS_mean_values,
                                               inputInfo,
                                               reshape,
-                                              compile_only);
+                                              compile_only || llm_mode);
             if (reshape) {
                 benchmark_app::PartialShapes shapes = {};
                 for (auto& item : app_inputs_info[0])
@@ -838,7 +874,7 @@ int main(int argc, char* argv[]) {
 
             // In compile_only mode dataShape is left empty (no inference will run), so
             // get_batch_size() would crash. batchSize is only needed for steps 8-10 anyway.
-            if (!compile_only) {
+            if (!compile_only && !llm_mode) {
                 batchSize = get_batch_size(app_inputs_info.at(0));
                 warn_if_no_batch(app_inputs_info.at(0));
                 slog::info << "Model batch size: " << batchSize << slog::endl;
@@ -915,12 +951,12 @@ int main(int argc, char* argv[]) {
                                               FLAGS_scale_values,
                                               FLAGS_mean_values,
                                               compiledModel.inputs(),
-                                              compile_only);
+                                              compile_only || llm_mode);
             isDynamicNetwork = areNetworkInputsDynamic(app_inputs_info.at(0));
 
             // In compile_only mode dataShape is left empty (no inference will run), so
             // get_batch_size() would crash. batchSize is only needed for steps 8-10 anyway.
-            if (!compile_only) {
+            if (!compile_only && !llm_mode) {
                 batchSize = get_batch_size(app_inputs_info.at(0));
                 warn_if_no_batch(app_inputs_info.at(0));
                 slog::info << "Model batch size: " << batchSize << slog::endl;
@@ -1017,6 +1053,145 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        if (llm_mode) {
+            LLMBenchmark::Config llm_config;
+            llm_config.prompt_length = FLAGS_llm_prompt;
+            llm_config.new_tokens = FLAGS_llm_new_tokens;
+            llm_config.sequences = FLAGS_niter;
+            llm_config.duration_nanoseconds = get_duration_in_nanoseconds(FLAGS_t);
+            if (llm_config.sequences == 0 && llm_config.duration_nanoseconds == 0) {
+                llm_config.sequences = nireq;
+            }
+
+            if (statistics) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::RUNTIME_CONFIG,
+                    StatisticsReport::Parameters(
+                        {StatisticsVariant("benchmark mode", "benchmark_mode", "llm generation"),
+                         StatisticsVariant("topology", "topology", topology_name),
+                         StatisticsVariant("target device", "target_device", device_name),
+                         StatisticsVariant("prompt length", "llm_prompt", FLAGS_llm_prompt),
+                         StatisticsVariant("generated tokens per sequence", "llm_new_tokens", FLAGS_llm_new_tokens),
+                         StatisticsVariant("number of sequences", "sequences_num", llm_config.sequences),
+                         StatisticsVariant("number of concurrent sequences", "nireq", nireq),
+                         StatisticsVariant("duration (ms)", "duration", get_duration_in_milliseconds(FLAGS_t))}));
+            }
+
+            // ----------------- 9. Creating infer requests and filling input blobs
+            // ----------------------------------------
+            next_step();
+            LLMBenchmark llmBenchmark(compiledModel, nireq);
+
+            // ----------------- 10. Measuring performance
+            // ------------------------------------------------------------------
+            std::stringstream llm_ss;
+            llm_ss << "Start generation of " << nireq << " concurrent sequences, prompt: " << FLAGS_llm_prompt
+                   << " tokens, generated: " << FLAGS_llm_new_tokens << " tokens, limits: ";
+            if (llm_config.duration_nanoseconds != 0) {
+                llm_ss << get_duration_in_milliseconds(FLAGS_t) << " ms duration";
+            }
+            if (llm_config.sequences != 0) {
+                if (llm_config.duration_nanoseconds != 0) {
+                    llm_ss << ", ";
+                }
+                llm_ss << llm_config.sequences << " sequences";
+            }
+            next_step(llm_ss.str());
+
+            if (!FLAGS_no_warmup) {
+                auto startTime = Time::now();
+                llmBenchmark.warm_up(FLAGS_llm_prompt);
+                auto duration_ms = get_duration_ms_till_now(startTime);
+                slog::info << "Warm-up sequences took " << double_to_string(duration_ms) << " ms" << slog::endl;
+            } else {
+                slog::info << "Skipping warmup inference due to -no_warmup flag" << slog::endl;
+            }
+
+            llmBenchmark.run(llm_config);
+
+            const auto& ttft = llmBenchmark.get_ttft_histogram();
+            const auto& tpot = llmBenchmark.get_tpot_histogram();
+            const auto& itl = llmBenchmark.get_itl_histogram();
+            if (statistics) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("total execution time (ms)",
+                                       "execution_time",
+                                       llmBenchmark.get_duration_in_milliseconds()),
+                     StatisticsVariant("total number of sequences",
+                                       "sequences_num",
+                                       llmBenchmark.get_sequences_count()),
+                     StatisticsVariant("total number of generated tokens",
+                                       "generated_tokens_num",
+                                       llmBenchmark.get_generated_tokens()),
+                     StatisticsVariant("TTFT p50 (ms)", "ttft_p50", ttft.percentile(50.0)),
+                     StatisticsVariant("TTFT p90 (ms)", "ttft_p90", ttft.percentile(90.0)),
+                     StatisticsVariant("TTFT p99 (ms)", "ttft_p99", ttft.percentile(99.0)),
+                     StatisticsVariant("TPOT p50 (ms)", "tpot_p50", tpot.percentile(50.0)),
+                     StatisticsVariant("TPOT p90 (ms)", "tpot_p90", tpot.percentile(90.0)),
+                     StatisticsVariant("TPOT p99 (ms)", "tpot_p99", tpot.percentile(99.0)),
+                     StatisticsVariant("inter-token latency p50 (ms)", "itl_p50", itl.percentile(50.0)),
+                     StatisticsVariant("inter-token latency p99 (ms)", "itl_p99", itl.percentile(99.0)),
+                     StatisticsVariant("sequence tokens/s p10",
+                                       "sequence_tokens_per_second_p10",
+                                       llmBenchmark.get_sequence_tokens_per_second(10.0)),
+                     StatisticsVariant("sequence tokens/s p50",
+                                       "sequence_tokens_per_second_p50",
+                                       llmBenchmark.get_sequence_tokens_per_second(50.0)),
+                     StatisticsVariant("throughput (tokens/s)", "throughput", llmBenchmark.get_tokens_per_second())});
+            }
+
+            // ----------------- 11. Dumping statistics report
+            // -------------------------------------------------------------
+            next_step();
+            if (!FLAGS_dump_config.empty()) {
+                dump_config(FLAGS_dump_config, config);
+                slog::info << "OpenVINO Runtime configuration settings were dumped to " << FLAGS_dump_config
+                           << slog::endl;
+            }
+            if (!FLAGS_latency_histogram.empty()) {
+                std::ofstream ofs(FLAGS_latency_histogram);
+                if (!ofs.is_open()) {
+                    throw std::runtime_error("Can't open latency histogram file \"" + FLAGS_latency_histogram + "\".");
+                }
+                auto histograms = llmBenchmark.to_json();
+                histograms["load"] = "llm";
+                histograms["prompt_length"] = FLAGS_llm_prompt;
+                histograms["new_tokens"] = FLAGS_llm_new_tokens;
+                ofs << histograms;
+                slog::info << "Latency histograms were dumped to " << FLAGS_latency_histogram << slog::endl;
+            }
+            if (statistics)
+                statistics->dump();
+
+            auto write_percentiles = [](const LatencyHistogram& histogram) {
+                slog::info << "   p50:              " << double_to_string(histogram.percentile(50.0)) << " ms"
+                           << slog::endl;
+                slog::info << "   p90:              " << double_to_string(histogram.percentile(90.0)) << " ms"
+                           << slog::endl;
+                slog::info << "   p99:              " << double_to_string(histogram.percentile(99.0)) << " ms"
+                           << slog::endl;
+            };
+            slog::info << "Count:               " << llmBenchmark.get_sequences_count() << " sequences, "
+                       << llmBenchmark.get_generated_tokens() << " tokens" << slog::endl;
+            slog::info << "Duration:            " << double_to_string(llmBenchmark.get_duration_in_milliseconds())
+                       << " ms" << slog::endl;
+            slog::info << "Time to first token:" << slog::endl;
+            write_percentiles(ttft);
+            slog::info << "Time per output token:" << slog::endl;
+            write_percentiles(tpot);
+            slog::info << "Inter-token latency:" << slog::endl;
+            write_percentiles(itl);
+            slog::info << "Sequence throughput:" << slog::endl;
+            slog::info << "   p10:              " << double_to_string(llmBenchmark.get_sequence_tokens_per_second(10.0))
+                       << " tokens/s" << slog::endl;
+            slog::info << "   p50:              " << double_to_string(llmBenchmark.get_sequence_tokens_per_second(50.0))
+                       << " tokens/s" << slog::endl;
+            slog::info << "Throughput:          " << double_to_string(llmBenchmark.get_tokens_per_second())
+                       << " tokens/s" << slog::endl;
+            return 0;
+        }
+
         // Iteration limit
         uint64_t niter = FLAGS_niter;
         size_t shape_groups_num = app_inputs_info.size();
@@ -1256,6 +1431,17 @@ int main(int argc, char* argv[]) {
             slog::info << "Skipping warmup inference due to -no_warmup flag" << slog::endl;
         }
 
+        // Open-loop load issues the requests at their arrival times regardless of the completion of the previous ones
+        std::optional<ArrivalSchedule> arrivals;
+        if (FLAGS_arrival_rate > 0) {
+            arrivals = ArrivalSchedule::poisson(FLAGS_arrival_rate);
+        } else if (!FLAGS_arrival_trace.empty()) {
+            arrivals = ArrivalSchedule::from_trace(FLAGS_arrival_trace);
+        } else if (FLAGS_max_irate > 0) {
+            // the rate limited closed-loop load is expected to issue a request every batchSize / max_irate seconds
+            inferRequestsQueue.set_expected_interval(1000.0 * batchSize / FLAGS_max_irate);
+        }
+
         size_t processedFramesN = 0;
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
@@ -1265,7 +1451,20 @@ int main(int argc, char* argv[]) {
          * executed in the same conditions **/
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !arrivals && iteration % nireq != 0)) {
+            Time::time_point arrivalTime{};
+            if (arrivals) {
+                ns arrivalOffset{0};
+                // the requests arriving after the time limit are not issued
+                if (!arrivals->next(arrivalOffset) ||
+                    !((niter != 0LL && iteration < niter) ||
+                      (duration_nanoseconds != 0LL && (uint64_t)arrivalOffset.count() < duration_nanoseconds))) {
+                    break;
+                }
+                arrivalTime = startTime + std::chrono::duration_cast<Time::duration>(arrivalOffset);
+                std::this_thread::sleep_until(arrivalTime);
+            }
+
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 OPENVINO_THROW("No idle Infer Requests!");
@@ -1300,7 +1499,7 @@ int main(int argc, char* argv[]) {
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
             } else {
-                inferRequest->start_async();
+                inferRequest->start_async(arrivalTime);
             }
             ++iteration;
 
@@ -1337,6 +1536,8 @@ int main(int argc, char* argv[]) {
 
         double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
         double fps = 1000.0 * processedFramesN / totalDuration;
+        const auto& latencyHistogram = inferRequestsQueue.get_latency_histogram();
+        const auto& responseHistogram = inferRequestsQueue.get_response_histogram();
 
         if (statistics) {
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
@@ -1367,6 +1568,23 @@ int main(int argc, char* argv[]) {
             }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
+            if (arrivals) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("arrival rate (requests/s)", "arrival_rate", arrivals->rate()),
+                     StatisticsVariant("response latency p50 (ms)",
+                                       "response_latency_p50",
+                                       responseHistogram.percentile(50.0)),
+                     StatisticsVariant("response latency p90 (ms)",
+                                       "response_latency_p90",
+                                       responseHistogram.percentile(90.0)),
+                     StatisticsVariant("response latency p99 (ms)",
+                                       "response_latency_p99",
+                                       responseHistogram.percentile(99.0)),
+                     StatisticsVariant("response latency p99.9 (ms)",
+                                       "response_latency_p99_9",
+                                       responseHistogram.percentile(99.9))});
+            }
         }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
@@ -1377,6 +1595,24 @@ int main(int argc, char* argv[]) {
             slog::info << "OpenVINO Runtime configuration settings were dumped to " << FLAGS_dump_config << slog::endl;
         }
 
+        if (!FLAGS_latency_histogram.empty()) {
+            nlohmann::json histograms;
+            histograms["load"] = FLAGS_arrival_rate > 0 ? "poisson" : (arrivals ? "trace" : "closed");
+            if (arrivals) {
+                histograms["arrival_rate"] = arrivals->rate();
+            }
+            histograms["throughput"] = fps;
+            histograms["service_time"] = latencyHistogram.to_json();
+            histograms["response_time"] = responseHistogram.to_json();
+
+            std::ofstream ofs(FLAGS_latency_histogram);
+            if (!ofs.is_open()) {
+                throw std::runtime_error("Can't open latency histogram file \"" + FLAGS_latency_histogram + "\".");
+            }
+            ofs << histograms;
+            slog::info << "Latency histograms were dumped to " << FLAGS_latency_histogram << slog::endl;
+        }
+
         if (!FLAGS_exec_graph_path.empty()) {
             try {
                 ov::serialize(compiledModel.get_runtime_model(), FLAGS_exec_graph_path);
@@ -1443,6 +1679,21 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        if (arrivals || !FLAGS_latency_histogram.empty()) {
+            slog::info << "Response latency (from arrival, corrected for coordinated omission):" << slog::endl;
+            slog::info << "   p50:              " << double_to_string(responseHistogram.percentile(50.0)) << " ms"
+                       << slog::endl;
+            slog::info << "   p90:              " << double_to_string(responseHistogram.percentile(90.0)) << " ms"
+                       << slog::endl;
+            slog::info << "   p99:              " << double_to_string(responseHistogram.percentile(99.0)) << " ms"
+                       << slog::endl;
+            slog::info << "   p99.9:            " << double_to_string(responseHistogram.percentile(99.9)) << " ms"
+                       << slog::endl;
+        }
+        if (arrivals) {
+            slog::info << "Arrival rate:        " << double_to_string(arrivals->rate()) << " requests/s"
+                       << slog::endl;
+        }
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
 
     } catch (const std::exception& ex) {
@@ -4542,10 +4542,53 @@ class Tensor:
     """
     openvino.Tensor holding either copy of memory or shared host memory.
     """
+    @staticmethod
+    def from_dlpack(tensor: typing.Any) -> Tensor:
+        """
+                    Creates Tensor sharing the host memory of a DLPack compatible tensor, without copying the data.
+        
+                    The memory is kept alive by this Tensor and released by the producer's deleter when
+                    the Tensor and all its copies are destroyed. Only row-major layouts are supported.
+                    Read-only DLPack tensors are copied.
+        
+                    :param tensor: Object implementing `__dlpack__` (like torch.Tensor or numpy.ndarray) or a DLPack capsule.
+                    :type tensor: Any
+                    :rtype: openvino.Tensor
+        
+                    :Example:
+                    .. code-block:: python
+        
+                        import openvino as ov
+                        import torch
+        
+                        t = ov.Tensor.from_dlpack(torch.ones(2, 3))
+        """
     def __copy__(self) -> Tensor:
         ...
     def __deepcopy__(self, arg0: dict) -> Tensor:
         ...
+    def __dlpack__(self, stream: typing.Any = None, max_version: typing.Any = None, dl_device: typing.Any = None, copy: typing.Any = None) -> typing.Any:
+        """
+                    Exports Tensor as a DLPack capsule sharing the Tensor's host memory.
+        
+                    The Tensor is kept alive until the consumer releases the capsule.
+                    Tensors of string and sub-byte element types cannot be exported.
+        
+                    :param stream: Must be None, Tensor memory is on the host.
+                    :param max_version: The highest DLPack version supported by the consumer.
+                    :type max_version: tuple[int, int]
+                    :param dl_device: Requested device, only (kDLCPU, 0) is supported.
+                    :type dl_device: tuple[int, int]
+                    :param copy: If `True`, the data is copied into the capsule instead of being shared.
+                    :type copy: bool
+                    :rtype: PyCapsule
+        """
+    def __dlpack_device__(self) -> tuple:
+        """
+                    Returns the DLPack device of the Tensor's memory, which is always (kDLCPU, 0).
+        
+                    :rtype: tuple[int, int]
+        """
     @typing.overload
     def __init__(self, array: numpy.ndarray[typing.Any, numpy.dtype[typing.Any]], shared_memory: bool = False) -> None:
         """
@@ -0,0 +1,366 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pyopenvino/core/dlpack.hpp"
+
+#include <pybind11/stl.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Python.h"
+#include "openvino/core/except.hpp"
+
+namespace {
+
+// ABI of the DLPack exchange structures (https://github.com/dmlc/dlpack, dlpack.h v1.x)
+constexpr uint32_t DLPACK_MAJOR_VERSION = 1;
+constexpr uint32_t DLPACK_MINOR_VERSION = 0;
+constexpr uint64_t DLPACK_FLAG_BITMASK_READ_ONLY = uint64_t{1} << 0;
+constexpr uint64_t DLPACK_FLAG_BITMASK_IS_COPIED = uint64_t{1} << 1;
+
+enum DLDeviceType : int32_t {
+    kDLCPU = 1,
+    kDLCUDAHost = 3,
+};
+
+enum DLDataTypeCode : uint8_t {
+    kDLInt = 0,
+    kDLUInt = 1,
+    kDLFloat = 2,
+    kDLBfloat = 4,
+    kDLBool = 6,
+};
+
+struct DLDevice {
+    int32_t device_type;
+    int32_t device_id;
+};
+
+struct DLDataType {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+};
+
+struct DLTensor {
+    void* data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t* shape;
+    int64_t* strides;
+    uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void* manager_ctx;
+    void (*deleter)(DLManagedTensor* self);
+};
+
+struct DLPackVersion {
+    uint32_t major;
+    uint32_t minor;
+};
+
+struct DLManagedTensorVersioned {
+    DLPackVersion version;
+    void* manager_ctx;
+    void (*deleter)(DLManagedTensorVersioned* self);
+    uint64_t flags;
+    DLTensor dl_tensor;
+};
+
+constexpr const char* dltensor_name = "dltensor";
+constexpr const char* used_dltensor_name = "used_dltensor";
+constexpr const char* dltensor_versioned_name = "dltensor_versioned";
+constexpr const char* used_dltensor_versioned_name = "used_dltensor_versioned";
+
+struct DLTypeMapping {
+    ov::element::Type type;
+    uint8_t code;
+    uint8_t bits;
+};
+
+const std::vector<DLTypeMapping>& dl_type_mapping() {
+    static const std::vector<DLTypeMapping> mapping = {
+        {ov::element::boolean, kDLBool, 8},
+        {ov::element::i8, kDLInt, 8},
+        {ov::element::i16, kDLInt, 16},
+        {ov::element::i32, kDLInt, 32},
+        {ov::element::i64, kDLInt, 64},
+        {ov::element::u8, kDLUInt, 8},
+        {ov::element::u16, kDLUInt, 16},
+        {ov::element::u32, kDLUInt, 32},
+        {ov::element::u64, kDLUInt, 64},
+        {ov::element::f16, kDLFloat, 16},
+        {ov::element::f32, kDLFloat, 32},
+        {ov::element::f64, kDLFloat, 64},
+        {ov::element::bf16, kDLBfloat, 16},
+    };
+    return mapping;
+}
+
+DLDataType to_dl_dtype(const ov::element::Type& type) {
+    for (const auto& item : dl_type_mapping()) {
+        if (item.type == type) {
+            return {item.code, item.bits, 1};
+        }
+    }
+    throw py::buffer_error("Tensor of " + type.get_type_name() + " element type cannot be exported to DLPack.");
+}
+
+ov::element::Type from_dl_dtype(const DLDataType& dtype) {
+    if (dtype.lanes == 1) {
+        for (const auto& item : dl_type_mapping()) {
+            if (item.code == dtype.code && item.bits == dtype.bits) {
+                return item.type;
+            }
+        }
+    }
+    throw py::buffer_error("DLPack data type (code: " + std::to_string(dtype.code) +
+                           ", bits: " + std::to_string(dtype.bits) + ", lanes: " + std::to_string(dtype.lanes) +
+                           ") is not supported by Tensor.");
+}
+
+bool is_host_device(int32_t device_type) {
+    return device_type == kDLCPU || device_type == kDLCUDAHost;
+}
+
+// Owns everything the exported DLTensor points to.
+template <class ManagedTensor>
+struct ExportContext {
+    ManagedTensor managed{};
+    // keeps alive the Python Tensor, and so the numpy array it may share the memory with
+    py::object owner;
+    ov::Tensor tensor;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+};
+
+template <class ManagedTensor>
+void delete_exported(ManagedTensor* managed) {
+    auto ctx = static_cast<ExportContext<ManagedTensor>*>(managed->manager_ctx);
+    // The deleter may be called by the consumer from any thread without holding the GIL
+    if (Py_IsInitialized()) {
+        py::gil_scoped_acquire acquire;
+        delete ctx;
+    } else {
+        // the interpreter is already finalized, the reference cannot be released anymore
+        ctx->owner.release();
+        delete ctx;
+    }
+}
+
+template <class ManagedTensor>
+void dlpack_capsule_destructor(PyObject* capsule) {
+    constexpr bool is_versioned = std::is_same_v<ManagedTensor, DLManagedTensorVersioned>;
+    const auto name = is_versioned ? dltensor_versioned_name : dltensor_name;
+    // the capsule is renamed by the consumer, so only the unconsumed tensors are deleted here
+    if (PyCapsule_IsValid(capsule, name)) {
+        auto managed = static_cast<ManagedTensor*>(PyCapsule_GetPointer(capsule, name));
+        if (managed->deleter) {
+            managed->deleter(managed);
+        }
+    }
+}
+
+template <class ManagedTensor>
+py::capsule export_tensor(const py::object& owner, const ov::Tensor& tensor) {
+    const auto& type = tensor.get_element_type();
+    const auto dtype = to_dl_dtype(type);
+    auto ctx = std::make_unique<ExportContext<ManagedTensor>>();
+    ctx->owner = owner;
+    ctx->tensor = tensor;
+
+    const auto& shape = tensor.get_shape();
+    const auto& byte_strides = tensor.get_strides();
+    ctx->shape.assign(shape.begin(), shape.end());
+    ctx->strides.reserve(byte_strides.size());
+    for (const auto stride : byte_strides) {
+        ctx->strides.push_back(static_cast<int64_t>(stride / type.size()));
+    }
+
+    auto& dl_tensor = ctx->managed.dl_tensor;
+    dl_tensor.data = ctx->tensor.data();
+    dl_tensor.device = {kDLCPU, 0};
+    dl_tensor.ndim = static_cast<int32_t>(ctx->shape.size());
+    dl_tensor.dtype = dtype;
+    dl_tensor.shape = ctx->shape.data();
+    dl_tensor.strides = ctx->strides.data();
+    dl_tensor.byte_offset = 0;
+    ctx->managed.manager_ctx = ctx.get();
+    ctx->managed.deleter = &delete_exported<ManagedTensor>;
+
+    constexpr bool is_versioned = std::is_same_v<ManagedTensor, DLManagedTensorVersioned>;
+    if constexpr (is_versioned) {
+        ctx->managed.version = {DLPACK_MAJOR_VERSION, DLPACK_MINOR_VERSION};
+        ctx->managed.flags = owner.is_none() ? DLPACK_FLAG_BITMASK_IS_COPIED : 0;
+    }
+    py::capsule capsule(&ctx->managed,
+                        is_versioned ? dltensor_versioned_name : dltensor_name,
+                        &dlpack_capsule_destructor<ManagedTensor>);
+    // the context is owned by the capsule from now on and is deleted by the DLPack deleter
+    ctx.release();
+    return capsule;
+}
+
+// Element strides of DLPack are converted to the byte strides of Tensor. Tensor supports only the row-major layouts
+// (padded ones included), the strides of unit dimensions are arbitrary in DLPack and are ignored.
+ov::Strides get_byte_strides(const DLTensor& dl_tensor, const ov::Shape& shape, size_t element_size) {
+    if (!dl_tensor.strides || ov::shape_size(shape) == 0) {
+        return {};
+    }
+    ov::Strides byte_strides(shape.size());
+    size_t min_stride = element_size;
+    bool is_dense = true;
+    for (size_t i = shape.size(); i-- > 0;) {
+        if (shape[i] == 1) {
+            byte_strides[i] = min_stride;
+        } else {
+            const auto stride = dl_tensor.strides[i];
+            if (stride <= 0 || static_cast<size_t>(stride) * element_size < min_stride) {
+                throw py::buffer_error("DLPack tensor with non row-major layout cannot be shared with Tensor.");
+            }
+            byte_strides[i] = static_cast<size_t>(stride) * element_size;
+        }
+        is_dense = is_dense && byte_strides[i] == min_stride;
+        min_stride = byte_strides[i] * shape[i];
+    }
+    return is_dense ? ov::Strides{} : byte_strides;
+}
+
+template <class ManagedTensor>
+ov::Tensor import_tensor(py::capsule& capsule, const char* name, const char* used_name) {
+    auto managed = static_cast<ManagedTensor*>(PyCapsule_GetPointer(capsule.ptr(), name));
+    if (!managed) {
+        throw py::error_already_set();
+    }
+    bool is_read_only = false;
+    if constexpr (std::is_same_v<ManagedTensor, DLManagedTensorVersioned>) {
+        if (managed->version.major > DLPACK_MAJOR_VERSION) {
+            throw py::buffer_error("DLPack version " + std::to_string(managed->version.major) + "." +
+                                   std::to_string(managed->version.minor) + " is not supported.");
+        }
+        is_read_only = (managed->flags & DLPACK_FLAG_BITMASK_READ_ONLY) != 0;
+    }
+
+    // Everything is validated before the capsule is consumed, so it is still owned by the producer on a failure
+    const auto& dl_tensor = managed->dl_tensor;
+    if (!is_host_device(dl_tensor.device.device_type)) {
+        throw py::buffer_error("Only DLPack tensors in the host memory can be shared with Tensor.");
+    }
+    const auto type = from_dl_dtype(dl_tensor.dtype);
+    ov::Shape shape(dl_tensor.ndim);
+    for (int32_t i = 0; i < dl_tensor.ndim; ++i) {
+        if (dl_tensor.shape[i] < 0) {
+            throw py::buffer_error("DLPack tensor has a negative dimension.");
+        }
+        shape[i] = static_cast<size_t>(dl_tensor.shape[i]);
+    }
+    const auto strides = get_byte_strides(dl_tensor, shape, type.size());
+    auto data = static_cast<char*>(dl_tensor.data) + dl_tensor.byte_offset;
+
+    if (PyCapsule_SetName(capsule.ptr(), used_name) != 0) {
+        throw py::error_already_set();
+    }
+    const std::shared_ptr<void> owner(managed, [](ManagedTensor* ptr) {
+        if (ptr->deleter) {
+            ptr->deleter(ptr);
+        }
+    });
+    auto tensor = ov::Tensor(ov::Tensor(type, shape, data, strides), owner);
+    if (is_read_only) {
+        // Tensor memory is always writable, so the read-only data is copied
+        ov::Tensor copied(type, shape);
+        tensor.copy_to(copied);
+        return copied;
+    }
+    return tensor;
+}
+
+}  // namespace
+
+namespace Common {
+namespace dlpack_helpers {
+
+py::capsule tensor_to_dlpack(py::object& self,
+                             const py::object& stream,
+                             const py::object& max_version,
+                             const py::object& dl_device,
+                             const py::object& copy) {
+    if (!stream.is_none()) {
+        throw py::buffer_error("Tensor memory is on the host, the stream argument of __dlpack__ must be None.");
+    }
+    if (!dl_device.is_none()) {
+        const auto device = dl_device.cast<std::pair<int32_t, int32_t>>();
+        if (device.first != kDLCPU || device.second != 0) {
+            throw py::buffer_error("Tensor can be exported by DLPack only to the host device.");
+        }
+    }
+    const auto& tensor = self.cast<ov::Tensor&>();
+    const auto type = tensor.get_element_type();
+    // the check is done before the copy, as the sub-byte and string types cannot be exported anyway
+    to_dl_dtype(type);
+
+    const bool is_versioned =
+        !max_version.is_none() && max_version.cast<std::pair<uint32_t, uint32_t>>().first >= DLPACK_MAJOR_VERSION;
+    ov::Tensor exported = tensor;
+    py::object owner = self;
+    if (!copy.is_none() && copy.cast<bool>()) {
+        exported = ov::Tensor(type, tensor.get_shape());
+        tensor.copy_to(exported);
+        owner = py::none();
+    }
+    return is_versioned ? export_tensor<DLManagedTensorVersioned>(owner, exported)
+                        : export_tensor<DLManagedTensor>(owner, exported);
+}
+
+py::tuple tensor_dlpack_device() {
+    return py::make_tuple(static_cast<int32_t>(kDLCPU), 0);
+}
+
+ov::Tensor tensor_from_dlpack(const py::object& obj) {
+    py::object capsule_obj;
+    if (PyCapsule_CheckExact(obj.ptr())) {
+        capsule_obj = obj;
+    } else {
+        if (!py::hasattr(obj, "__dlpack__")) {
+            throw py::type_error("Tensor.from_dlpack expects a DLPack capsule or an object implementing __dlpack__.");
+        }
+        if (py::hasattr(obj, "__dlpack_device__")) {
+            const auto device = obj.attr("__dlpack_device__")().cast<std::pair<int32_t, int32_t>>();
+            if (!is_host_device(device.first)) {
+                throw py::buffer_error("Only DLPack tensors in the host memory can be shared with Tensor.");
+            }
+        }
+        try {
+            capsule_obj = obj.attr("__dlpack__")(py::arg("max_version") =
+                                                     py::make_tuple(DLPACK_MAJOR_VERSION, DLPACK_MINOR_VERSION));
+        } catch (py::error_already_set& e) {
+            // producers implementing DLPack older than 1.0 do not accept max_version
+            if (!e.matches(PyExc_TypeError)) {
+                throw;
+            }
+            capsule_obj = obj.attr("__dlpack__")();
+        }
+    }
+
+    auto capsule = py::reinterpret_borrow<py::capsule>(capsule_obj);
+    if (PyCapsule_IsValid(capsule.ptr(), dltensor_versioned_name)) {
+        return import_tensor<DLManagedTensorVersioned>(capsule, dltensor_versioned_name, used_dltensor_versioned_name);
+    }
+    if (PyCapsule_IsValid(capsule.ptr(), dltensor_name)) {
+        return import_tensor<DLManagedTensor>(capsule, dltensor_name, used_dltensor_name);
+    }
+    throw py::value_error("Tensor.from_dlpack expects a DLPack capsule which has not been consumed yet.");
+}
+
+};  // namespace dlpack_helpers
+};  // namespace Common
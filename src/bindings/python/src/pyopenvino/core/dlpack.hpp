@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+#include "openvino/runtime/tensor.hpp"
+
+namespace py = pybind11;
+
+namespace Common {
+namespace dlpack_helpers {
+
+// Implements `__dlpack__` of the Python Tensor `self`: returns a DLPack capsule sharing the Tensor's host memory.
+// The capsule keeps `self` alive until the consumer calls the deleter.
+py::capsule tensor_to_dlpack(py::object& self,
+                             const py::object& stream,
+                             const py::object& max_version,
+                             const py::object& dl_device,
+                             const py::object& copy);
+
+// Implements `__dlpack_device__`, the Tensor memory is always on the host.
+py::tuple tensor_dlpack_device();
+
+// Consumes a DLPack capsule, or an object implementing `__dlpack__`, and wraps its host memory into a Tensor.
+// The memory is released by the producer's deleter when the last copy of the Tensor is destroyed.
+ov::Tensor tensor_from_dlpack(const py::object& obj);
+
+};  // namespace dlpack_helpers
+};  // namespace Common
@@ -10,6 +10,7 @@
 
 #include "openvino/runtime/tensor.hpp"
 #include "pyopenvino/core/common.hpp"
+#include "pyopenvino/core/dlpack.hpp"
 #include "pyopenvino/core/remote_tensor.hpp"
 #include "pyopenvino/utils/utils.hpp"
 
@@ -516,6 +517,69 @@ void regclass_Tensor(py::module m) {
             Tensor's shape get/set.
         )");
 
+    cls.def_static("from_dlpack",
+                   &Common::dlpack_helpers::tensor_from_dlpack,
+                   py::arg("tensor"),
+                   R"(
+            Creates Tensor sharing the host memory of a DLPack compatible tensor, without copying the data.
+
+            The memory is kept alive by this Tensor and released by the producer's deleter when
+            the Tensor and all its copies are destroyed. Only row-major layouts are supported.
+            Read-only DLPack tensors are copied.
+
+            :param tensor: Object implementing `__dlpack__` (like torch.Tensor or numpy.ndarray) or a DLPack capsule.
+            :type tensor: Any
+            :rtype: openvino.Tensor
+
+            :Example:
+            .. code-block:: python
+
+                import openvino as ov
+                import torch
+
+                t = ov.Tensor.from_dlpack(torch.ones(2, 3))
+        )");
+
+    cls.def(
+        "__dlpack__",
+        [](py::object& self,
+           const py::object& stream,
+           const py::object& max_version,
+           const py::object& dl_device,
+           const py::object& copy) {
+            return Common::dlpack_helpers::tensor_to_dlpack(self, stream, max_version, dl_device, copy);
+        },
+        py::arg("stream") = py::none(),
+        py::arg("max_version") = py::none(),
+        py::arg("dl_device") = py::none(),
+        py::arg("copy") = py::none(),
+        R"(
+            Exports Tensor as a DLPack capsule sharing the Tensor's host memory.
+
+            The Tensor is kept alive until the consumer releases the capsule.
+            Tensors of string and sub-byte element types cannot be exported.
+
+            :param stream: Must be None, Tensor memory is on the host.
+            :param max_version: The highest DLPack version supported by the consumer.
+            :type max_version: tuple[int, int]
+            :param dl_device: Requested device, only (kDLCPU, 0) is supported.
+            :type dl_device: tuple[int, int]
+            :param copy: If `True`, the data is copied into the capsule instead of being shared.
+            :type copy: bool
+            :rtype: PyCapsule
+        )");
+
+    cls.def(
+        "__dlpack_device__",
+        [](const ov::Tensor& self) {
+            return Common::dlpack_helpers::tensor_dlpack_device();
+        },
+        R"(
+            Returns the DLPack device of the Tensor's memory, which is always (kDLCPU, 0).
+
+            :rtype: tuple[int, int]
+        )");
+
     cls.def("__repr__", [](const ov::Tensor& self) {
         std::stringstream ss;
 
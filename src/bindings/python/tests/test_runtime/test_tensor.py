@@ -776,3 +776,91 @@ def test_scalar_tensor():
     assert np.array_equal(tensor.data, exp_data)
     tensor = ov.Tensor(exp_data, ov.Shape(), ov.Type.i32)
     assert np.array_equal(tensor.data, exp_data)
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="numpy does not support DLPack")
+@pytest.mark.parametrize(
+    ("ov_type", "numpy_dtype"),
+    [
+        (ov.Type.f32, np.float32),
+        (ov.Type.f16, np.float16),
+        (ov.Type.i64, np.int64),
+        (ov.Type.u8, np.uint8),
+    ],
+)
+def test_dlpack_export_shares_memory(ov_type, numpy_dtype):
+    tensor = ov.Tensor(ov_type, [2, 3, 4])
+    tensor.data[:] = np.arange(24).reshape(2, 3, 4).astype(numpy_dtype)
+
+    assert tensor.__dlpack_device__() == (1, 0)
+    array = np.from_dlpack(tensor)
+    assert array.dtype == numpy_dtype
+    assert np.array_equal(array, tensor.data)
+    # the memory is shared and outlives the Tensor
+    del tensor
+    assert np.array_equal(array, np.arange(24).reshape(2, 3, 4).astype(numpy_dtype))
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="numpy does not support DLPack")
+def test_dlpack_export_roi_tensor():
+    tensor = ov.Tensor(np.arange(24, dtype=np.float32).reshape(2, 3, 4))
+    roi = ov.Tensor(tensor, [0, 1, 1], [2, 3, 3])
+    array = np.from_dlpack(roi)
+    assert np.array_equal(array, np.arange(24, dtype=np.float32).reshape(2, 3, 4)[:, 1:3, 1:3])
+
+
+def test_dlpack_export_unsupported_type():
+    tensor = ov.Tensor(ov.Type.u4, [8])
+    with pytest.raises(BufferError):
+        tensor.__dlpack__()
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="numpy does not support DLPack")
+@pytest.mark.parametrize("shape", [[], [0, 3], [1, 1], [2, 3, 4]])
+def test_dlpack_import_shares_memory(shape):
+    array = np.arange(np.prod(shape, dtype=int), dtype=np.float32).reshape(shape)
+    tensor = ov.Tensor.from_dlpack(array)
+
+    assert tensor.element_type == ov.Type.f32
+    assert list(tensor.shape) == shape
+    assert np.array_equal(tensor.data, array)
+    if array.size > 0:
+        array.flat[0] = 42
+        assert tensor.data.flat[0] == 42
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="numpy does not support DLPack")
+def test_dlpack_import_keeps_memory_alive():
+    tensor = ov.Tensor.from_dlpack(np.full([16, 16], 7, dtype=np.int32))
+    assert np.array_equal(tensor.data, np.full([16, 16], 7, dtype=np.int32))
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="numpy does not support DLPack")
+def test_dlpack_import_strided():
+    array = np.arange(48, dtype=np.float32).reshape(4, 12)[:, :6]
+    tensor = ov.Tensor.from_dlpack(array)
+    assert not tensor.is_continuous()
+    assert list(tensor.strides) == [48, 4]
+    assert np.array_equal(tensor.data, array)
+
+    with pytest.raises(BufferError):
+        ov.Tensor.from_dlpack(np.arange(6, dtype=np.float32).reshape(2, 3).T)
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="numpy does not support DLPack")
+def test_dlpack_import_capsule():
+    array = np.arange(6, dtype=np.int8).reshape(2, 3)
+    capsule = array.__dlpack__()
+    tensor = ov.Tensor.from_dlpack(capsule)
+    assert np.array_equal(tensor.data, array)
+    # the capsule can be consumed only once
+    with pytest.raises(ValueError):
+        ov.Tensor.from_dlpack(capsule)
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="numpy does not support DLPack")
+def test_dlpack_round_trip_infer():
+    compiled_model = generate_relu_compiled_model("CPU", input_shape=[1, 3, 4])
+    array = np.linspace(-1, 1, 12, dtype=np.float32).reshape(1, 3, 4)
+    result = compiled_model(ov.Tensor.from_dlpack(array))[0]
+    assert np.array_equal(result, np.maximum(array, 0))
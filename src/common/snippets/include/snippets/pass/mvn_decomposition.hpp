@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/core/node.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::snippets::pass {
+
+/**
+ * @interface MVNDecomposition
+ * @brief Decomposes MVN over the last dimension (LayerNorm) to a range of low-level operations:
+ *        mean = ReduceSum(x) / N, y = (x - mean) * (ReduceSum((x - mean) ^ 2) / N + eps) ^ -0.5
+ * @ingroup snippets
+ */
+class MVNDecomposition : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("snippets::pass::MVNDecomposition");
+    MVNDecomposition();
+
+    // Returns true if the node is MVN-6 which normalizes only over the static last dimension
+    static bool is_supported_mvn(const std::shared_ptr<const ov::Node>& node);
+};
+
+}  // namespace ov::snippets::pass
@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/core/node.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+
+namespace ov::snippets::pass {
+
+/**
+ * @interface RMSDecomposition
+ * @brief Decomposes internal RMS (RMSNorm) to a range of low-level operations:
+ *        y = x * (ReduceSum(x ^ 2) / N + eps) ^ -0.5 * gamma
+ * @ingroup snippets
+ */
+class RMSDecomposition : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("snippets::pass::RMSDecomposition");
+    RMSDecomposition();
+
+    // Returns true if the node is RMS with the static last dimension
+    static bool is_supported_rms(const std::shared_ptr<const ov::Node>& node);
+};
+
+}  // namespace ov::snippets::pass
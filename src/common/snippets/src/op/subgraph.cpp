@@ -28,6 +28,7 @@
 #include "openvino/op/fake_quantize.hpp"
 #include "openvino/op/group_normalization.hpp"
 #include "openvino/op/matmul.hpp"
+#include "openvino/op/mvn.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/reduce_max.hpp"
 #include "openvino/op/reduce_sum.hpp"
@@ -41,6 +42,7 @@
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/pass/pass_config.hpp"
+#include "ov_ops/rms.hpp"
 #include "snippets/generator.hpp"
 #include "snippets/itt.hpp"
 #include "snippets/lowered/expression.hpp"
@@ -90,8 +92,10 @@
 #include "snippets/pass/gn_decomposition.hpp"
 #include "snippets/pass/manager.hpp"
 #include "snippets/pass/matmul_to_brgemm.hpp"
+#include "snippets/pass/mvn_decomposition.hpp"
 #include "snippets/pass/propagate_precision.hpp"
 #include "snippets/pass/reduce_to_snippets_reduce.hpp"
+#include "snippets/pass/rms_decomposition.hpp"
 #include "snippets/pass/softmax_decomposition.hpp"
 #include "snippets/pass/transpose_decomposition.hpp"
 #include "snippets/remarks.hpp"
@@ -133,6 +137,8 @@ auto Subgraph::is_domain_sensitive_op(const std::shared_ptr<ov::Node>& op) -> bo
                               ov::op::v1::Broadcast,
                               ov::op::v3::Broadcast,
                               ov::op::v12::GroupNormalization,
+                              ov::op::v6::MVN,
+                              ov::op::internal::RMS,
                               ov::op::v1::ReduceSum,
                               ov::op::v1::ReduceMax,
                               op::Reshape>(op);
@@ -479,6 +485,8 @@ void Subgraph::data_flow_transformations(
         manager.register_pass<snippets::pass::TransposeDecomposition>();
         manager.register_pass<snippets::pass::SoftmaxDecomposition>();
         manager.register_pass<snippets::pass::GNDecomposition>();
+        manager.register_pass<snippets::pass::MVNDecomposition>();
+        manager.register_pass<snippets::pass::RMSDecomposition>();
     }
     manager.register_pass<snippets::pass::BroadcastToMoveBroadcast>();
     manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
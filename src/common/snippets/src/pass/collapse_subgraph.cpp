@@ -82,6 +82,8 @@
 #include "snippets/op/subgraph.hpp"
 #include "snippets/pass/fq_decomposition.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
+#include "snippets/pass/mvn_decomposition.hpp"
+#include "snippets/pass/rms_decomposition.hpp"
 #include "snippets/pass/tokenization.hpp"
 #include "snippets/pass/tokenization_config.hpp"
 #include "snippets/pass/transpose_decomposition.hpp"
@@ -235,9 +237,15 @@ auto is_supported_op(const std::shared_ptr<const Node>& n) -> bool {
         return false;
     };
 
+    // Note: normalizations are supported only over the last dimension, as the reductions
+    auto is_supported_normalization = [](const std::shared_ptr<const Node>& n) -> bool {
+        return MVNDecomposition::is_supported_mvn(n) || RMSDecomposition::is_supported_rms(n);
+    };
+
     return is_supported_fq_op(n) || is_supported_unary_eltwise_op(n) || is_supported_binary_eltwise_op(n) ||
            is_supported_ternary_eltwise_op(n) || is_supported_transpose(n) || is_supported_softmax(n) ||
-           is_supported_matmul(n) || is_supported_broadcast_op(n) || is_supported_reduce_op(n);
+           is_supported_matmul(n) || is_supported_broadcast_op(n) || is_supported_reduce_op(n) ||
+           is_supported_normalization(n);
 }
 
 auto has_supported_in_out(const std::shared_ptr<const Node>& n) -> bool {
@@ -0,0 +1,121 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/mvn_decomposition.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/validation_util.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/power.hpp"
+#include "openvino/op/sqrt.hpp"
+#include "openvino/op/subtract.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "snippets/itt.hpp"
+#include "snippets/lowered/port_descriptor.hpp"
+#include "snippets/op/convert_saturation.hpp"
+#include "snippets/op/powerstatic.hpp"
+#include "snippets/op/reduce.hpp"
+#include "snippets/utils/utils.hpp"
+
+namespace ov::snippets::pass {
+
+bool MVNDecomposition::is_supported_mvn(const std::shared_ptr<const ov::Node>& node) {
+    const auto mvn = ov::as_type_ptr<const ov::op::v6::MVN>(node);
+    if (!mvn) {
+        return false;
+    }
+    const auto& pshape = mvn->get_input_partial_shape(0);
+    if (pshape.rank().is_dynamic() || pshape.size() == 0 || pshape[pshape.size() - 1].is_dynamic()) {
+        return false;
+    }
+    const auto axes = ov::as_type_ptr<const ov::op::v0::Constant>(mvn->get_input_node_shared_ptr(1));
+    if (!axes || ov::shape_size(axes->get_shape()) != 1) {
+        return false;
+    }
+    const auto rank = static_cast<int64_t>(pshape.size());
+    // Note: normalization only over the last dimension is supported, as for the reductions
+    return ov::util::normalize(axes->cast_vector<int64_t>()[0], rank) == rank - 1;
+}
+
+// mvn = (x - mean) * (ReduceSum((x - mean) ^ 2) / N + eps) ^ -0.5, where mean = ReduceSum(x) / N
+MVNDecomposition::MVNDecomposition() {
+    MATCHER_SCOPE(MVNDecomposition);
+    auto mvn_pattern = ov::pass::pattern::wrap_type<ov::op::v6::MVN>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::pass::MVNDecomposition")
+        const auto mvn = ov::as_type_ptr<ov::op::v6::MVN>(m.get_match_root());
+        OPENVINO_ASSERT(is_supported_mvn(mvn), "MVNDecomposition supports only MVN over the static last dimension");
+
+        const auto& pshape = mvn->get_input_partial_shape(0);
+        const auto rank = pshape.size();
+        const auto axis = rank - 1;
+        const auto inv_size = 1.0F / static_cast<float>(pshape[axis].get_length());
+
+        ov::Output<ov::Node> data_f32 = mvn->input_value(0);
+        if (data_f32.get_element_type() != element::f32) {
+            data_f32 = std::make_shared<ov::snippets::op::ConvertSaturation>(data_f32, element::f32);
+        }
+
+        // mean
+        const auto reduce_sum = std::make_shared<ov::snippets::op::ReduceSum>(data_f32, axis);
+        ov::snippets::op::ReduceBase::compute_and_set_reduce_subtensors(reduce_sum);
+        const auto inv_size_node = ov::op::v0::Constant::create(element::f32, Shape{}, {inv_size});
+        const auto mean = std::make_shared<ov::op::v1::Multiply>(reduce_sum, inv_size_node);
+        std::shared_ptr<ov::Node> result = std::make_shared<ov::op::v1::Subtract>(data_f32, mean);
+
+        if (mvn->get_normalize_variance()) {
+            // variance
+            const auto sqr_const = ov::op::v0::Constant::create(element::f32, Shape{1}, {2});
+            const auto sqr = std::make_shared<ov::op::v1::Power>(result, sqr_const);
+            const auto sqr_reduce_sum = std::make_shared<ov::snippets::op::ReduceSum>(sqr, axis);
+            ov::snippets::op::ReduceBase::compute_and_set_reduce_subtensors(sqr_reduce_sum);
+            const auto inv_size_node_aux = ov::op::v0::Constant::create(element::f32, Shape{}, {inv_size});
+            const auto variance = std::make_shared<ov::op::v1::Multiply>(sqr_reduce_sum, inv_size_node_aux);
+
+            const auto eps_node = ov::op::v0::Constant::create(element::f32, Shape{1}, {mvn->get_eps()});
+            std::shared_ptr<ov::Node> stddev;
+            if (mvn->get_eps_mode() == ov::op::MVNEpsMode::INSIDE_SQRT) {
+                stddev = std::make_shared<ov::op::v0::Sqrt>(std::make_shared<ov::op::v1::Add>(variance, eps_node));
+            } else {
+                stddev = std::make_shared<ov::op::v1::Add>(std::make_shared<ov::op::v0::Sqrt>(variance), eps_node);
+            }
+            const auto stddev_inv = std::make_shared<ov::snippets::op::PowerStatic>(stddev, -1.F);
+
+            std::vector<size_t> subtensor(rank, 1);
+            subtensor[axis] = utils::get_full_dim_value();
+            lowered::PortDescriptorUtils::set_port_descriptor(stddev_inv->input(0), subtensor);
+            lowered::PortDescriptorUtils::set_port_descriptor(stddev_inv->output(0), std::move(subtensor));
+
+            result = std::make_shared<ov::op::v1::Multiply>(result, stddev_inv);
+        }
+
+        const auto result_prec = mvn->get_output_element_type(0);
+        if (result_prec != element::f32) {
+            result = std::make_shared<ov::snippets::op::ConvertSaturation>(result, result_prec);
+        }
+
+        return ov::replace_node_update_name(mvn, result);
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(mvn_pattern, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::snippets::pass
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/rms_decomposition.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/power.hpp"
+#include "openvino/op/sqrt.hpp"
+#include "openvino/pass/matcher_pass.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "ov_ops/rms.hpp"
+#include "snippets/itt.hpp"
+#include "snippets/lowered/port_descriptor.hpp"
+#include "snippets/op/convert_saturation.hpp"
+#include "snippets/op/powerstatic.hpp"
+#include "snippets/op/reduce.hpp"
+#include "snippets/utils/utils.hpp"
+
+namespace ov::snippets::pass {
+
+bool RMSDecomposition::is_supported_rms(const std::shared_ptr<const ov::Node>& node) {
+    const auto rms = ov::as_type_ptr<const ov::op::internal::RMS>(node);
+    if (!rms) {
+        return false;
+    }
+    const auto& pshape = rms->get_input_partial_shape(0);
+    return pshape.rank().is_static() && pshape.size() != 0 && pshape[pshape.size() - 1].is_static();
+}
+
+// rms = x * (ReduceSum(x ^ 2) / N + eps) ^ -0.5 * gamma
+RMSDecomposition::RMSDecomposition() {
+    MATCHER_SCOPE(RMSDecomposition);
+    auto rms_pattern = ov::pass::pattern::wrap_type<ov::op::internal::RMS>();
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::pass::RMSDecomposition")
+        const auto rms = ov::as_type_ptr<ov::op::internal::RMS>(m.get_match_root());
+        OPENVINO_ASSERT(is_supported_rms(rms), "RMSDecomposition supports only RMS with the static last dimension");
+
+        const auto& pshape = rms->get_input_partial_shape(0);
+        const auto rank = pshape.size();
+        const auto axis = rank - 1;
+        const auto inv_size = 1.0F / static_cast<float>(pshape[axis].get_length());
+
+        ov::Output<ov::Node> data = rms->input_value(0);
+        if (data.get_element_type() != element::f32) {
+            data = std::make_shared<ov::snippets::op::ConvertSaturation>(data, element::f32);
+        }
+
+        // mean(x ^ 2)
+        const auto sqr_const = ov::op::v0::Constant::create(element::f32, Shape{1}, {2});
+        const auto sqr = std::make_shared<ov::op::v1::Power>(data, sqr_const);
+        const auto sqr_reduce_sum = std::make_shared<ov::snippets::op::ReduceSum>(sqr, axis);
+        ov::snippets::op::ReduceBase::compute_and_set_reduce_subtensors(sqr_reduce_sum);
+        const auto inv_size_node = ov::op::v0::Constant::create(element::f32, Shape{}, {inv_size});
+        const auto sqr_mean = std::make_shared<ov::op::v1::Multiply>(sqr_reduce_sum, inv_size_node);
+
+        // (mean(x ^ 2) + eps) ^ -0.5
+        const auto eps_node =
+            ov::op::v0::Constant::create(element::f32, Shape{1}, {static_cast<float>(rms->get_epsilon())});
+        const auto eps_add = std::make_shared<ov::op::v1::Add>(sqr_mean, eps_node);
+        const auto rms_value = std::make_shared<ov::op::v0::Sqrt>(eps_add);
+        const auto rms_inv = std::make_shared<ov::snippets::op::PowerStatic>(rms_value, -1.F);
+
+        std::vector<size_t> subtensor(rank, 1);
+        subtensor[axis] = utils::get_full_dim_value();
+        lowered::PortDescriptorUtils::set_port_descriptor(rms_inv->input(0), subtensor);
+        lowered::PortDescriptorUtils::set_port_descriptor(rms_inv->output(0), std::move(subtensor));
+
+        std::shared_ptr<ov::Node> result = std::make_shared<ov::op::v1::Multiply>(data, rms_inv);
+        if (rms->get_input_size() > 1) {
+            ov::Output<ov::Node> gamma = rms->input_value(1);
+            if (gamma.get_element_type() != element::f32) {
+                gamma = std::make_shared<ov::snippets::op::ConvertSaturation>(gamma, element::f32);
+            }
+            result = std::make_shared<ov::op::v1::Multiply>(result, gamma);
+        }
+
+        const auto result_prec = rms->get_output_element_type(0);
+        if (result_prec != element::f32) {
+            result = std::make_shared<ov::snippets::op::ConvertSaturation>(result, result_prec);
+        }
+
+        return ov::replace_node_update_name(rms, result);
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(rms_pattern, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace ov::snippets::pass
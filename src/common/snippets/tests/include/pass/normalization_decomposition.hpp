@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "lowering_utils.hpp"
+#include "snippets_helpers.hpp"
+
+/* The main purpose is to test that MVNDecomposition and RMSDecomposition properly decompose
+ * the normalizations over the last dimension
+ */
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+typedef std::tuple<
+        PartialShape,  // Input shape
+        float          // Epsilon
+> NormalizationDecompositionParams;
+
+class NormalizationDecompositionTest : public LoweringTests,
+                                       public testing::WithParamInterface<NormalizationDecompositionParams> {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<NormalizationDecompositionParams> obj);
+protected:
+    std::shared_ptr<SnippetsFunctionBase> snippets_model;
+};
+
+class MVNDecompositionTest : public NormalizationDecompositionTest {
+protected:
+    void SetUp() override;
+};
+
+class RMSDecompositionTest : public NormalizationDecompositionTest {
+protected:
+    void SetUp() override;
+};
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "pass/normalization_decomposition.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "subgraph_normalization.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::string NormalizationDecompositionTest::getTestCaseName(
+    testing::TestParamInfo<NormalizationDecompositionParams> obj) {
+    const auto& [input_shape, eps] = obj.param;
+    std::ostringstream result;
+    result << "IS=" << ov::test::utils::partialShape2str({input_shape}) << "_";
+    result << "eps=" << eps;
+    return result.str();
+}
+
+void MVNDecompositionTest::SetUp() {
+    LoweringTests::SetUp();
+    const auto& [input_shape, eps] = this->GetParam();
+    snippets_model = std::make_shared<MVNFunction>(std::vector<PartialShape>{input_shape}, eps);
+}
+
+void RMSDecompositionTest::SetUp() {
+    LoweringTests::SetUp();
+    const auto& [input_shape, eps] = this->GetParam();
+    const PartialShape gamma_shape{input_shape[input_shape.size() - 1]};
+    snippets_model = std::make_shared<RMSFunction>(std::vector<PartialShape>{input_shape, gamma_shape}, eps);
+}
+
+TEST_P(MVNDecompositionTest, MVNDecomposition) {
+    auto subgraph = getLoweredSubgraph(snippets_model->getOriginal());
+    model = subgraph->body_ptr();
+    model_ref = snippets_model->getLowered();
+}
+
+TEST_P(RMSDecompositionTest, RMSDecomposition) {
+    auto subgraph = getLoweredSubgraph(snippets_model->getOriginal());
+    model = subgraph->body_ptr();
+    model_ref = snippets_model->getLowered();
+}
+
+namespace NormalizationDecompositionTestInstantiation {
+
+const std::vector<ov::PartialShape> input_shapes{{1, 64},
+                                                 {2, 16, 128},
+                                                 {1, 4, 8, 33}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_MVNDecomposition,
+                         MVNDecompositionTest,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                            ::testing::Values(0.00001f)),
+                         NormalizationDecompositionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_RMSDecomposition,
+                         RMSDecompositionTest,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                            ::testing::Values(0.00001f)),
+                         NormalizationDecompositionTest::getTestCaseName);
+
+}  // namespace NormalizationDecompositionTestInstantiation
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -19,6 +19,10 @@ namespace internal {
  * 2. LoRA_input: input to which the Low-Rank adaptation is applied.
  *    The adapted input is combined with `main_flow_input`.
  * 3. LoRA_matrices: 3 Low-Rank adaptation matrices applied to `LoRA_input`.
+ * 4. adapter_indices (optional): adapter index of each row of `LoRA_input`.
+ *    In this multi-adapter mode `LoRA_matrices` are pools of the adapters, which are stacked along the first axis:
+ *    A [adapters, rank, K], alpha [adapters, 1, rank] and B [adapters, N, rank].
+ *    Each row of `LoRA_input` is adapted by the matrices of its own adapter, so one batch can serve many adapters.
  * The fused subgraph can be optimized in runtime based on LoRA semantic.
  * For instance, `main_flow_input` can be fast-forwarded to output in case of empty `LoRA_matrices`.
  */
@@ -31,6 +35,10 @@ public:
 
     void validate_and_infer_types() override;
     std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    bool is_multi_adapter() const {
+        return get_input_size() == 6;
+    }
 };
 
 }  // namespace internal
@@ -14,6 +14,7 @@ namespace ov {
 namespace pass {
 
 class TRANSFORMATIONS_API LoraSubgraphFusion;
+class TRANSFORMATIONS_API LoraMultiAdapterSubgraphFusion;
 
 }  // namespace pass
 }  // namespace ov
@@ -23,3 +24,17 @@ public:
     OPENVINO_MATCHER_PASS_RTTI("LoraSubgraphFusion");
     LoraSubgraphFusion();
 };
+
+/**
+ * @ingroup ov_transformation_common_api
+ * @brief Fuses the multi-adapter LoRA subgraph, where the matrices of each row of the 2D LoRA input are gathered from
+ * the adapters pools by the adapter indices, into LoraSubgraph with the adapter indices as the last input:
+ *
+ *   Gather(A_pool, indices, 0) -> MatMul(Unsqueeze(lora_input, 1), A, transpose_b) -> Multiply(Gather(alpha_pool))
+ *   -> MatMul(Gather(B_pool), transpose_b) -> Squeeze(1) -> Add(main_flow)
+ */
+class ov::pass::LoraMultiAdapterSubgraphFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("LoraMultiAdapterSubgraphFusion");
+    LoraMultiAdapterSubgraphFusion();
+};
@@ -14,7 +14,11 @@
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/squeeze.hpp"
 #include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/gather_base.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/pass/pattern/op/optional.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
@@ -124,4 +128,143 @@ LoraSubgraphFusion::LoraSubgraphFusion() {
     this->register_matcher(m, callback);
 }
 
+LoraMultiAdapterSubgraphFusion::LoraMultiAdapterSubgraphFusion() {
+    MATCHER_SCOPE(LoraMultiAdapterSubgraphFusion);
+    auto lora_input_m = pattern::any_input(pattern::rank_equals(2));
+    auto indices_m = pattern::any_input(pattern::rank_equals(1));
+    auto unsqueeze_const_m = pattern::wrap_type<v0::Constant>();
+    auto unsqueeze_m =
+        pattern::wrap_type<v0::Unsqueeze, v1::Reshape>({lora_input_m, unsqueeze_const_m}, pattern::rank_equals(3));
+
+    auto gather_m = [&indices_m](const std::shared_ptr<Node>& pool_m) {
+        return pattern::wrap_type<op_util::GatherBase>({pool_m, indices_m, pattern::wrap_type<v0::Constant>()},
+                                                       pattern::consumers_count(1));
+    };
+    auto pool1_m = pattern::any_input(pattern::rank_equals(3));
+    auto gather1_m = gather_m(pool1_m);
+    auto matmul1_m = pattern::wrap_type<v0::MatMul>({unsqueeze_m, gather1_m}, pattern::consumers_count(1));
+
+    auto pool2_m = pattern::any_input(pattern::rank_equals(3));
+    auto gather2_m = gather_m(pool2_m);
+    auto multiply_m = pattern::wrap_type<v1::Multiply>({matmul1_m, gather2_m}, pattern::consumers_count(1));
+
+    auto pool3_m = pattern::any_input(pattern::rank_equals(3));
+    auto gather3_m = gather_m(pool3_m);
+    auto matmul2_m = pattern::wrap_type<v0::MatMul>({multiply_m, gather3_m}, pattern::consumers_count(1));
+
+    auto squeeze_m = pattern::wrap_type<v0::Squeeze, v1::Reshape>({matmul2_m, pattern::wrap_type<v0::Constant>()},
+                                                                  pattern::rank_equals(2));
+    auto main_flow_m = pattern::wrap_type<v0::MatMul>({lora_input_m, pattern::any_input()});
+    auto add_m = pattern::wrap_type<v1::Add>({squeeze_m, main_flow_m});
+
+    ov::matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto& unsqueeze = pattern_map.at(unsqueeze_m);
+        const auto& main_flow = pattern_map.at(main_flow_m);
+        const auto& add = pattern_map.at(add_m);
+        const std::vector<std::shared_ptr<Node>> gathers{pattern_map.at(gather1_m).get_node_shared_ptr(),
+                                                         pattern_map.at(gather2_m).get_node_shared_ptr(),
+                                                         pattern_map.at(gather3_m).get_node_shared_ptr()};
+
+        const auto add_node = add.get_node_shared_ptr();
+        if (transformation_callback(add_node)) {
+            return false;
+        }
+
+        // each row of the LoRA input is multiplied by the matrices of its adapter
+        const auto& unsqueezed_shape = unsqueeze.get_partial_shape();
+        if (unsqueezed_shape[1] != 1) {
+            return false;
+        }
+
+        // Only the layouts of the pools which are executed by the segmented GEMMs are fused:
+        // A [adapters, rank, K], alpha [adapters, 1, rank] and B [adapters, N, rank]
+        for (const auto& matmul : {pattern_map.at(matmul1_m), pattern_map.at(matmul2_m)}) {
+            const auto matmul_node = ov::as_type_ptr<v0::MatMul>(matmul.get_node_shared_ptr());
+            if (matmul_node->get_transpose_a() || !matmul_node->get_transpose_b()) {
+                return false;
+            }
+        }
+        for (const auto& gather : gathers) {
+            const auto gather_node = ov::as_type_ptr<op_util::GatherBase>(gather);
+            if (gather_node->get_axis() != 0 || gather_node->get_batch_dims() != 0) {
+                return false;
+            }
+        }
+        const auto& input_shape = pattern_map.at(lora_input_m).get_partial_shape();
+        const auto& main_flow_shape = main_flow.get_partial_shape();
+        const auto& a_shape = pattern_map.at(pool1_m).get_partial_shape();
+        const auto& alpha_shape = pattern_map.at(pool2_m).get_partial_shape();
+        const auto& b_shape = pattern_map.at(pool3_m).get_partial_shape();
+        if (main_flow_shape.rank().is_dynamic() || main_flow_shape.size() != 2) {
+            return false;
+        }
+        const auto& adapters = a_shape[0];
+        const auto& rank = a_shape[1];
+        // the static dimensions of the pools must match exactly, a broadcast alpha of static shape is not fused
+        if (!a_shape[2].compatible(input_shape[1]) || !b_shape[1].compatible(main_flow_shape[1]) ||
+            !b_shape[2].compatible(rank) || !b_shape[0].compatible(adapters) || !alpha_shape[0].compatible(adapters) ||
+            alpha_shape[1] != 1 || !alpha_shape[2].compatible(rank)) {
+            return false;
+        }
+
+        auto find_connected_input = [](ov::Node* child, ov::Node* parent) {
+            for (size_t i = 0; i < child->get_input_size(); ++i) {
+                auto input = child->input(i);
+                if (input.get_source_output().get_node() == parent)
+                    return input;
+            }
+            OPENVINO_THROW("Ops are not connected");
+        };
+
+        // Note: internal_inputs/external_connections order corresponds to LoraSubgraph semantic
+        const std::vector<ov::Input<ov::Node>> internal_inputs{
+            find_connected_input(add.get_node(), main_flow.get_node()),
+            unsqueeze.get_node()->input(0),
+            gathers[0]->input(0),
+            gathers[1]->input(0),
+            gathers[2]->input(0),
+        };
+        const ov::OutputVector external_connections{
+            main_flow,
+            pattern_map.at(lora_input_m),
+            pattern_map.at(pool1_m),
+            pattern_map.at(pool2_m),
+            pattern_map.at(pool3_m),
+            pattern_map.at(indices_m),
+        };
+
+        ov::ParameterVector subgraph_parameters;
+        subgraph_parameters.reserve(external_connections.size());
+        for (auto& in : internal_inputs) {
+            auto new_parameter = std::make_shared<v0::Parameter>(in.get_element_type(), in.get_partial_shape());
+            subgraph_parameters.push_back(new_parameter);
+            in.replace_source_output(new_parameter);
+        }
+        // the same adapter indices are used by all the gathers
+        const auto& indices = pattern_map.at(indices_m);
+        auto indices_parameter =
+            std::make_shared<v0::Parameter>(indices.get_element_type(), indices.get_partial_shape());
+        subgraph_parameters.push_back(indices_parameter);
+        for (const auto& gather : gathers) {
+            gather->input(1).replace_source_output(indices_parameter);
+        }
+
+        const auto& lora_consumers = add.get_target_inputs();
+        const auto lora_subgraph = std::make_shared<ov::Model>(ov::OutputVector{add}, subgraph_parameters);
+        const auto lora_node = std::make_shared<ov::op::internal::LoraSubgraph>(external_connections, lora_subgraph);
+        ov::copy_runtime_info(m.get_matched_nodes(), lora_node);
+        lora_node->set_friendly_name(add_node->get_friendly_name());
+
+        for (const auto& consumer : lora_consumers)
+            consumer.replace_source_output(lora_node->output(0));
+        if (!add.get_names().empty())
+            lora_node->output(0).set_names(add.get_names());
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(add_m, matcher_name);
+    this->register_matcher(m, callback);
+}
+
 }  // namespace ov::pass
@@ -12,9 +12,12 @@
 #include "common_test_utils/ov_test_utils.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/squeeze.hpp"
 #include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
 #include "ov_ops/lora_subgraph.hpp"
 #include "transformations/utils/utils.hpp"
 
@@ -24,6 +27,7 @@ using namespace ov;
 namespace v0 = ov::op::v0;
 namespace v1 = ov::op::v1;
 namespace v6 = ov::op::v6;
+namespace v8 = ov::op::v8;
 namespace op_util = ov::op::util;
 static constexpr auto netType = ov::element::f32;
 
@@ -294,3 +298,124 @@ TEST_F(LoraSubgraphFusionConvolutionTests, StandardPattern) {
         model_ref = std::make_shared<Model>(OutputVector{lora, main_conv}, states.second, ParameterVector{param_lora});
     }
 }
+
+std::shared_ptr<ov::Node> create_multi_adapter_lora_subgraph(const ov::Output<ov::Node>& main_flow,
+                                                             const ov::Output<ov::Node>& lora_input,
+                                                             const ov::OutputVector& pools,
+                                                             const ov::Output<ov::Node>& indices) {
+    OPENVINO_ASSERT(pools.size() == 3, "create_multi_adapter_lora_subgraph expects pools size == 3");
+    auto gather = [&indices](const ov::Output<ov::Node>& pool) {
+        return std::make_shared<v8::Gather>(pool, indices, v0::Constant::create(ov::element::i32, ov::Shape{}, {0}));
+    };
+    auto unsqueeze = std::make_shared<v0::Unsqueeze>(lora_input, v0::Constant::create(ov::element::i32, {1}, {1}));
+    auto mm1 = std::make_shared<v0::MatMul>(unsqueeze, gather(pools[0]), false, true);
+    auto mul = std::make_shared<v1::Multiply>(mm1, gather(pools[1]));
+    auto mm2 = std::make_shared<v0::MatMul>(mul, gather(pools[2]), false, true);
+    auto squeeze = std::make_shared<v0::Squeeze>(mm2, v0::Constant::create(ov::element::i32, {1}, {1}));
+    return std::make_shared<v1::Add>(main_flow, squeeze);
+}
+
+class LoraMultiAdapterSubgraphFusionTests : public TransformationTestsF {
+public:
+    LoraMultiAdapterSubgraphFusionTests() : TransformationTestsF() {
+        comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
+        comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+        comparator.enable(FunctionsComparator::CmpValues::NAMES);
+    }
+
+    void SetUp() override {
+        TransformationTestsF::SetUp();
+        manager.register_pass<ov::pass::LoraMultiAdapterSubgraphFusion>();
+    }
+
+    const ov::Dimension K = 563;
+    const ov::Dimension N = 2048;
+    ov::PartialShape shape_x = {-1, K};
+    ov::PartialShape shape_w = {N, K};
+    ov::PartialShape shape_indices = {-1};
+    ov::PartialShape shape_pool_1 = {-1, -1, K};
+    ov::PartialShape shape_pool_2 = {-1, 1, -1};
+    ov::PartialShape shape_pool_3 = {-1, N, -1};
+};
+
+TEST_F(LoraMultiAdapterSubgraphFusionTests, StandardPattern) {
+    auto create_params = [&]() {
+        return ov::ParameterVector{std::make_shared<v0::Parameter>(netType, shape_x),
+                                   std::make_shared<v0::Parameter>(netType, shape_w),
+                                   std::make_shared<v0::Parameter>(ov::element::i32, shape_indices),
+                                   std::make_shared<v0::Parameter>(netType, shape_pool_1),
+                                   std::make_shared<v0::Parameter>(netType, shape_pool_2),
+                                   std::make_shared<v0::Parameter>(netType, shape_pool_3)};
+    };
+    {
+        auto params = create_params();
+        auto main_mm = std::make_shared<v0::MatMul>(params[0], params[1], false, true);
+        main_mm->set_friendly_name("main_mm");
+        auto lora_subgraph =
+            create_multi_adapter_lora_subgraph(main_mm, params[0], {params[3], params[4], params[5]}, params[2]);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        model = std::make_shared<Model>(OutputVector{lora_subgraph, main_mm}, params);
+    }
+    {
+        auto params = create_params();
+        auto main_mm = std::make_shared<v0::MatMul>(params[0], params[1], false, true);
+        main_mm->set_friendly_name("main_mm");
+
+        auto inner_param_mm = std::make_shared<v0::Parameter>(netType, main_mm->get_output_partial_shape(0));
+        auto inner_param_lora = std::make_shared<v0::Parameter>(netType, shape_x);
+        auto inner_pool_1 = std::make_shared<v0::Parameter>(netType, shape_pool_1);
+        auto inner_pool_2 = std::make_shared<v0::Parameter>(netType, shape_pool_2);
+        auto inner_pool_3 = std::make_shared<v0::Parameter>(netType, shape_pool_3);
+        auto inner_indices = std::make_shared<v0::Parameter>(ov::element::i32, shape_indices);
+        auto lora_subgraph = create_multi_adapter_lora_subgraph(inner_param_mm,
+                                                                inner_param_lora,
+                                                                {inner_pool_1, inner_pool_2, inner_pool_3},
+                                                                inner_indices);
+        lora_subgraph->set_friendly_name("lora_subgraph");
+        ov::ParameterVector inner_params{inner_param_mm,
+                                         inner_param_lora,
+                                         inner_pool_1,
+                                         inner_pool_2,
+                                         inner_pool_3,
+                                         inner_indices};
+        auto inner_model = std::make_shared<Model>(OutputVector{lora_subgraph}, inner_params);
+
+        ov::OutputVector lora_inputs{main_mm, params[0], params[3], params[4], params[5], params[2]};
+        auto lora = std::make_shared<ov::op::internal::LoraSubgraph>(lora_inputs, inner_model);
+        lora->set_friendly_name("lora_subgraph");
+        model_ref = std::make_shared<Model>(OutputVector{lora, main_mm}, params);
+    }
+}
+
+TEST_F(LoraMultiAdapterSubgraphFusionTests, NotFusedWithNotTransposedPools) {
+    auto params = ov::ParameterVector{std::make_shared<v0::Parameter>(netType, shape_x),
+                                      std::make_shared<v0::Parameter>(netType, shape_w),
+                                      std::make_shared<v0::Parameter>(ov::element::i32, shape_indices),
+                                      std::make_shared<v0::Parameter>(netType, ov::PartialShape{-1, K, -1}),
+                                      std::make_shared<v0::Parameter>(netType, shape_pool_2),
+                                      std::make_shared<v0::Parameter>(netType, shape_pool_3)};
+    auto main_mm = std::make_shared<v0::MatMul>(params[0], params[1], false, true);
+    auto gather = [&](const ov::Output<ov::Node>& pool) {
+        return std::make_shared<v8::Gather>(pool, params[2], v0::Constant::create(ov::element::i32, ov::Shape{}, {0}));
+    };
+    auto unsqueeze = std::make_shared<v0::Unsqueeze>(params[0], v0::Constant::create(ov::element::i32, {1}, {1}));
+    auto mm1 = std::make_shared<v0::MatMul>(unsqueeze, gather(params[3]), false, false);
+    auto mul = std::make_shared<v1::Multiply>(mm1, gather(params[4]));
+    auto mm2 = std::make_shared<v0::MatMul>(mul, gather(params[5]), false, true);
+    auto squeeze = std::make_shared<v0::Squeeze>(mm2, v0::Constant::create(ov::element::i32, {1}, {1}));
+    auto add = std::make_shared<v1::Add>(main_mm, squeeze);
+    model = std::make_shared<Model>(OutputVector{add}, params);
+}
+
+TEST_F(LoraMultiAdapterSubgraphFusionTests, NotFusedWithBroadcastAlpha) {
+    auto params = ov::ParameterVector{std::make_shared<v0::Parameter>(netType, shape_x),
+                                      std::make_shared<v0::Parameter>(netType, shape_w),
+                                      std::make_shared<v0::Parameter>(ov::element::i32, shape_indices),
+                                      std::make_shared<v0::Parameter>(netType, ov::PartialShape{-1, 8, K}),
+                                      std::make_shared<v0::Parameter>(netType, ov::PartialShape{-1, 1, 1}),
+                                      std::make_shared<v0::Parameter>(netType, ov::PartialShape{-1, N, 8})};
+    auto main_mm = std::make_shared<v0::MatMul>(params[0], params[1], false, true);
+    auto lora_subgraph =
+        create_multi_adapter_lora_subgraph(main_mm, params[0], {params[3], params[4], params[5]}, params[2]);
+    model = std::make_shared<Model>(OutputVector{lora_subgraph}, params);
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+#include "openvino/core/core_visibility.hpp"
+#include "openvino/core/model.hpp"
+
+namespace ov::util {
+
+/**
+ * @brief Computes the structural hash of the model without serializing it.
+ *
+ * The graph is walked in the topological order and the hash covers the type, version and attributes (visited by
+ * AttributeVisitor) of every operation, the element types, shapes and tensor names of its outputs, the producers of its
+ * inputs, the deterministic runtime attributes and the order of the model parameters, results and sinks. Friendly names
+ * are not hashed, as for the deterministic IR serialization.
+ *
+ * The data of a Constant is hashed once by Constant::get_data_hash and the value is reused by the following calls, so
+ * hashing the same model again is linear in the number of operations.
+ *
+ * @param model         Model to hash.
+ * @param skip_weights  If true, only the sizes of the Constants data are hashed.
+ * @return Hash value of the model.
+ */
+OPENVINO_API uint64_t compute_model_hash(const Model& model, bool skip_weights = false);
+
+}  // namespace ov::util
@@ -4,8 +4,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 
 #include "openvino/core/attribute_adapter.hpp"
 #include "openvino/core/core_visibility.hpp"
@@ -41,10 +44,12 @@ public:
     }
     void* get_ptr(size_t offset) const {
         hint_prefetch();
+        update_generation();
         return m_aligned_buffer + offset;
     }
     void* get_ptr() {
         hint_prefetch();
+        update_generation();
         return m_aligned_buffer;
     }
     const void* get_ptr() const {
@@ -54,6 +59,7 @@ public:
     template <typename T>
     T* get_ptr() {
         hint_prefetch();
+        update_generation();
         return reinterpret_cast<T*>(m_aligned_buffer);
     }
     template <typename T>
@@ -77,6 +83,12 @@ public:
     /// \brief Ensures the buffer is available and populated with actual data.
     virtual void hint_prefetch() const;
 
+    /// \brief Returns the hash of the first \p byte_size bytes of the buffer data computed by \p compute_hash.
+    ///
+    /// The hash is kept by the buffer, so all its owners share it, until the data is accessed for writing, i.e. by
+    /// the non-const get_ptr. The data written through a pointer obtained before the hash was computed is not noticed.
+    uint64_t get_hash(size_t byte_size, const std::function<uint64_t()>& compute_hash) const;
+
 protected:
     virtual void hint_evict(size_t offset, size_t size) noexcept;
     static void invoke_evict(AlignedBuffer& buffer, size_t offset, size_t size) noexcept;
@@ -85,6 +97,19 @@ protected:
 
     char* m_aligned_buffer;
     size_t m_byte_size;
+
+private:
+    void update_generation() const noexcept {
+        m_generation.fetch_add(1);
+    }
+
+    // incremented on each access to the data for writing
+    mutable std::atomic<uint64_t> m_generation{0};
+    mutable std::mutex m_hash_mutex;
+    mutable uint64_t m_hash{0};
+    mutable size_t m_hash_byte_size{0};
+    // m_generation + 1 at the time the hash was computed, 0 if there is no hash
+    mutable uint64_t m_hash_generation{0};
 };
 
 template <>
@@ -7,6 +7,7 @@
 #include <iostream>
 #include <map>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "openvino/core/attribute_visitor.hpp"
@@ -21,9 +22,32 @@ public:
     using HashValue = size_t;
     using ConstWritePositions = std::multimap<HashValue, std::pair<FilePosition, const void*>>;
 
+    /// @brief Data of a Constant which will be passed to write() later.
+    struct ConstantData {
+        const char* ptr;
+        size_t size;
+        bool compress_to_fp16;
+        ov::element::Type src_type;
+    };
+
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true);
+    /// @brief Copies the writer state, the data prepared for the writes of the other writer is not copied.
+    ConstantWriter(const ConstantWriter& other);
+    ConstantWriter& operator=(const ConstantWriter&) = delete;
     virtual ~ConstantWriter();
 
+    /**
+     * @brief Hashes and compresses to FP16 the data of the Constants in parallel before they are written.
+     *
+     * The results are consumed by the following write() calls with the same data, which only deduplicate and write
+     * them in the order of the calls, so the output is the same as without the preparation. The compressed data is
+     * kept up to a memory limit, the data above it is compressed again on write.
+     * The writers which don't write the data with ConstantWriter::write() should override it with a no-op.
+     *
+     * @param constants  Data of the Constants, the pointers must stay valid until they are written.
+     */
+    virtual void prepare(const std::vector<ConstantData>& constants);
+
     virtual FilePosition write(const char* ptr,
                                size_t size,
                                size_t& new_size,
@@ -38,12 +62,26 @@ public:
     }
 
 private:
+    struct PreparedData {
+        size_t size;
+        bool compress_to_fp16;
+        ov::element::Type src_type;
+        HashValue hash;
+        size_t new_size;
+        // empty if the data is not compressed or the memory limit is reached
+        std::vector<char> fp16_data;
+    };
+
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
                                                          const element::Type& src_type,
                                                          size_t& compressed_size);
 
+    // dst must have the space for size / src_type.size() FP16 values
+    static void compress_data_to_fp16(const char* ptr, size_t size, const element::Type& src_type, char* dst);
+
     ConstWritePositions m_hash_to_file_positions;
+    std::unordered_map<const void*, PreparedData> m_prepared;
     std::vector<std::vector<char>> m_packed_string_data;
     std::reference_wrapper<std::ostream> m_binary_output;
     bool m_enable_compression;
@@ -275,6 +275,12 @@ public:
 
     bool get_all_data_elements_bitwise_identical() const;
 
+    /// \brief Returns the hash of the Constant's data.
+    ///
+    /// The hash is computed on the first call and kept by the data buffer, so the data of a model compiled again is
+    /// not read. It is reset when the data is accessed for writing, e.g. by get_data_ptr_nc or fill_data.
+    uint64_t get_data_hash() const;
+
     std::string convert_value_to_string(size_t index) const;
 
     /**
@@ -0,0 +1,362 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/model_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/attribute_adapter.hpp"
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/meta_data.hpp"
+#include "openvino/core/runtime_attribute.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/op_types.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+#include "openvino/runtime/compute_hash.hpp"
+#include "openvino/runtime/string_aligned_buffer.hpp"
+#include "openvino/util/hash_util.hpp"
+#include "transformations/rt_info/disable_precision_conversion.hpp"
+
+namespace ov::util {
+namespace {
+
+// Separates the sections of the hashed model, so values of neighbouring sections can't be confused
+enum class Tag : uint64_t { node, inputs, outputs, attributes, rt_info, parameters, results, sinks, model_rt_info };
+
+uint64_t combine(uint64_t seed, uint64_t value) {
+    return u64_hash_combine(seed, value);
+}
+
+uint64_t combine(uint64_t seed, Tag tag) {
+    return u64_hash_combine(seed, static_cast<uint64_t>(tag));
+}
+
+// std::hash is not stable between runs and standard libraries, the hashes are stored in the cache directory
+uint64_t combine(uint64_t seed, std::string_view value) {
+    return u64_hash_combine(seed, runtime::compute_hash(value.data(), value.size()));
+}
+
+uint64_t combine(uint64_t seed, double value) {
+    uint64_t bits = 0;
+    static_assert(sizeof(bits) == sizeof(value));
+    std::memcpy(&bits, &value, sizeof(bits));
+    return u64_hash_combine(seed, bits);
+}
+
+uint64_t combine(uint64_t seed, float value) {
+    return combine(seed, static_cast<double>(value));
+}
+
+template <class T, typename std::enable_if_t<std::is_integral_v<T>, bool> = true>
+uint64_t combine(uint64_t seed, T value) {
+    return u64_hash_combine(seed, static_cast<uint64_t>(value));
+}
+
+uint64_t combine_dimension(uint64_t seed, const Dimension& dim) {
+    seed = combine(seed, static_cast<uint64_t>(dim.get_min_length()));
+    return combine(seed, static_cast<uint64_t>(dim.get_max_length()));
+}
+
+uint64_t combine_shape(uint64_t seed, const PartialShape& shape) {
+    if (shape.rank().is_dynamic()) {
+        return combine(seed, static_cast<uint64_t>(-1));
+    }
+    seed = combine(seed, static_cast<uint64_t>(shape.size()));
+    for (const auto& dim : shape) {
+        seed = combine_dimension(seed, dim);
+    }
+    return seed;
+}
+
+std::string_view get_opset_name(const Node& node) {
+    const auto& rt_info = node.get_rt_info();
+    if (auto opset_it = rt_info.find("opset"); opset_it != rt_info.end() && opset_it->second.is<std::string>()) {
+        return opset_it->second.as<std::string>();
+    }
+    const auto version_id = node.get_type_info().version_id;
+    return version_id == nullptr ? "experimental" : version_id;
+}
+
+uint64_t hash_model_rt_info(uint64_t seed, const std::string& name, const Any& data) {
+    seed = combine(seed, name);
+    if (data.is<std::shared_ptr<Meta>>()) {
+        const AnyMap& map = *data.as<std::shared_ptr<Meta>>();
+        for (const auto& [key, value] : map) {
+            seed = hash_model_rt_info(seed, key, value);
+        }
+    } else if (data.is<AnyMap>()) {
+        for (const auto& [key, value] : data.as<AnyMap>()) {
+            seed = hash_model_rt_info(seed, key, value);
+        }
+    } else {
+        seed = combine(seed, data.as<std::string>());
+    }
+    return seed;
+}
+
+class ModelHasher {
+public:
+    explicit ModelHasher(bool skip_weights) : m_skip_weights(skip_weights) {}
+
+    uint64_t hash(uint64_t seed, const Model& model) const;
+
+    uint64_t hash_rt_info(uint64_t seed, RTMap& rt_info) const;
+
+private:
+    uint64_t hash_node(uint64_t seed, Node& node, const std::unordered_map<const Node*, uint64_t>& ids) const;
+    uint64_t hash_constant(uint64_t seed, const op::v0::Constant& constant) const;
+
+    bool m_skip_weights;
+};
+
+class AttributeHasher : public AttributeVisitor {
+public:
+    AttributeHasher(uint64_t& hash, const ModelHasher& model_hasher) : m_hash(hash), m_model_hasher(model_hasher) {}
+
+    void on_adapter(const std::string& name, ValueAccessor<void>& adapter) override {
+        using InputDescriptions = std::vector<std::shared_ptr<op::util::MultiSubGraphOp::InputDescription>>;
+        using OutputDescriptions = std::vector<std::shared_ptr<op::util::MultiSubGraphOp::OutputDescription>>;
+
+        m_hash = combine(m_hash, name);
+        if (const auto& a = as_type<AttributeAdapter<std::shared_ptr<op::util::Variable>>>(&adapter)) {
+            const auto& info = a->get()->get_info();
+            m_hash = combine(combine_shape(combine(m_hash, info.variable_id), info.data_shape), info.data_type.hash());
+        } else if (const auto& a = as_type<AttributeAdapter<InputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_hash = combine(m_hash, desc->get_type_info().name);
+                m_hash = combine(combine(m_hash, desc->m_input_index), desc->m_body_parameter_index);
+                using namespace op::util;
+                if (const auto& slice = as_type_ptr<MultiSubGraphOp::SliceInputDescription>(desc)) {
+                    for (auto v : {slice->m_start, slice->m_stride, slice->m_part_size, slice->m_end, slice->m_axis}) {
+                        m_hash = combine(m_hash, static_cast<uint64_t>(v));
+                    }
+                } else if (const auto& merged = as_type_ptr<MultiSubGraphOp::MergedInputDescription>(desc)) {
+                    m_hash = combine(m_hash, merged->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = as_type<AttributeAdapter<OutputDescriptions>>(&adapter)) {
+            for (const auto& desc : a->get()) {
+                m_hash = combine(m_hash, desc->get_type_info().name);
+                m_hash = combine(combine(m_hash, desc->m_body_value_index), desc->m_output_index);
+                using namespace op::util;
+                if (const auto& concat = as_type_ptr<MultiSubGraphOp::ConcatOutputDescription>(desc)) {
+                    for (auto v :
+                         {concat->m_start, concat->m_stride, concat->m_part_size, concat->m_end, concat->m_axis}) {
+                        m_hash = combine(m_hash, static_cast<uint64_t>(v));
+                    }
+                } else if (const auto& body = as_type_ptr<MultiSubGraphOp::BodyOutputDescription>(desc)) {
+                    m_hash = combine(m_hash, static_cast<uint64_t>(body->m_iteration));
+                }
+            }
+        } else if (const auto& a = as_type<AttributeAdapter<op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            const auto& ports = a->get();
+            m_hash = combine(m_hash, static_cast<uint64_t>(ports.current_iteration_input_idx));
+            m_hash = combine(m_hash, static_cast<uint64_t>(ports.body_condition_output_idx));
+        } else if (const auto& a = as_type<AttributeAdapter<op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            m_hash = combine(combine(m_hash, attrs.get_type_name()), attrs.get_opset_name());
+            // the attributes are unordered
+            const std::map<std::string, std::string> sorted_attrs(attrs.begin(), attrs.end());
+            for (const auto& [attr_name, attr_value] : sorted_attrs) {
+                m_hash = combine(combine(m_hash, attr_name), attr_value);
+            }
+        } else if (const auto& a = as_type<AttributeAdapter<std::set<std::string>>>(&adapter)) {
+            for (const auto& value : a->get()) {
+                m_hash = combine(m_hash, value);
+            }
+        } else if (const auto& a = as_type<AttributeAdapter<element::TypeVector>>(&adapter)) {
+            for (const auto& type : a->get()) {
+                m_hash = combine(m_hash, type.hash());
+            }
+        } else if (const auto& a = as_type<AttributeAdapter<PartialShape>>(&adapter)) {
+            m_hash = combine_shape(m_hash, a->get());
+        } else if (const auto& a = as_type<AttributeAdapter<Dimension>>(&adapter)) {
+            m_hash = combine_dimension(m_hash, a->get());
+        } else if (const auto& a = as_type<AttributeAdapter<std::shared_ptr<AlignedBuffer>>>(&adapter)) {
+            // data of Constants is hashed by ModelHasher, buffers of other operations are not serialized either
+            m_hash = combine(m_hash, a->get() ? a->get()->size() : 0);
+        } else if (!is_type<AttributeAdapter<std::shared_ptr<StringAlignedBuffer>>>(&adapter) &&
+                   !is_type<AttributeAdapter<std::shared_ptr<SharedStringAlignedBuffer>>>(&adapter)) {
+            OPENVINO_THROW("Unsupported attribute type for model hash computation: ", name);
+        }
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<bool>& adapter) override {
+        m_hash = combine(combine(m_hash, name), static_cast<uint64_t>(adapter.get()));
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<std::string>& adapter) override {
+        m_hash = combine(combine(m_hash, name), adapter.get());
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<int64_t>& adapter) override {
+        m_hash = combine(combine(m_hash, name), static_cast<uint64_t>(adapter.get()));
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<double>& adapter) override {
+        m_hash = combine(combine(m_hash, name), adapter.get());
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<float>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<std::string>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+
+    void on_adapter(const std::string& name, ValueAccessor<std::shared_ptr<Model>>& adapter) override {
+        m_hash = m_model_hasher.hash(combine(m_hash, name), *adapter.get());
+    }
+
+private:
+    template <class T>
+    void hash_vector(const std::string& name, const std::vector<T>& values) {
+        m_hash = combine(combine(m_hash, name), static_cast<uint64_t>(values.size()));
+        for (const auto& value : values) {
+            m_hash = combine(m_hash, value);
+        }
+    }
+
+    uint64_t& m_hash;
+    const ModelHasher& m_model_hasher;
+};
+
+uint64_t ModelHasher::hash(uint64_t seed, const Model& model) const {
+    const auto ordered_ops = model.get_ordered_ops();
+    std::unordered_map<const Node*, uint64_t> ids;
+    ids.reserve(ordered_ops.size());
+    for (const auto& node : ordered_ops) {
+        ids.emplace(node.get(), ids.size());
+    }
+
+    for (const auto& node : ordered_ops) {
+        seed = hash_node(seed, *node, ids);
+    }
+
+    // the topological order does not keep the order of the model inputs and outputs
+    seed = combine(seed, Tag::parameters);
+    for (const auto& parameter : model.get_parameters()) {
+        seed = combine(seed, ids.at(parameter.get()));
+    }
+    seed = combine(seed, Tag::results);
+    for (const auto& result : model.get_results()) {
+        seed = combine(seed, ids.at(result.get()));
+    }
+    seed = combine(seed, Tag::sinks);
+    for (const auto& sink : model.get_sinks()) {
+        seed = combine(seed, ids.at(sink.get()));
+    }
+
+    seed = combine(seed, Tag::model_rt_info);
+    for (const auto& [name, data] : model.get_rt_info()) {
+        // the same as for the IR serialization
+        if (name != "version" && name != "__weights_path") {
+            seed = hash_model_rt_info(seed, name, data);
+        }
+    }
+    return seed;
+}
+
+uint64_t ModelHasher::hash_rt_info(uint64_t seed, RTMap& rt_info) const {
+    seed = combine(seed, Tag::rt_info);
+    for (auto& [name, attribute] : rt_info) {
+        if (attribute.is<RuntimeAttribute>()) {
+            auto& rt_attribute = attribute.as<RuntimeAttribute>();
+            if (rt_attribute.is_deterministic()) {
+                const auto& type_info = rt_attribute.get_type_info();
+                seed = combine(combine(seed, type_info.name), type_info.get_version());
+                AttributeHasher visitor(seed, *this);
+                rt_attribute.visit_attributes(visitor);
+            }
+        }
+    }
+    return seed;
+}
+
+uint64_t ModelHasher::hash_node(uint64_t seed,
+                                Node& node,
+                                const std::unordered_map<const Node*, uint64_t>& ids) const {
+    seed = combine(seed, Tag::node);
+    seed = combine(combine(seed, node.get_type_info().name), get_opset_name(node));
+
+    seed = combine(combine(seed, Tag::inputs), static_cast<uint64_t>(node.get_input_size()));
+    for (auto& input : node.inputs()) {
+        const auto source = input.get_source_output();
+        seed = combine(combine(seed, ids.at(source.get_node())), static_cast<uint64_t>(source.get_index()));
+        seed = hash_rt_info(seed, input.get_rt_info());
+    }
+
+    // the output of Result is the model output, its names are optional as for the IR serialization
+    if (!op::util::is_output(&node)) {
+        seed = combine(combine(seed, Tag::outputs), static_cast<uint64_t>(node.get_output_size()));
+        for (auto& output : node.outputs()) {
+            const auto& tensor = output.get_tensor();
+            const auto element_type =
+                is_fp16_compression_postponed(tensor.get_rt_info()) ? element::f16 : output.get_element_type();
+            seed = combine_shape(combine(seed, element_type.hash()), output.get_partial_shape());
+
+            const auto& names = tensor.get_names();
+            const std::set<std::string> sorted_names(names.begin(), names.end());
+            for (const auto& name : sorted_names) {
+                seed = combine(seed, name);
+            }
+            seed = hash_rt_info(seed, output.get_rt_info());
+        }
+    }
+
+    seed = combine(seed, Tag::attributes);
+    if (const auto constant = as_type<const op::v0::Constant>(&node)) {
+        seed = hash_constant(seed, *constant);
+    } else {
+        AttributeHasher visitor(seed, *this);
+        OPENVINO_ASSERT(node.visit_attributes(visitor), "Visitor API is not supported in ", node);
+    }
+    return hash_rt_info(seed, node.get_rt_info());
+}
+
+uint64_t ModelHasher::hash_constant(uint64_t seed, const op::v0::Constant& constant) const {
+    // Constant::visit_attributes is not used, the data hash is kept by the Constant data buffer
+    seed = combine(seed, constant.get_element_type().hash());
+    seed = combine_shape(seed, constant.get_shape());
+    seed = combine(seed, static_cast<uint64_t>(is_fp16_compression_postponed(constant.get_rt_info())));
+    if (m_skip_weights) {
+        return combine(seed, static_cast<uint64_t>(constant.get_byte_size()));
+    } else {
+        return combine(seed, constant.get_data_hash());
+    }
+}
+
+}  // namespace
+
+uint64_t compute_model_hash(const Model& model, bool skip_weights) {
+    return ModelHasher(skip_weights).hash(0, model);
+}
+
+}  // namespace ov::util
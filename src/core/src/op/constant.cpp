@@ -8,6 +8,7 @@
 #include <cstdio>
 #include <cstring>
 #include <sstream>
+#include <utility>
 
 #include "compare.hpp"
 #include "element_visitor.hpp"
@@ -21,9 +22,11 @@
 #include "openvino/core/weight_sharing_util.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/reference/utils/type_util.hpp"
+#include "openvino/runtime/compute_hash.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/string_aligned_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "openvino/util/hash_util.hpp"
 #include "openvino/util/variant_visitor.hpp"
 
 namespace ov::op {
@@ -423,7 +426,7 @@ size_t Constant::get_byte_size() const {
 }
 
 const void* Constant::get_data_ptr() const {
-    return (m_data ? m_data->get_ptr() : nullptr);
+    return (m_data ? std::as_const(*m_data).get_ptr() : nullptr);
 }
 
 void* Constant::get_data_ptr_nc() {
@@ -605,6 +608,25 @@ bool Constant::get_all_data_elements_bitwise_identical() const {
     return m_all_elements_bitwise_identical;
 }
 
+uint64_t Constant::get_data_hash() const {
+    const auto byte_size = get_byte_size();
+    if (byte_size == 0) {
+        return 0;
+    }
+    // the hash is kept by the data buffer, so it is shared by the copies of the Constant
+    return m_data->get_hash(byte_size, [&] {
+        if (m_element_type != element::string) {
+            return runtime::compute_hash(get_data_ptr(), byte_size);
+        }
+        uint64_t hash = 0;
+        const auto strings = get_data_ptr<std::string>();
+        for (size_t i = 0; i < shape_size(m_shape); ++i) {
+            hash = ov::util::u64_hash_combine(hash, runtime::compute_hash(strings[i].data(), strings[i].size()));
+        }
+        return hash;
+    });
+}
+
 void Constant::alloc_buffer_on_visit_attributes(bool val) {
     m_alloc_buffer_on_visit_attributes = val;
 }
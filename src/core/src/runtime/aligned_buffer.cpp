@@ -21,7 +21,9 @@ AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment) : m_byte_size(s
 
 AlignedBuffer::AlignedBuffer(AlignedBuffer&& other)
     : m_aligned_buffer(std::exchange(other.m_aligned_buffer, nullptr)),
-      m_byte_size(std::exchange(other.m_byte_size, 0)) {}
+      m_byte_size(std::exchange(other.m_byte_size, 0)) {
+    other.update_generation();
+}
 
 AlignedBuffer::~AlignedBuffer() {
     util::aligned_free(m_aligned_buffer);  // safe with nullptr
@@ -32,6 +34,8 @@ AlignedBuffer& AlignedBuffer::operator=(AlignedBuffer&& other) {
         util::aligned_free(m_aligned_buffer);
         m_aligned_buffer = std::exchange(other.m_aligned_buffer, nullptr);
         m_byte_size = std::exchange(other.m_byte_size, 0);
+        update_generation();
+        other.update_generation();
     }
     return *this;
 }
@@ -58,4 +62,23 @@ void AlignedBuffer::hint_prefetch() const {}
 void AlignedBuffer::invoke_hint_prefetch(const AlignedBuffer& buffer) {
     buffer.hint_prefetch();
 }
+
+uint64_t AlignedBuffer::get_hash(size_t byte_size, const std::function<uint64_t()>& compute_hash) const {
+    const auto generation = m_generation.load();
+    {
+        std::lock_guard<std::mutex> lock(m_hash_mutex);
+        if (m_hash_generation == generation + 1 && m_hash_byte_size == byte_size) {
+            return m_hash;
+        }
+    }
+    const auto hash = compute_hash();
+    std::lock_guard<std::mutex> lock(m_hash_mutex);
+    // the hash is not kept if the data were accessed for writing while it was computed
+    if (m_generation.load() == generation) {
+        m_hash = hash;
+        m_hash_byte_size = byte_size;
+        m_hash_generation = generation + 1;
+    }
+    return hash;
+}
 }  // namespace ov
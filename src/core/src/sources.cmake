@@ -27,6 +27,7 @@ set(LIBRARY_SRC
     ${CMAKE_CURRENT_LIST_DIR}/log_util.cpp
     ${CMAKE_CURRENT_LIST_DIR}/memory_util.cpp
     ${CMAKE_CURRENT_LIST_DIR}/model.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/model_hash.cpp
     ${CMAKE_CURRENT_LIST_DIR}/node.cpp
     ${CMAKE_CURRENT_LIST_DIR}/node_input.cpp
     ${CMAKE_CURRENT_LIST_DIR}/node_output.cpp
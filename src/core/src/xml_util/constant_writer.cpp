@@ -5,12 +5,18 @@
 #include "openvino/xml_util/constant_writer.hpp"
 
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/runtime/compute_hash.hpp"
 #include "openvino/util/hash_util.hpp"
 
 namespace ov::util {
 
+namespace {
+// Limit of the FP16 data compressed by ConstantWriter::prepare and kept until it is written
+constexpr size_t max_prepared_fp16_size = size_t{1} << 30;
+}  // namespace
+
 ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression)
     : m_hash_to_file_positions{},
       m_binary_output(bin_data),
@@ -18,8 +24,66 @@ ConstantWriter::ConstantWriter(std::ostream& bin_data, bool enable_compression)
       m_blob_offset(bin_data.tellp()),
       m_data_hash{} {}
 
+ConstantWriter::ConstantWriter(const ConstantWriter& other)
+    : m_hash_to_file_positions{other.m_hash_to_file_positions},
+      m_packed_string_data{other.m_packed_string_data},
+      m_binary_output{other.m_binary_output},
+      m_enable_compression{other.m_enable_compression},
+      m_blob_offset{other.m_blob_offset},
+      m_data_hash{other.m_data_hash} {}
+
 ConstantWriter::~ConstantWriter() = default;
 
+void ConstantWriter::prepare(const std::vector<ConstantData>& constants) {
+    // only the data hash is reused, the sizes are enough when the deduplication is disabled
+    if (!m_enable_compression) {
+        return;
+    }
+    std::vector<std::pair<const ConstantData*, PreparedData*>> to_prepare;
+    size_t fp16_size = 0;
+    for (const auto& constant : constants) {
+        const bool supported_fp16_type =
+            (constant.src_type == ov::element::f32 || constant.src_type == ov::element::f64) &&
+            constant.size % constant.src_type.size() == 0;
+        if (constant.size == 0 || (constant.compress_to_fp16 && !supported_fp16_type) ||
+            m_prepared.count(constant.ptr) != 0) {
+            continue;
+        }
+        auto& prepared = m_prepared[constant.ptr];
+        prepared.size = constant.size;
+        prepared.compress_to_fp16 = constant.compress_to_fp16;
+        prepared.src_type = constant.src_type;
+        prepared.new_size = constant.size;
+        if (constant.compress_to_fp16) {
+            prepared.new_size = constant.size / constant.src_type.size() * sizeof(ov::float16);
+            // the data above the limit is compressed again on write, the limit is applied in the order of the
+            // constants so the kept data does not depend on the threads
+            if (fp16_size + prepared.new_size <= max_prepared_fp16_size) {
+                fp16_size += prepared.new_size;
+                prepared.fp16_data.resize(prepared.new_size);
+            }
+        }
+        to_prepare.emplace_back(&constant, &prepared);
+    }
+
+    ov::parallel_for(to_prepare.size(), [&](size_t i) {
+        const auto& constant = *to_prepare[i].first;
+        auto& prepared = *to_prepare[i].second;
+        if (!constant.compress_to_fp16) {
+            prepared.hash = ov::runtime::compute_hash(constant.ptr, constant.size);
+            return;
+        }
+        if (!prepared.fp16_data.empty()) {
+            compress_data_to_fp16(constant.ptr, constant.size, constant.src_type, prepared.fp16_data.data());
+            prepared.hash = ov::runtime::compute_hash(prepared.fp16_data.data(), prepared.new_size);
+            return;
+        }
+        size_t compressed_size = 0;
+        const auto fp16_data = compress_data_to_fp16(constant.ptr, constant.size, constant.src_type, compressed_size);
+        prepared.hash = ov::runtime::compute_hash(fp16_data.get(), compressed_size);
+    });
+}
+
 ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
                                                    size_t size,
                                                    size_t& new_size,
@@ -30,20 +94,39 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
     const auto offset = write_pos - m_blob_offset;
     new_size = size;
 
-    const auto fp16_data = compress_to_fp16 ? compress_data_to_fp16(ptr, size, src_type, new_size) : nullptr;
-    const auto data_ptr = compress_to_fp16 ? fp16_data.get() : ptr;
+    // the hash and the compressed data may be computed by prepare()
+    PreparedData* prepared = nullptr;
+    if (const auto it = m_prepared.find(ptr); it != m_prepared.end() && it->second.size == size &&
+                                              it->second.compress_to_fp16 == compress_to_fp16 &&
+                                              (!compress_to_fp16 || it->second.src_type == src_type)) {
+        prepared = &it->second;
+    }
+    std::unique_ptr<char[]> fp16_data;
+    const char* data_ptr = ptr;
+    if (compress_to_fp16) {
+        if (prepared && !prepared->fp16_data.empty()) {
+            data_ptr = prepared->fp16_data.data();
+            new_size = prepared->new_size;
+        } else {
+            fp16_data = compress_data_to_fp16(ptr, size, src_type, new_size);
+            data_ptr = fp16_data.get();
+        }
+    }
 
     if (m_enable_compression) {
         // This hash is weak (but efficient). For example current hash algorithms gives
         // the same hash for {2, 2} and {0, 128} arrays.
         // But even strong hashing algorithms sometimes give collisions.
         // Therefore we always have to compare values when finding a match in the hash multimap.
-        const HashValue hash = ov::runtime::compute_hash(data_ptr, new_size);
+        const HashValue hash = prepared ? prepared->hash : ov::runtime::compute_hash(data_ptr, new_size);
 
         const auto found = m_hash_to_file_positions.equal_range(hash);
         // iterate over all matches of the key in the multimap
         for (auto it = found.first; it != found.second; ++it) {
             if (memcmp(ptr, it->second.second, size) == 0) {
+                if (prepared) {
+                    prepared->fp16_data = std::vector<char>();
+                }
                 return it->second.first;
             }
         }
@@ -58,6 +141,10 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
         m_data_hash = util::u64_hash_combine(m_data_hash, new_size);
     }
     m_binary_output.get().write(data_ptr, new_size);
+    if (prepared) {
+        // the hash is kept for the next writes of the same data
+        prepared->fp16_data = std::vector<char>();
+    }
     return offset;
 }
 
@@ -109,15 +196,19 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
     OPENVINO_ASSERT(num_src_elements * src_type.size() == size);
     using T = fundamental_type_for<ov::element::Type_t::f16>;
     compressed_size = num_src_elements * sizeof(T);
+    auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
+    compress_data_to_fp16(ptr, size, src_type, new_ptr.get());
+    return new_ptr;
+}
+
+void ConstantWriter::compress_data_to_fp16(const char* ptr, size_t size, const element::Type& src_type, char* dst) {
+    auto num_src_elements = size / src_type.size();
+    OPENVINO_ASSERT(num_src_elements * src_type.size() == size);
+    auto dst_data = reinterpret_cast<ov::float16*>(dst);
     if (src_type == ov::element::f32) {
-        auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
-        auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
         auto src_data = reinterpret_cast<const float*>(ptr);
         ov::reference::convert_from_f32_to_f16_with_clamp(src_data, dst_data, num_src_elements);
-        return new_ptr;
     } else if (src_type == ov::element::f64) {
-        auto new_ptr = std::unique_ptr<char[]>(new char[compressed_size]);
-        auto dst_data = reinterpret_cast<ov::float16*>(new_ptr.get());
         auto src_data = reinterpret_cast<const double*>(ptr);
 
         // Reference implementation for fp64 to fp16 conversion
@@ -133,7 +224,6 @@ std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
                 dst_data[i] = static_cast<ov::float16>(src_data[i]);
             }
         }
-        return new_ptr;
     } else {
         OPENVINO_THROW("[ INTERNAL ERROR ] Not supported source type for weights compression: ", src_type);
     }
@@ -972,6 +972,24 @@ void XmlSerializer::serialize(pugi::xml_node& net_xml, const ov::Model& model) {
 
     find_postponed_constants_and_exclude_nodes(sorted_ops, postponed_constants, nodes_to_exclude);
 
+    // the constants data is hashed and compressed in parallel, the writes below keep the order of the layers
+    {
+        std::vector<util::ConstantWriter::ConstantData> constants;
+        for (const auto& node : sorted_ops) {
+            const auto constant = ov::as_type<ov::op::v0::Constant>(node.get());
+            if (!constant || constant->get_element_type() == ov::element::string ||
+                nodes_to_exclude.count(constant) || postponed_constants.count(constant)) {
+                continue;
+            }
+            const bool compress_to_fp16 = is_fp16_compression_postponed(constant->get_rt_info());
+            constants.push_back({static_cast<const char*>(constant->get_data_ptr()),
+                                 constant->get_byte_size(),
+                                 compress_to_fp16,
+                                 compress_to_fp16 ? constant->get_output_element_type(0) : ov::element::dynamic});
+        }
+        get_constant_write_handler().prepare(constants);
+    }
+
     for (const auto& n : sorted_ops) {
         ov::Node* node = n.get();
 
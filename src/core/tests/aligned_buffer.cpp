@@ -4,6 +4,9 @@
 
 #include "openvino/runtime/aligned_buffer.hpp"
 
+#include <tuple>
+#include <utility>
+
 #include "gtest/gtest.h"
 
 namespace ov::test {
@@ -34,4 +37,26 @@ TEST(aligned_buffer, move) {
         EXPECT_NE(buffer2.get_ptr(), nullptr);
     }
 }
+
+TEST(aligned_buffer, hash_is_kept_until_data_is_written) {
+    AlignedBuffer buffer(4, 64);
+    size_t computed = 0;
+    const auto compute_hash = [&] {
+        ++computed;
+        return uint64_t{42} + computed;
+    };
+
+    const auto hash = buffer.get_hash(4, compute_hash);
+    EXPECT_EQ(std::as_const(buffer).get_hash(4, compute_hash), hash);
+    std::ignore = std::as_const(buffer).get_ptr();
+    EXPECT_EQ(buffer.get_hash(4, compute_hash), hash);
+    EXPECT_EQ(computed, 1);
+
+    std::ignore = buffer.get_hash(2, compute_hash);
+    EXPECT_EQ(computed, 2);
+
+    std::ignore = buffer.get_ptr();
+    EXPECT_NE(buffer.get_hash(2, compute_hash), hash);
+    EXPECT_EQ(computed, 3);
+}
 }  // namespace ov::test
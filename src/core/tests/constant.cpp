@@ -2799,6 +2799,51 @@ TEST(constant, create_with_zero_dim_shape) {
     EXPECT_EQ(c.get_byte_size(), 0);
 }
 
+TEST(constant, data_hash) {
+    const auto c1 = op::v0::Constant::create(element::i32, Shape{3}, {1, 2, 3});
+    const auto c2 = op::v0::Constant::create(element::i32, Shape{3}, {1, 2, 3});
+    const auto c3 = op::v0::Constant::create(element::i32, Shape{3}, {1, 2, 4});
+
+    EXPECT_EQ(c1->get_data_hash(), c2->get_data_hash());
+    EXPECT_NE(c1->get_data_hash(), c3->get_data_hash());
+    EXPECT_EQ(op::v0::Constant(*c1).get_data_hash(), c1->get_data_hash());
+}
+
+TEST(constant, data_hash_is_updated_with_data) {
+    const auto c1 = op::v0::Constant::create(element::i32, Shape{3}, {1, 2, 3});
+    const auto c2 = op::v0::Constant::create(element::i32, Shape{3}, {4});
+    const auto hash = c1->get_data_hash();
+
+    c1->fill_data(element::i32, 4);
+    EXPECT_NE(c1->get_data_hash(), hash);
+    EXPECT_EQ(c1->get_data_hash(), c2->get_data_hash());
+
+    // the copy shares the data buffer
+    op::v0::Constant copy(*c1);
+    copy.fill_data(element::i32, 1);
+    EXPECT_EQ(c1->get_data_hash(), copy.get_data_hash());
+    EXPECT_NE(c1->get_data_hash(), c2->get_data_hash());
+}
+
+TEST(constant, data_hash_of_tensor_memory) {
+    std::vector<int32_t> data{1, 2, 3};
+    auto c1 = op::v0::Constant(Tensor(element::i32, Shape{3}, data.data()));
+    const auto c2 = op::v0::Constant::create(element::i32, Shape{3}, {1, 2, 3});
+    const auto c3 = op::v0::Constant::create(element::i32, Shape{3}, {4});
+    EXPECT_EQ(c1.get_data_hash(), c2->get_data_hash());
+
+    c1.fill_data(element::i32, 4);
+    EXPECT_EQ(data[2], 4);
+    EXPECT_EQ(c1.get_data_hash(), c3->get_data_hash());
+}
+
+TEST(constant, data_hash_of_strings) {
+    const auto c1 = op::v0::Constant::create(element::string, Shape{2}, std::vector<std::string>{"ab", "c"});
+    const auto c2 = op::v0::Constant::create(element::string, Shape{2}, std::vector<std::string>{"a", "bc"});
+
+    EXPECT_NE(c1->get_data_hash(), c2->get_data_hash());
+}
+
 using ConstantInputValue = std::variant<bool,
                                         char,
                                         signed char,
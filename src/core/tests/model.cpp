@@ -12,14 +12,17 @@
 #include "common_test_utils/test_common.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/graph_util.hpp"
+#include "openvino/core/model_hash.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/op/abs.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/relu.hpp"
 #include "openvino/op/reshape.hpp"
 #include "openvino/op/shape_of.hpp"
 #include "openvino/op/subtract.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "shared_node_info.hpp"
 
 using ov::op::util::Variable, ov::op::util::VariableInfo;
@@ -2350,3 +2353,44 @@ TEST(model, create_model) {
     EXPECT_THROW(ov::Model(ov::ResultVector{}, {}, {}, {nullptr}, ""), ov::Exception);
     EXPECT_THROW(ov::Model(ov::OutputVector{ov::Output<ov::Node>{nullptr, 0}}, {}, {}, {}, ""), ov::Exception);
 }
+
+namespace {
+// counts the accesses to the data
+class CountingBuffer : public ov::AlignedBuffer {
+public:
+    using ov::AlignedBuffer::AlignedBuffer;
+
+    void hint_prefetch() const override {
+        ++m_reads;
+    }
+
+    size_t reads() const {
+        return m_reads;
+    }
+
+private:
+    mutable size_t m_reads = 0;
+};
+}  // namespace
+
+TEST(model, hash_does_not_read_constant_data_again) {
+    const auto buffer = std::make_shared<CountingBuffer>(4 * sizeof(float));
+    std::fill_n(static_cast<float*>(buffer->get_ptr()), 4, 1.f);
+    const auto weights = std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{4}, buffer);
+    const auto data = std::make_shared<Parameter>(ov::element::f32, ov::PartialShape{4});
+    const auto add = std::make_shared<ov::op::v1::Add>(data, weights);
+    const auto model = std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{data});
+
+    const auto model_copy = model->clone();
+
+    const auto hash = ov::util::compute_model_hash(*model);
+    const auto reads = buffer->reads();
+    // the data is hashed once even for the copy of the model, as the copy shares the buffer
+    EXPECT_EQ(ov::util::compute_model_hash(*model), hash);
+    EXPECT_EQ(ov::util::compute_model_hash(*model_copy), hash);
+    EXPECT_EQ(buffer->reads(), reads);
+
+    weights->fill_data(ov::element::f32, 2.f);
+    EXPECT_NE(ov::util::compute_model_hash(*model), hash);
+    EXPECT_GT(buffer->reads(), reads);
+}
@@ -5,12 +5,14 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <sstream>
 
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/graph_comparator.hpp"
 #include "common_test_utils/test_common.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/core.hpp"
+#include "openvino/xml_util/constant_writer.hpp"
 #include "transformations/common_optimizations/compress_float_constants.hpp"
 
 class SerializationConstantCompressionTest : public ov::test::TestsCommon {
@@ -444,3 +446,43 @@ TEST_F(SerializationConstantCompressionTest, IdenticalStringConstantsRoundTrip)
         }
     }
 }
+
+TEST_F(SerializationConstantCompressionTest, PreparedConstantsAreWrittenIdentically) {
+    const std::vector<float> a(1000, 1.5f);
+    const std::vector<float> b(1000, 1.5f);
+    std::vector<float> c(1000);
+    for (size_t i = 0; i < c.size(); ++i) {
+        c[i] = static_cast<float>(i) * 0.25f;
+    }
+    const auto size = a.size() * sizeof(float);
+    const auto as_chars = [](const std::vector<float>& v) {
+        return reinterpret_cast<const char*>(v.data());
+    };
+    // the same data is written as is and compressed, duplicates are written once
+    const std::vector<ov::util::ConstantWriter::ConstantData> constants{{as_chars(a), size, false, ov::element::f32},
+                                                                        {as_chars(b), size, false, ov::element::f32},
+                                                                        {as_chars(c), size, true, ov::element::f32},
+                                                                        {as_chars(a), size, false, ov::element::f32}};
+
+    const auto write_all = [&](bool prepare, std::vector<int64_t>& offsets) {
+        std::stringstream bin;
+        ov::util::ConstantWriter writer(bin);
+        if (prepare) {
+            writer.prepare(constants);
+        }
+        for (const auto& constant : constants) {
+            size_t new_size = 0;
+            offsets.push_back(
+                writer.write(constant.ptr, constant.size, new_size, constant.compress_to_fp16, constant.src_type));
+        }
+        return std::make_pair(bin.str(), writer.get_data_hash());
+    };
+
+    std::vector<int64_t> expected_offsets, offsets;
+    const auto expected = write_all(false, expected_offsets);
+    const auto actual = write_all(true, offsets);
+
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(offsets, expected_offsets);
+    EXPECT_EQ(expected.first.size(), size + c.size() * sizeof(ov::float16));
+}
@@ -119,6 +119,8 @@ class WeightlessWriter : public ov::util::ConstantWriter {
 public:
     explicit WeightlessWriter(ov::util::ConstantWriter& other) : ov::util::ConstantWriter(other) {}
 
+    void prepare(const std::vector<ConstantData>&) override {}
+
     FilePosition write(const char*, size_t, size_t&, bool, ov::element::Type, bool) override {
         // use new_size not modified and return offset 0 to store these in modifed IR (xmL) only
         return 0;
@@ -132,6 +134,8 @@ public:
         : ov::util::ConstantWriter(other),
           m_weights_map{std::ref(weights_map)} {}
 
+    void prepare(const std::vector<ConstantData>&) override {}
+
     FilePosition write(const char* ptr, size_t size, size_t& new_size, bool, ov::element::Type, bool) override {
         auto weights = std::make_shared<ov::AlignedBuffer>(size);
         std::memcpy(weights->get_ptr(), ptr, size);
@@ -4,6 +4,8 @@
 
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 
+#include <algorithm>
+#include <exception>
 #include <regex>
 #include <stack>
 #include <string_view>
@@ -11,6 +13,7 @@
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/memory_util.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
@@ -30,6 +33,31 @@
 
 namespace ov::util {
 
+namespace {
+/// \brief Calls func for each index in [0, size) in parallel chunks of the indices.
+/// The exception of the lowest index is rethrown, so the reported error does not depend on the threads timing.
+template <class F>
+void parallel_for_chunks(size_t size, const F& func) {
+    constexpr size_t chunk_size = 64;
+    const size_t chunks = (size + chunk_size - 1) / chunk_size;
+    std::vector<std::exception_ptr> errors(chunks);
+    ov::parallel_for(chunks, [&](size_t chunk) {
+        try {
+            for (size_t i = chunk * chunk_size; i < std::min(size, (chunk + 1) * chunk_size); ++i) {
+                func(i);
+            }
+        } catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+}  // namespace
+
 template <>
 void str_to_container<std::vector<std::string>>(const std::string& value, std::vector<std::string>& res) {
     std::stringstream ss(value);
@@ -944,19 +972,28 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
-    // Read all layers and store their parameters in params map
+    // Read all layers and store their parameters in params map, the layers are parsed in parallel chunks
+    std::vector<pugi::xml_node> layers;
     FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
-        params[node_param.layerId] = {node, node_param};
-        if (node_param.type == "Result" || node_param.type == "Assign") {
-            outputs.push_back(node_param.layerId);
+        layers.push_back(node);
+    }
+    std::vector<GenericLayerParams> layers_params(layers.size());
+    parallel_for_chunks(layers.size(), [&](size_t i) {
+        layers_params[i] = parse_generic_params(layers[i]);
+    });
+    for (size_t i = 0; i < layers.size(); ++i) {
+        const auto layer_id = layers_params[i].layerId;
+        params[layer_id] = {layers[i], std::move(layers_params[i])};
+        const auto& layer_param = params[layer_id].params;
+        if (layer_param.type == "Result" || layer_param.type == "Assign") {
+            outputs.push_back(layer_param.layerId);
         }
-        if (node_param.type == "Parameter") {
+        if (layer_param.type == "Parameter") {
             // Save Parameters order according to order in XML.
             // To do so, handle nodes manually and ignore during DFS
-            dfs_used_nodes.insert(node_param.layerId);
-            order.push_back(node_param.layerId);
-            edges[node_param.layerId] = {};
+            dfs_used_nodes.insert(layer_param.layerId);
+            order.push_back(layer_param.layerId);
+            edges[layer_param.layerId] = {};
         }
     }
 
@@ -1001,12 +1038,37 @@ std::shared_ptr<ov::Model> XmlDeserializer::parse_function(const pugi::xml_node&
     std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
 
+    // Constants don't depend on other layers, so they are created in parallel in advance. The rest of the operations
+    // are created in the topological order below, as each of them is connected to the outputs of its producers.
+    {
+        std::vector<size_t> constant_ids;
+        for (const auto& layer_id : order) {
+            const auto& type = params[layer_id].params.type;
+            const auto edge_it = edges.find(layer_id);
+            if ((type == "Const" || type == "Constant") && edge_it != edges.end() && edge_it->second.empty()) {
+                constant_ids.push_back(layer_id);
+            }
+        }
+        std::vector<std::shared_ptr<ov::Node>> constants(constant_ids.size());
+        parallel_for_chunks(constant_ids.size(), [&](size_t i) {
+            const auto& p = params.at(constant_ids[i]);
+            constants[i] = create_node({}, p.xml, weights, p.params);
+        });
+        for (size_t i = 0; i < constant_ids.size(); ++i) {
+            id_to_node[constant_ids[i]] = std::move(constants[i]);
+        }
+    }
+
     //  Following topological order create OpenVINO operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
         const auto& edgeIt = edges.find(layer_id);
         if (edgeIt == edges.end())
             continue;
+        if (auto created = id_to_node.find(layer_id); created != id_to_node.end()) {
+            func_nodes.all.emplace_back(created->second);
+            continue;
+        }
         ov::OutputVector inputs(edgeIt->second.size());
         for (auto& e : edgeIt->second) {
             auto input_node = id_to_node[e.fromLayerId];
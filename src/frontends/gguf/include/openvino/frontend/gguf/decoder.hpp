@@ -118,6 +118,12 @@ public:
     // dequant / repacking / requantization, so the decoder never builds OV nodes itself. (Model
     // inputs are also GGML_OP_NONE leaves, but they are returned via get_model_inputs() and
     // resolved to Parameters before the walk, so they carry no "data".)
+    //
+    // A weight may also expose an optional "data_release" attribute, a
+    // std::function<void(size_t offset, size_t size)> that translate_weight calls for each byte
+    // range of "data" it has finished converting. A decoder whose data is file-backed uses it to
+    // drop the packed pages as soon as they are unpacked, which keeps the load footprint close to
+    // the converted weight size.
 
     // RoPE configuration, exposed through get_attribute<RopeConfig>("rope_config"):
     //   - at model scope (via InputModel::get_rope_config), used by TranslateSession::preprocess
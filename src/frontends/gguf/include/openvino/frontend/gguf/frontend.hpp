@@ -45,16 +45,20 @@ public:
 
 protected:
     /// \brief Check if FrontEnd can recognize model from given parts.
-    /// \note Always returns false: this frontend is hidden from FrontEndManager and is never
-    ///       auto-selected. It is used only via direct linkage, by constructing FrontEnd and
-    ///       calling convert() on an InputModel built from a GgufDecoder.
-    /// \param variants Unused.
-    /// \return Always false.
+    /// \note This frontend is hidden from FrontEndManager and is never auto-selected, so this is
+    ///       only reached by a caller that holds the FrontEnd directly.
+    /// \param variants A single path to a .gguf file.
+    /// \return true if variants[0] is a path to a file with the .gguf extension and GGUF magic.
     bool supported_impl(const std::vector<ov::Any>& variants) const override;
 
-    /// \brief Load the input model from a GgufDecoder.
-    /// \param variants A single GgufDecoder (a .gguf file path is not accepted; the caller supplies
-    ///        the decoder). variants[0] must hold a std::shared_ptr<GgufDecoder>.
+    /// \brief Load the input model from a GgufDecoder or a .gguf file.
+    /// \param variants variants[0] holds either a std::shared_ptr<GgufDecoder> or a path to a
+    ///        .gguf file (std::string, std::wstring or std::filesystem::path). A file is
+    ///        memory-mapped and every tensor becomes a weight output of the converted model; the
+    ///        tensor bytes are consumed directly from the mapping.
+    /// \note A .gguf file has no compute graph, so the converted model is a weight source for a
+    ///       caller that builds the graph itself, not a runnable model. ov::Core::read_model does not
+    ///       load .gguf files since this frontend is hidden from FrontEndManager.
     /// \return InputModel::Ptr
     InputModel::Ptr load_impl(const std::vector<ov::Any>& variants) const override;
 
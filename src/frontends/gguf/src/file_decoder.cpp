@@ -0,0 +1,157 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "file_decoder.hpp"
+
+#include <utility>
+
+#include "openvino/frontend/exception.hpp"
+#include "quant/weights.hpp"
+
+namespace ov {
+namespace frontend {
+namespace gguf {
+
+namespace {
+
+const std::string kWeightOpType = "GGML_OP_NONE";
+
+// Read a numeric scalar metadata value (stored as a rank-0 ov::Tensor) as T.
+template <typename T>
+bool get_scalar(const std::unordered_map<std::string, GGUFMetaData>& metadata, const std::string& key, T& value) {
+    auto it = metadata.find(key);
+    if (it == metadata.end()) {
+        return false;
+    }
+    const auto* tensor = std::get_if<ov::Tensor>(&it->second);
+    if (!tensor || tensor->get_size() != 1) {
+        return false;
+    }
+    switch (tensor->get_element_type()) {
+    case ov::element::u32:
+        value = static_cast<T>(*tensor->data<const uint32_t>());
+        return true;
+    case ov::element::i32:
+        value = static_cast<T>(*tensor->data<const int32_t>());
+        return true;
+    case ov::element::u64:
+        value = static_cast<T>(*tensor->data<const uint64_t>());
+        return true;
+    case ov::element::i64:
+        value = static_cast<T>(*tensor->data<const int64_t>());
+        return true;
+    case ov::element::f32:
+        value = static_cast<T>(*tensor->data<const float>());
+        return true;
+    case ov::element::f64:
+        value = static_cast<T>(*tensor->data<const double>());
+        return true;
+    default:
+        return false;
+    }
+}
+
+}  // namespace
+
+GgufFileDecoder::GgufFileDecoder(GgufFile::Ptr file) : m_file(std::move(file)) {
+    FRONT_END_GENERAL_CHECK(m_file, "GgufFileDecoder requires an opened GGUF file");
+}
+
+GgufFileDecoder::GgufFileDecoder(GgufFile::Ptr file, size_t tensor_idx)
+    : m_file(std::move(file)),
+      m_tensor_idx(tensor_idx) {}
+
+ov::Any GgufFileDecoder::get_attribute(const std::string& name) const {
+    if (name == "rope_config") {
+        auto config = make_rope_config();
+        return config.n_dims == 0 ? ov::Any{} : ov::Any(config);
+    }
+    if (!is_node_bound()) {
+        return {};
+    }
+    const auto& tensor = m_file->get_tensors()[m_tensor_idx];
+    if (name == "data") {
+        return m_file->get_tensor_data(tensor);
+    }
+    if (name == "quant_type") {
+        return gguf_type_name(static_cast<gguf_tensor_type>(tensor.type));
+    }
+    if (name == "data_release") {
+        // Converted tiles of a quantized tensor are dropped from the page cache right away.
+        return WeightDataRelease([file = m_file, tensor](size_t offset, size_t size) {
+            file->release_tensor_data(tensor, offset, size);
+        });
+    }
+    return {};
+}
+
+PartialShape GgufFileDecoder::get_output_shape() const {
+    FRONT_END_GENERAL_CHECK(is_node_bound(), "get_output_shape() requires a node-bound GGUF file decoder");
+    return GgufFile::get_logical_shape(m_file->get_tensors()[m_tensor_idx]);
+}
+
+std::vector<std::string> GgufFileDecoder::get_output_names() const {
+    FRONT_END_GENERAL_CHECK(is_node_bound(), "get_output_names() requires a node-bound GGUF file decoder");
+    return {m_file->get_tensor_names()[m_tensor_idx]};
+}
+
+const std::string& GgufFileDecoder::get_op_type() const {
+    return kWeightOpType;
+}
+
+const std::string& GgufFileDecoder::get_op_name() const {
+    FRONT_END_GENERAL_CHECK(is_node_bound(), "get_op_name() requires a node-bound GGUF file decoder");
+    return m_file->get_tensor_names()[m_tensor_idx];
+}
+
+void GgufFileDecoder::visit_subgraph(std::function<void(std::shared_ptr<GgufDecoder>)> node_visitor) const {
+    const size_t num_tensors = m_file->get_tensors().size();
+    for (size_t i = 0; i < num_tensors; ++i) {
+        node_visitor(std::shared_ptr<GgufFileDecoder>(new GgufFileDecoder(m_file, i)));
+    }
+}
+
+RopeConfig GgufFileDecoder::make_rope_config() const {
+    // Mirrors llama.cpp's hparams loading: rope.dimension_count falls back to the head size, the
+    // context/scaling keys to "no scaling", and the YaRN betas to their llama.cpp defaults.
+    RopeConfig config;
+    const auto& metadata = m_file->get_metadata();
+    auto arch_it = metadata.find("general.architecture");
+    if (arch_it == metadata.end() || !std::holds_alternative<std::string>(arch_it->second)) {
+        return config;
+    }
+    const auto& arch = std::get<std::string>(arch_it->second);
+
+    int64_t n_dims = 0;
+    if (!get_scalar(metadata, arch + ".rope.dimension_count", n_dims)) {
+        int64_t embedding = 0, heads = 0;
+        if (get_scalar(metadata, arch + ".embedding_length", embedding) &&
+            get_scalar(metadata, arch + ".attention.head_count", heads) && heads > 0) {
+            n_dims = embedding / heads;
+        }
+    }
+    config.n_dims = static_cast<int>(n_dims);
+
+    config.freq_base = 10000.0f;
+    get_scalar(metadata, arch + ".rope.freq_base", config.freq_base);
+
+    int64_t n_ctx_orig = 0;
+    if (!get_scalar(metadata, arch + ".rope.scaling.original_context_length", n_ctx_orig)) {
+        get_scalar(metadata, arch + ".context_length", n_ctx_orig);
+    }
+    config.n_ctx_orig = static_cast<int>(n_ctx_orig);
+
+    float scaling_factor = 0.0f;
+    config.freq_scale = get_scalar(metadata, arch + ".rope.scaling.factor", scaling_factor) && scaling_factor > 0.0f
+                            ? 1.0f / scaling_factor
+                            : 1.0f;
+    config.attn_factor = 1.0f;
+    config.beta_fast = 32.0f;
+    config.beta_slow = 1.0f;
+    return config;
+}
+
+}  // namespace gguf
+}  // namespace frontend
+}  // namespace ov
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gguf_file.hpp"
+#include "openvino/frontend/gguf/decoder.hpp"
+
+namespace ov::frontend::gguf {
+
+// GgufDecoder over a memory-mapped .gguf file (see GgufFile). A .gguf file carries weights and
+// metadata but no compute graph, so the decoder surfaces every tensor of the file as a weight
+// leaf ("GGML_OP_NONE" with "data" / "quant_type" attributes) and every weight is a model output.
+// translate_weight consumes the raw, still-packed bytes straight from the mapping; nothing is
+// copied before the dequant / repacking step. "rope_config" is answered from the architecture
+// metadata so that a caller can reuse the file decoder as the weight source of a graph decoder.
+class GgufFileDecoder : public GgufDecoder {
+public:
+    explicit GgufFileDecoder(GgufFile::Ptr file);
+
+    const GgufFile::Ptr& get_file() const {
+        return m_file;
+    }
+
+    // ── Node scope ────────────────────────────────────────────────────────────────────────────
+    ov::Any get_attribute(const std::string& name) const override;
+
+    int64_t get_input_view_element_offset(const std::string&) const override {
+        return 0;
+    }
+
+    PartialShape get_input_shape(const std::string&) const override {
+        return {};
+    }
+
+    size_t get_input_size() const override {
+        return 0;
+    }
+
+    std::vector<std::string> get_input_names() const override {
+        return {};
+    }
+
+    PartialShape get_output_shape() const override;
+
+    std::vector<std::string> get_output_names() const override;
+
+    const std::string& get_op_type() const override;
+
+    const std::string& get_op_name() const override;
+
+    // ── Model scope ───────────────────────────────────────────────────────────────────────────
+    void visit_subgraph(std::function<void(std::shared_ptr<GgufDecoder>)> node_visitor) const override;
+
+    const std::map<std::string, std::shared_ptr<ov::Node>>& get_model_inputs() const override {
+        return m_model_inputs;
+    }
+
+    std::vector<std::string> get_model_output_names() const override {
+        return m_file->get_tensor_names();
+    }
+
+private:
+    GgufFileDecoder(GgufFile::Ptr file, size_t tensor_idx);
+
+    bool is_node_bound() const {
+        return m_tensor_idx != npos;
+    }
+
+    RopeConfig make_rope_config() const;
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    GgufFile::Ptr m_file;
+    size_t m_tensor_idx = npos;
+    std::map<std::string, std::shared_ptr<ov::Node>> m_model_inputs;
+};
+
+}  // namespace ov::frontend::gguf
@@ -4,9 +4,12 @@
 
 #include "openvino/frontend/gguf/frontend.hpp"
 
+#include "file_decoder.hpp"
+#include "gguf_file.hpp"
 #include "input_model.hpp"
 #include "op_table.hpp"
 #include "openvino/core/so_extension.hpp"
+#include "openvino/frontend/common/path_util.hpp"
 #include "openvino/frontend/extension/conversion.hpp"
 #include "openvino/frontend/extension/decoder_transformation.hpp"
 #include "openvino/frontend/extension/telemetry.hpp"
@@ -18,12 +21,16 @@ namespace ov {
 namespace frontend {
 namespace gguf {
 
-// Discoverability (intentional): consumed only by direct linkage -- a caller (the llama.cpp
+// Discoverability (intentional): consumed mainly by direct linkage -- a caller (the llama.cpp
 // ggml-openvino backend, OpenVINO GenAI) links openvino::frontend::gguf and feeds FrontEnd a live
-// GgufDecoder (no .gguf-path reader; see supported_impl / load_impl). It exports the standard
-// plugin entry points so FrontEndManager can scan the frontend dir without error, but "gguf" is
-// treated as hidden there (manager.cpp is_hidden_frontend), so it is never listed or auto-selected.
-// Drop it from that list once this frontend gains file-based loading and passes production review.
+// GgufDecoder, or a path to a .gguf file, which is memory-mapped and surfaced through
+// GgufFileDecoder (see supported_impl / load_impl). It exports the standard plugin entry points so
+// FrontEndManager can scan the frontend dir without error, but "gguf" is treated as hidden there
+// (manager.cpp is_hidden_frontend), so it is never listed or auto-selected and ov::Core::read_model
+// does not accept .gguf files. A .gguf file holds weights and metadata only (no compute graph), so
+// file-based loading yields a weights-only model (every tensor an output) meant as a weight source
+// for a caller that builds the graph itself, not a runnable model. Drop the frontend from that list
+// only once it can build the architecture graph from the file and passes production review.
 
 struct FrontEnd::Impl {
     std::unordered_map<std::string, CreatorFunction> op_extension_translators;
@@ -91,19 +98,29 @@ void FrontEnd::add_extension(const std::shared_ptr<ov::Extension>& extension) {
     }
 }
 
-bool FrontEnd::supported_impl(const std::vector<ov::Any>&) const {
-    // Always false: this frontend is never selected by FrontEndManager (load_by_model). It is used
-    // only via direct linkage -- a caller constructs FrontEnd and calls convert() with an
-    // InputModel built from a GgufDecoder -- which does not go through supported(). See the
-    // discoverability note at the top of this file.
+bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
+    // Only a .gguf file path is recognized here; a GgufDecoder is loaded through direct linkage,
+    // which does not go through supported(). FrontEndManager never reaches this for the hidden
+    // "gguf" frontend -- see the discoverability note at the top of this file.
+    if (variants.size() != 1) {
+        return false;
+    }
+    if (const auto path = ov::frontend::get_path_from_any(variants[0])) {
+        return GgufFile::is_supported(*path);
+    }
     return false;
 }
 
 InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const {
     FRONT_END_GENERAL_CHECK(!variants.empty(),
                             "GGUF Frontend requires at least one parameter in model representation.");
+    if (const auto path = ov::frontend::get_path_from_any(variants[0])) {
+        // The whole file is mapped; tensor bytes are paged in lazily when the weights are built.
+        auto file = std::make_shared<GgufFile>(*path);
+        return std::make_shared<InputModel>(std::make_shared<GgufFileDecoder>(std::move(file)));
+    }
     FRONT_END_GENERAL_CHECK(variants[0].is<std::shared_ptr<GgufDecoder>>(),
-                            "GGUF Frontend supports loading from a GgufDecoder only.");
+                            "GGUF Frontend supports loading from a GgufDecoder or a .gguf file path only.");
     auto decoder = variants[0].as<std::shared_ptr<GgufDecoder>>();
     FRONT_END_GENERAL_CHECK(decoder, "Couldn't cast ov::Any to std::shared_ptr<GgufDecoder>");
     return std::make_shared<InputModel>(decoder);
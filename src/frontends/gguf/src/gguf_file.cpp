@@ -0,0 +1,369 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gguf_file.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/frontend/exception.hpp"
+#include "openvino/util/file_util.hpp"
+
+namespace ov {
+namespace frontend {
+namespace gguf {
+
+namespace {
+
+constexpr uint32_t kGgufMagic = 0x46554747;  // "GGUF" read as a little-endian u32
+constexpr uint64_t kDefaultAlignment = 32;
+constexpr uint32_t kMaxDims = 4;
+// name length (u64) + ndim (u32) + one dim (u64) + type (u32) + offset (u64)
+constexpr uint64_t kMinTensorInfoSize = 32;
+
+// Bounds-checked little-endian cursor over the mapped file.
+class Cursor {
+public:
+    Cursor(const uint8_t* data, size_t size) : m_data(data), m_size(size) {}
+
+    template <typename T>
+    T read() {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    // GGUF string: u64 length followed by that many bytes, not null-terminated.
+    std::pair<const char*, size_t> read_string_view() {
+        const auto len = read<uint64_t>();
+        const auto* ptr = reinterpret_cast<const char*>(take(len));
+        return {ptr, static_cast<size_t>(len)};
+    }
+
+    std::string read_string() {
+        const auto view = read_string_view();
+        return std::string(view.first, view.second);
+    }
+
+    const uint8_t* take(uint64_t bytes) {
+        FRONT_END_GENERAL_CHECK(bytes <= m_size - m_pos, "GGUF file is truncated at offset ", m_pos);
+        const uint8_t* ptr = m_data + m_pos;
+        m_pos += static_cast<size_t>(bytes);
+        return ptr;
+    }
+
+    size_t position() const {
+        return m_pos;
+    }
+
+    size_t remaining() const {
+        return m_size - m_pos;
+    }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+// Element type of a scalar GGUF metadata value; dynamic for strings/arrays.
+ov::element::Type meta_element_type(uint32_t value_type) {
+    switch (value_type) {
+    case GGUF_VALUE_TYPE_UINT8:
+        return ov::element::u8;
+    case GGUF_VALUE_TYPE_INT8:
+        return ov::element::i8;
+    case GGUF_VALUE_TYPE_UINT16:
+        return ov::element::u16;
+    case GGUF_VALUE_TYPE_INT16:
+        return ov::element::i16;
+    case GGUF_VALUE_TYPE_UINT32:
+        return ov::element::u32;
+    case GGUF_VALUE_TYPE_INT32:
+        return ov::element::i32;
+    case GGUF_VALUE_TYPE_FLOAT32:
+        return ov::element::f32;
+    case GGUF_VALUE_TYPE_BOOL:
+        return ov::element::boolean;
+    case GGUF_VALUE_TYPE_UINT64:
+        return ov::element::u64;
+    case GGUF_VALUE_TYPE_INT64:
+        return ov::element::i64;
+    case GGUF_VALUE_TYPE_FLOAT64:
+        return ov::element::f64;
+    default:
+        return ov::element::dynamic;
+    }
+}
+
+// Nested metadata arrays are skipped recursively, a crafted header must not exhaust the stack.
+constexpr size_t max_meta_array_depth = 16;
+
+// Skip a metadata value that the frontend does not keep (nested arrays).
+void skip_value(Cursor& cursor, uint32_t value_type, size_t depth) {
+    if (value_type == GGUF_VALUE_TYPE_STRING) {
+        cursor.read_string_view();
+    } else if (value_type == GGUF_VALUE_TYPE_ARRAY) {
+        FRONT_END_GENERAL_CHECK(depth < max_meta_array_depth,
+                                "GGUF metadata arrays are nested deeper than ",
+                                max_meta_array_depth,
+                                " levels");
+        const auto elem_type = cursor.read<uint32_t>();
+        const auto count = cursor.read<uint64_t>();
+        for (uint64_t i = 0; i < count; ++i) {
+            skip_value(cursor, elem_type, depth + 1);
+        }
+    } else {
+        const auto et = meta_element_type(value_type);
+        FRONT_END_GENERAL_CHECK(et.is_static(), "Unknown GGUF metadata value type ", value_type);
+        cursor.take(et.size());
+    }
+}
+
+GGUFMetaData read_value(Cursor& cursor, uint32_t value_type) {
+    if (value_type == GGUF_VALUE_TYPE_STRING) {
+        return cursor.read_string();
+    }
+    if (value_type == GGUF_VALUE_TYPE_ARRAY) {
+        const auto elem_type = cursor.read<uint32_t>();
+        const auto count = cursor.read<uint64_t>();
+        if (elem_type == GGUF_VALUE_TYPE_STRING) {
+            std::vector<std::string> strings;
+            // every string takes at least its u64 length, a larger count is caught by the cursor
+            strings.reserve(static_cast<size_t>(std::min<uint64_t>(count, cursor.remaining() / sizeof(uint64_t))));
+            for (uint64_t i = 0; i < count; ++i) {
+                strings.push_back(cursor.read_string());
+            }
+            return strings;
+        }
+        const auto et = meta_element_type(elem_type);
+        if (et.is_dynamic()) {
+            for (uint64_t i = 0; i < count; ++i) {
+                skip_value(cursor, elem_type, 1);
+            }
+            return std::monostate{};
+        }
+        FRONT_END_GENERAL_CHECK(count <= cursor.remaining() / et.size(), "GGUF file is truncated in a metadata array");
+        const auto* values = cursor.take(count * et.size());
+        ov::Tensor array(et, ov::Shape{static_cast<size_t>(count)});
+        std::memcpy(array.data(), values, array.get_byte_size());
+        return array;
+    }
+    const auto et = meta_element_type(value_type);
+    FRONT_END_GENERAL_CHECK(et.is_static(), "Unknown GGUF metadata value type ", value_type);
+    ov::Tensor scalar(et, ov::Shape{});
+    std::memcpy(scalar.data(), cursor.take(et.size()), et.size());
+    return scalar;
+}
+
+// Multiplies sizes read from the file. A crafted header must fail here instead of wrapping around to a
+// small byte size that passes the bounds check of the mapping.
+uint64_t checked_mul(uint64_t a, uint64_t b, const std::pair<const char*, size_t>& name) {
+    FRONT_END_GENERAL_CHECK(b == 0 || a <= std::numeric_limits<size_t>::max() / b,
+                            "GGUF tensor ",
+                            std::string(name.first, name.second),
+                            " is too large");
+    return a * b;
+}
+
+}  // namespace
+
+bool gguf_type_block_info(uint32_t type, uint64_t& block_size, uint64_t& type_size) {
+    switch (type) {
+    case GGUF_TYPE_F32:
+    case GGUF_TYPE_I32:
+        block_size = 1, type_size = 4;
+        return true;
+    case GGUF_TYPE_F16:
+    case GGUF_TYPE_BF16:
+    case GGUF_TYPE_I16:
+        block_size = 1, type_size = 2;
+        return true;
+    case GGUF_TYPE_I8:
+        block_size = 1, type_size = 1;
+        return true;
+    case GGUF_TYPE_I64:
+    case GGUF_TYPE_F64:
+        block_size = 1, type_size = 8;
+        return true;
+    case GGUF_TYPE_Q4_0:
+        block_size = 32, type_size = 18;
+        return true;
+    case GGUF_TYPE_Q4_1:
+        block_size = 32, type_size = 20;
+        return true;
+    case GGUF_TYPE_Q5_0:
+        block_size = 32, type_size = 22;
+        return true;
+    case GGUF_TYPE_Q5_1:
+        block_size = 32, type_size = 24;
+        return true;
+    case GGUF_TYPE_Q8_0:
+        block_size = 32, type_size = 34;
+        return true;
+    case GGUF_TYPE_Q8_1:
+        block_size = 32, type_size = 36;
+        return true;
+    case GGUF_TYPE_MXFP4:
+        block_size = 32, type_size = 17;
+        return true;
+    case GGUF_TYPE_Q2_K:
+        block_size = 256, type_size = 84;
+        return true;
+    case GGUF_TYPE_Q3_K:
+        block_size = 256, type_size = 110;
+        return true;
+    case GGUF_TYPE_Q4_K:
+        block_size = 256, type_size = 144;
+        return true;
+    case GGUF_TYPE_Q5_K:
+        block_size = 256, type_size = 176;
+        return true;
+    case GGUF_TYPE_Q6_K:
+        block_size = 256, type_size = 210;
+        return true;
+    case GGUF_TYPE_Q8_K:
+        block_size = 256, type_size = 292;
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool GgufFile::is_supported(const std::filesystem::path& path) {
+    try {
+        if (path.extension() != std::filesystem::path(".gguf") || !ov::util::file_exists(path)) {
+            return false;
+        }
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+        uint32_t magic = 0;
+        stream.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        return stream.gcount() == sizeof(magic) && magic == kGgufMagic;
+    } catch (...) {
+        return false;
+    }
+}
+
+GgufFile::GgufFile(const std::filesystem::path& path) {
+    FRONT_END_GENERAL_CHECK(ov::util::file_exists(path), "Could not open the file: ", path);
+    m_mapped = ov::load_mmap_object(path);
+    FRONT_END_GENERAL_CHECK(m_mapped, "Failed to map GGUF file: ", path);
+
+    const auto* base = reinterpret_cast<const uint8_t*>(m_mapped->data());
+    const size_t file_size = m_mapped->size();
+    Cursor cursor(base, file_size);
+
+    FRONT_END_GENERAL_CHECK(cursor.read<uint32_t>() == kGgufMagic, "Not a GGUF file (bad magic): ", path);
+    m_version = cursor.read<uint32_t>();
+    FRONT_END_GENERAL_CHECK(m_version == 2 || m_version == 3,
+                            "Unsupported GGUF version ",
+                            m_version,
+                            " (only v2 and v3 are supported; a byte-swapped value means a big-endian file)");
+    const auto tensor_count = cursor.read<uint64_t>();
+    const auto kv_count = cursor.read<uint64_t>();
+
+    for (uint64_t i = 0; i < kv_count; ++i) {
+        auto key = cursor.read_string();
+        const auto value_type = cursor.read<uint32_t>();
+        m_metadata[key] = read_value(cursor, value_type);
+    }
+
+    if (auto it = m_metadata.find("general.alignment"); it != m_metadata.end()) {
+        const auto* value = std::get_if<ov::Tensor>(&it->second);
+        FRONT_END_GENERAL_CHECK(value && value->get_element_type() == ov::element::u32 && value->get_size() == 1,
+                                "general.alignment must be a u32 scalar");
+        m_alignment = *value->data<uint32_t>();
+        FRONT_END_GENERAL_CHECK(m_alignment != 0 && (m_alignment & (m_alignment - 1)) == 0,
+                                "general.alignment must be a power of two, got ",
+                                m_alignment);
+    } else {
+        m_alignment = kDefaultAlignment;
+    }
+
+    FRONT_END_GENERAL_CHECK(tensor_count <= cursor.remaining() / kMinTensorInfoSize,
+                            "GGUF file is truncated: ",
+                            tensor_count,
+                            " tensor infos do not fit into it");
+    m_tensors.reserve(static_cast<size_t>(tensor_count));
+    m_tensor_names.reserve(static_cast<size_t>(tensor_count));
+    for (uint64_t i = 0; i < tensor_count; ++i) {
+        gguf_tensor tensor{};
+        const auto name = cursor.read_string_view();
+        tensor.name = name.first;
+        tensor.namelen = name.second;
+        tensor.ndim = cursor.read<uint32_t>();
+        FRONT_END_GENERAL_CHECK(tensor.ndim >= 1 && tensor.ndim <= kMaxDims,
+                                "GGUF tensor ",
+                                std::string(name.first, name.second),
+                                " has unsupported rank ",
+                                tensor.ndim);
+        tensor.num_weights = 1;
+        for (uint32_t d = 0; d < tensor.ndim; ++d) {
+            tensor.dim[d] = cursor.read<uint64_t>();
+            tensor.num_weights = checked_mul(tensor.num_weights, tensor.dim[d], name);
+        }
+        tensor.type = cursor.read<uint32_t>();
+        tensor.offset = cursor.read<uint64_t>();
+
+        uint64_t block_size = 0, type_size = 0;
+        FRONT_END_GENERAL_CHECK(gguf_type_block_info(tensor.type, block_size, type_size),
+                                "GGUF tensor ",
+                                std::string(name.first, name.second),
+                                " has unsupported type ",
+                                tensor.type);
+        FRONT_END_GENERAL_CHECK(tensor.dim[0] % block_size == 0,
+                                "GGUF tensor ",
+                                std::string(name.first, name.second),
+                                " row length is not a multiple of its block size");
+        tensor.bsize = checked_mul(tensor.num_weights / block_size, type_size, name);
+
+        m_tensor_index.emplace(std::string(name.first, name.second), m_tensors.size());
+        m_tensor_names.emplace_back(name.first, name.second);
+        m_tensors.push_back(tensor);
+    }
+
+    // The tensor data section starts at the next alignment boundary after the tensor infos.
+    m_data_offset = (cursor.position() + m_alignment - 1) / m_alignment * m_alignment;
+    for (auto& tensor : m_tensors) {
+        FRONT_END_GENERAL_CHECK(tensor.offset % m_alignment == 0 && m_data_offset <= file_size &&
+                                    tensor.offset <= file_size - m_data_offset &&
+                                    tensor.bsize <= file_size - m_data_offset - tensor.offset,
+                                "GGUF tensor ",
+                                std::string(tensor.name, tensor.namelen),
+                                " data lies outside of the file");
+        tensor.weights_data = base + m_data_offset + tensor.offset;
+    }
+}
+
+const gguf_tensor* GgufFile::find_tensor(const std::string& name) const {
+    auto it = m_tensor_index.find(name);
+    return it == m_tensor_index.end() ? nullptr : &m_tensors[it->second];
+}
+
+ov::Tensor GgufFile::get_tensor_data(const gguf_tensor& tensor) const {
+    // A read-only view: the mapping is read-only, so writing through the tensor fails instead of faulting.
+    ov::Tensor view(ov::element::u8, ov::Shape{static_cast<size_t>(tensor.bsize)}, tensor.weights_data);
+    // The view itself does not own the bytes; attach the mapping so it outlives every user.
+    return ov::Tensor(view, m_mapped);
+}
+
+void GgufFile::release_tensor_data(const gguf_tensor& tensor, size_t offset, size_t size) const {
+    const auto base = static_cast<size_t>(tensor.weights_data - reinterpret_cast<const uint8_t*>(m_mapped->data()));
+    m_mapped->hint_evict(base + offset, std::min<size_t>(size, tensor.bsize - std::min<size_t>(offset, tensor.bsize)));
+}
+
+ov::Shape GgufFile::get_logical_shape(const gguf_tensor& tensor) {
+    ov::Shape shape(tensor.ndim);
+    for (uint32_t d = 0; d < tensor.ndim; ++d) {
+        shape[tensor.ndim - 1 - d] = static_cast<size_t>(tensor.dim[d]);
+    }
+    return shape;
+}
+
+}  // namespace gguf
+}  // namespace frontend
+}  // namespace ov
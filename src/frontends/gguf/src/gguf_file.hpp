@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/shape.hpp"
+#include "openvino/runtime/tensor.hpp"
+#include "openvino/util/mmap_object.hpp"
+#include "quant/gguf.hpp"
+
+namespace ov::frontend::gguf {
+
+// Native reader of a .gguf file. The header, the KV metadata and the tensor descriptors are
+// parsed directly from a memory mapping of the whole file (ov::load_mmap_object); tensor data is
+// never read or copied here. Each gguf_tensor::weights_data points into the mapping, so the
+// quantized blocks reach the gguf_quants.cpp fill functions exactly as they are laid out on disk
+// and the OS pages them in lazily on first access.
+//
+// Supports GGUF v2 and v3 (64-bit counts). Big-endian files are rejected.
+class GgufFile {
+public:
+    using Ptr = std::shared_ptr<GgufFile>;
+
+    explicit GgufFile(const std::filesystem::path& path);
+
+    // Cheap check used by FrontEnd::supported_impl: the file has the .gguf extension and starts
+    // with the "GGUF" magic. Never throws.
+    static bool is_supported(const std::filesystem::path& path);
+
+    uint32_t get_version() const {
+        return m_version;
+    }
+
+    // Alignment of the tensor data section ("general.alignment", 32 when absent).
+    uint64_t get_alignment() const {
+        return m_alignment;
+    }
+
+    const std::unordered_map<std::string, GGUFMetaData>& get_metadata() const {
+        return m_metadata;
+    }
+
+    // Tensor descriptors in file order.
+    const std::vector<gguf_tensor>& get_tensors() const {
+        return m_tensors;
+    }
+
+    const std::vector<std::string>& get_tensor_names() const {
+        return m_tensor_names;
+    }
+
+    // Returns nullptr when the file has no tensor with this name.
+    const gguf_tensor* find_tensor(const std::string& name) const;
+
+    // Raw bytes of a tensor as a u8 view into the mapping. The returned ov::Tensor keeps the
+    // mapping alive, so Constants built on top of it stay valid after the GgufFile is released.
+    ov::Tensor get_tensor_data(const gguf_tensor& tensor) const;
+
+    // Hint that bytes [offset, offset + size) of a tensor's data will not be read again (its packed
+    // blocks have been converted), so the OS may drop those pages. A later access re-reads them
+    // from the file, so this is always safe, only slower.
+    void release_tensor_data(const gguf_tensor& tensor, size_t offset, size_t size) const;
+
+    // Logical OpenVINO shape of a tensor (GGUF stores dims fastest-first, OV slowest-first).
+    static ov::Shape get_logical_shape(const gguf_tensor& tensor);
+
+private:
+    std::shared_ptr<ov::MappedMemory> m_mapped;
+    uint32_t m_version = 0;
+    uint64_t m_alignment = 32;
+    uint64_t m_data_offset = 0;
+    std::unordered_map<std::string, GGUFMetaData> m_metadata;
+    std::vector<gguf_tensor> m_tensors;
+    std::vector<std::string> m_tensor_names;
+    std::unordered_map<std::string, size_t> m_tensor_index;
+};
+
+// Block geometry of a GGUF tensor type: `block_size` elements are stored in `type_size` bytes.
+// Returns false for a type id the frontend does not know.
+bool gguf_type_block_info(uint32_t type, uint64_t& block_size, uint64_t& type_size);
+
+}  // namespace ov::frontend::gguf
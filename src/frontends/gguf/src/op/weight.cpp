@@ -25,10 +25,16 @@ namespace op {
 // decoder never builds OV nodes itself. (Model-input leaves are also GGML_OP_NONE, but they are
 // resolved to Parameters before the graph walk and never reach this translator.)
 OutputVector translate_weight(const NodeContext& context) {
-    auto data = context.get_attribute<ov::Tensor>("data");
+    // A file-backed decoder hands out a read-only view of the mapping, so the bytes are only read through const access
+    const auto data = context.get_attribute<ov::Tensor>("data");
     FRONT_END_OP_CONVERSION_CHECK(data, "GGML_OP_NONE node has no 'data' attribute; not a weight");
     auto quant_type = context.get_attribute<std::string>("quant_type");
     auto shape = context.get_output_shape().to_shape();
+    // Optional: lets a file-backed decoder drop the packed source pages as they are converted.
+    WeightDataRelease release;
+    if (context.has_attribute("data_release")) {
+        release = context.get_attribute<WeightDataRelease>("data_release");
+    }
 
     // MoE MXFP4 expert weights stay PACKED: MUL_MAT_ID gathers the selected expert and dequantizes
     // on-graph, so materializing all experts to f32 here would waste memory. Surface the raw bytes
@@ -48,20 +54,21 @@ OutputVector translate_weight(const NodeContext& context) {
         return rename_outputs_with_suffix({packed}, context.get_name());
     }
 
-    // MoE expert weights are rank > 2 ([1, n_expert, m, k]). The dequant path works on a 2D
-    // [rows, cols] tensor, so flatten the leading dims to rows, dequantize, then reshape the f32
-    // result back to the full expert shape for MUL_MAT_ID. (Regular weights are already 2D.)
-    if (shape.size() > 2) {
+    // MoE expert weights are rank > 2 ([1, n_expert, m, k]) and norm/bias vectors read straight from
+    // a .gguf file are rank 1. The dequant path works on a 2D [rows, cols] tensor, so flatten the
+    // leading dims to rows (a single row for a vector), dequantize, then reshape the f32 result back
+    // to the original shape. (Regular matmul weights are already 2D.)
+    if (shape.size() != 2) {
         const size_t cols = shape.back();
         const size_t rows = std::accumulate(shape.begin(), shape.end() - 1, size_t{1}, std::multiplies<size_t>());
-        auto node = make_weight_node(data, quant_type, ov::Shape{rows, cols}, context.get_name());
+        auto node = make_weight_node(data, quant_type, ov::Shape{rows, cols}, context.get_name(), release);
         std::vector<int64_t> full(shape.begin(), shape.end());
         auto target = ov::op::v0::Constant::create(ov::element::i64, {full.size()}, full);
         auto reshaped = std::make_shared<ov::op::v1::Reshape>(node, target, false);
         return rename_outputs_with_suffix({reshaped}, context.get_name());
     }
 
-    auto node = make_weight_node(data, quant_type, shape, context.get_name());
+    auto node = make_weight_node(data, quant_type, shape, context.get_name(), release);
     return rename_outputs_with_suffix({node}, context.get_name());
 }
 
@@ -10,9 +10,13 @@
 
 #include "weights.hpp"
 
+#include <algorithm>
 #include <cctype>
 #include <cmath>
 #include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "openvino/core/except.hpp"
@@ -388,6 +392,52 @@ std::vector<float> dequant_extracted_to_f32(const std::unordered_map<std::string
     return out;
 }
 
+// Packed bytes converted per tile. Large enough that the fill functions still parallelize well
+// over the tile's blocks, small enough that the not-yet-released source pages of a tile stay a
+// negligible part of the load footprint.
+constexpr size_t kConvertTileBytes = 16 * 1024 * 1024;
+
+// View of rows [r0, r0 + n) of a row-major [rows, ...] tensor (also for sub-byte element types).
+ov::Tensor row_view(ov::Tensor t, size_t rows, size_t r0, size_t n) {
+    const size_t row_bytes = t.get_byte_size() / rows;
+    ov::Shape shape = t.get_shape();
+    shape[0] = n;
+    return ov::Tensor(t.get_element_type(), shape, static_cast<uint8_t*>(t.data()) + r0 * row_bytes);
+}
+
+// Run a gguf_fill_* function tile by tile: each call sees a gguf_tensor restricted to a run of
+// whole rows and views of `outputs` over the same rows. The fill functions walk blocks linearly,
+// so a row slice converts exactly as it would as part of the whole tensor. The source bytes of a
+// tile are handed to `release` as soon as the tile is done.
+void fill_by_row_tiles(const gguf_tensor& tensor,
+                       size_t rows,
+                       const std::vector<ov::Tensor>& outputs,
+                       const std::function<void(const gguf_tensor&, std::vector<ov::Tensor>&)>& fill,
+                       const WeightDataRelease& release) {
+    if (rows == 0) {
+        return;
+    }
+    const size_t row_bytes = tensor.bsize / rows;
+    const size_t tile_rows = std::max<size_t>(1, kConvertTileBytes / std::max<size_t>(1, row_bytes));
+    for (size_t r0 = 0; r0 < rows; r0 += tile_rows) {
+        const size_t n = std::min(tile_rows, rows - r0);
+        gguf_tensor tile = tensor;
+        tile.dim[1] = n;
+        tile.num_weights = n * tensor.dim[0];
+        tile.bsize = n * row_bytes;
+        tile.weights_data = tensor.weights_data + r0 * row_bytes;
+        std::vector<ov::Tensor> views;
+        views.reserve(outputs.size());
+        for (const auto& out : outputs) {
+            views.push_back(row_view(out, rows, r0, n));
+        }
+        fill(tile, views);
+        if (release) {
+            release(r0 * row_bytes, n * row_bytes);
+        }
+    }
+}
+
 // Decide whether a weight is requantized to Q8_0_C, mirroring llama.cpp's
 // ggml_openvino_get_requant_type for the CPU/GPU (non-NPU) path.
 bool needs_q8_0_c_requant(const std::string& name, gguf_tensor_type qtype) {
@@ -453,7 +503,9 @@ std::shared_ptr<ov::Node> make_weight_node(const std::string& base,
 }
 
 
-gguf_tensor_type gguf_type_from_name(const std::string& quant_type) {
+namespace {
+
+const std::unordered_map<std::string, gguf_tensor_type>& gguf_type_names() {
     static const std::unordered_map<std::string, gguf_tensor_type> names = {{"F32", GGUF_TYPE_F32},
                                                                             {"F16", GGUF_TYPE_F16},
                                                                             {"BF16", GGUF_TYPE_BF16},
@@ -469,6 +521,22 @@ gguf_tensor_type gguf_type_from_name(const std::string& quant_type) {
                                                                             {"Q6_K", GGUF_TYPE_Q6_K},
                                                                             {"Q8_K", GGUF_TYPE_Q8_K},
                                                                             {"MXFP4", GGUF_TYPE_MXFP4}};
+    return names;
+}
+
+}  // namespace
+
+std::string gguf_type_name(gguf_tensor_type type) {
+    for (const auto& item : gguf_type_names()) {
+        if (item.second == type) {
+            return item.first;
+        }
+    }
+    return "TYPE_" + std::to_string(static_cast<int>(type));
+}
+
+gguf_tensor_type gguf_type_from_name(const std::string& quant_type) {
+    const auto& names = gguf_type_names();
     // Accept ggml's lowercase type names ("q4_0", "q6_K", "f16", ...) as well as the
     // canonical uppercase form by upper-casing the prefix before the "_K"/"_0" suffix.
     std::string key = quant_type;
@@ -483,7 +551,8 @@ gguf_tensor_type gguf_type_from_name(const std::string& quant_type) {
 std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
                                            const std::string& quant_type,
                                            const ov::Shape& logical_shape,
-                                           const std::string& name) {
+                                           const std::string& name,
+                                           const WeightDataRelease& release) {
     OPENVINO_ASSERT(logical_shape.size() == 2,
                     "[ggml] weight logical shape must be 2D [rows, cols], got rank ",
                     logical_shape.size());
@@ -498,7 +567,9 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
         ov::element::Type et = qtype == GGUF_TYPE_F32   ? ov::element::f32
                                : qtype == GGUF_TYPE_F16 ? ov::element::f16
                                                         : ov::element::bf16;
-        ov::Tensor typed(et, logical_shape, data.data());
+        // The typed view keeps `data` alive: for a file-backed decoder it is a view into the mapping
+        // and the resulting Constant must not outlive it.
+        ov::Tensor typed(ov::Tensor(et, logical_shape, data.data()), std::make_shared<ov::Tensor>(data));
         std::unordered_map<std::string, ov::Tensor> w{{base + ".weight", typed}};
         std::unordered_map<std::string, gguf_tensor_type> q{{base + ".qtype", qtype}};
         return make_weight_node(base, w, q);
@@ -518,6 +589,12 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
     const auto sub_blocks_per_row = [&](uint64_t block) {
         return cols / block;
     };
+    const auto fill_sym = [&](const gguf_tensor& tile, std::vector<ov::Tensor>& out) {
+        gguf_fill_sym(tile, out[0], out[1]);
+    };
+    const auto fill_asym = [&](const gguf_tensor& tile, std::vector<ov::Tensor>& out) {
+        gguf_fill_asym(tile, out[0], out[1], out[2]);
+    };
 
     std::unordered_map<std::string, ov::Tensor> w;
     std::unordered_map<std::string, gguf_tensor_type> q{{base + ".qtype", qtype}};
@@ -541,6 +618,9 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
         bool ok = requantize_q8_0_channelwise_faithful(tensor, rows, cols, qtype, rq_weights.data<int8_t>(),
                                                        rq_scales.data<ov::float16>());
         OPENVINO_ASSERT(ok, "[ggml] faithful K-quant requant failed for ", base);
+        if (release) {
+            release(0, tensor.bsize);
+        }
         return build_q8_0_c_node(rq_weights, rq_scales, rows, cols);
     }
 
@@ -548,7 +628,14 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
     case GGUF_TYPE_Q4_0: {
         ov::Tensor weights(ov::element::u32, ov::Shape{rows, cols / 8});
         ov::Tensor scales(ov::element::f16, ov::Shape{rows, sub_blocks_per_row(32)});
-        gguf_fill_q4_0(tensor, weights, scales);
+        fill_by_row_tiles(
+            tensor,
+            rows,
+            {weights, scales},
+            [](const gguf_tensor& tile, std::vector<ov::Tensor>& out) {
+                gguf_fill_q4_0(tile, out[0], out[1]);
+            },
+            release);
         w[base + ".weight"] = weights;
         w[base + ".scales"] = scales;
         break;
@@ -558,7 +645,7 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
         // Symmetric, i8 weights + f16 scales (group 32).
         ov::Tensor weights(ov::element::i8, ov::Shape{rows, cols});
         ov::Tensor scales(ov::element::f16, ov::Shape{rows, sub_blocks_per_row(32)});
-        gguf_fill_sym(tensor, weights, scales);
+        fill_by_row_tiles(tensor, rows, {weights, scales}, fill_sym, release);
         w[base + ".weight"] = weights;
         w[base + ".scales"] = scales;
         break;
@@ -567,7 +654,7 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
         // Symmetric, i8 weights + f16 scales (group 16).
         ov::Tensor weights(ov::element::i8, ov::Shape{rows, cols});
         ov::Tensor scales(ov::element::f16, ov::Shape{rows, sub_blocks_per_row(16)});
-        gguf_fill_sym(tensor, weights, scales);
+        fill_by_row_tiles(tensor, rows, {weights, scales}, fill_sym, release);
         w[base + ".weight"] = weights;
         w[base + ".scales"] = scales;
         break;
@@ -576,7 +663,7 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
         // Symmetric, i4 weights (2/byte) + f16 scales (group 16).
         ov::Tensor weights(ov::element::i4, ov::Shape{rows, cols});
         ov::Tensor scales(ov::element::f16, ov::Shape{rows, sub_blocks_per_row(16)});
-        gguf_fill_sym(tensor, weights, scales);
+        fill_by_row_tiles(tensor, rows, {weights, scales}, fill_sym, release);
         w[base + ".weight"] = weights;
         w[base + ".scales"] = scales;
         break;
@@ -587,7 +674,7 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
         ov::Tensor weights(ov::element::u32, ov::Shape{rows, cols / 8});
         ov::Tensor scales(ov::element::f16, ov::Shape{rows, sub_blocks_per_row(32)});
         ov::Tensor zp(zp_type, ov::Shape{rows, sub_blocks_per_row(32)});
-        gguf_fill_asym(tensor, weights, scales, zp);
+        fill_by_row_tiles(tensor, rows, {weights, scales, zp}, fill_asym, release);
         w[base + ".weight"] = weights;
         w[base + ".scales"] = scales;
         w[base + ".zp"] = zp;
@@ -599,7 +686,7 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
         ov::Tensor weights(ov::element::i8, ov::Shape{rows, cols});
         ov::Tensor scales(ov::element::f16, ov::Shape{rows, sub_blocks_per_row(32)});
         ov::Tensor zp(zp_type, ov::Shape{rows, sub_blocks_per_row(32)});
-        gguf_fill_asym(tensor, weights, scales, zp);
+        fill_by_row_tiles(tensor, rows, {weights, scales, zp}, fill_asym, release);
         w[base + ".weight"] = weights;
         w[base + ".scales"] = scales;
         w[base + ".zp"] = zp;
@@ -610,7 +697,7 @@ std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
         ov::Tensor weights(ov::element::u2, ov::Shape{rows, cols});
         ov::Tensor scales(ov::element::f16, ov::Shape{rows, sub_blocks_per_row(16)});
         ov::Tensor zp(zp_type, ov::Shape{rows, sub_blocks_per_row(16)});
-        gguf_fill_asym(tensor, weights, scales, zp);
+        fill_by_row_tiles(tensor, rows, {weights, scales, zp}, fill_asym, release);
         w[base + ".weight"] = weights;
         w[base + ".scales"] = scales;
         w[base + ".zp"] = zp;
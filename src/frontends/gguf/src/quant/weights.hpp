@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -29,6 +30,10 @@ std::shared_ptr<ov::Node> make_weight_node(const std::string& base,
                                            const std::unordered_map<std::string, ov::Tensor>& weights,
                                            const std::unordered_map<std::string, gguf_tensor_type>& qtypes);
 
+// Callback through which make_weight_node hands back the packed source bytes it has finished
+// converting: [offset, offset + size) is a byte range of `data` that is no longer read.
+using WeightDataRelease = std::function<void(size_t offset, size_t size)>;
+
 // Build the OpenVINO weight node directly from the raw GGUF weight bytes, as provided by a
 // decoder (e.g. wrapping llama.cpp's tensor->data). `data` holds the bytes exactly as ggml
 // laid them out; `quant_type` is the ggml type name ("F16", "F32", "BF16", "Q4_0", "Q4_K",
@@ -40,12 +45,23 @@ std::shared_ptr<ov::Node> make_weight_node(const std::string& base,
 // `name` is the gguf tensor name (e.g. "token_embd.weight", "blk.0.ffn_down.weight"). It is
 // used to decide channel-wise requantization to Q8_0_C for the embedding / output / Q6_K /
 // Q5_K tensors, matching the llama.cpp ggml-openvino backend's CPU/GPU weight pipeline.
+//
+// Quantized weights are converted in row tiles of a few MiB of packed bytes. When `release` is
+// set, it is called for every tile right after the tile has been unpacked, so a file-backed
+// decoder can drop the tile's source pages before the next tile is touched; the peak footprint of
+// a load then stays close to the converted size instead of packed + converted. Non-quantized
+// weights are zero-copy views of `data` and are never released.
 std::shared_ptr<ov::Node> make_weight_node(const ov::Tensor& data,
                                            const std::string& quant_type,
                                            const ov::Shape& logical_shape,
-                                           const std::string& name = "");
+                                           const std::string& name = "",
+                                           const WeightDataRelease& release = {});
 
 // Map a ggml quant type name (e.g. "Q4_K") to its gguf_tensor_type id. Throws if unknown.
 gguf_tensor_type gguf_type_from_name(const std::string& quant_type);
 
+// Inverse of gguf_type_from_name: the canonical ggml type name of a gguf_tensor_type id
+// ("TYPE_<id>" for a type the frontend has no name for; make_weight_node rejects it).
+std::string gguf_type_name(gguf_tensor_type type);
+
 }  // namespace ov::frontend::gguf
@@ -0,0 +1,314 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// Tests for the native .gguf file path (GgufFile + GgufFileDecoder).
+//
+// A tiny GGUF v3 file is written byte by byte (header, KV metadata, tensor infos, aligned tensor
+// data), then parsed by GgufFile and loaded through FrontEnd::load(path). The weights must be
+// surfaced as model outputs with the right values, and non-quantized weights must be zero-copy
+// views into the file mapping.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "file_decoder.hpp"
+#include "gguf_file.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "openvino/frontend/gguf/frontend.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/pass/constant_folding.hpp"
+#include "openvino/pass/manager.hpp"
+
+using namespace ov::frontend::gguf;
+
+namespace {
+
+// Minimal GGUF v3 writer: enough of the format to exercise the reader.
+class GgufWriter {
+public:
+    void kv_string(const std::string& key, const std::string& value) {
+        put_string(m_kv, key);
+        put<uint32_t>(m_kv, GGUF_VALUE_TYPE_STRING);
+        put_string(m_kv, value);
+        ++m_kv_count;
+    }
+
+    void kv_u32(const std::string& key, uint32_t value) {
+        put_string(m_kv, key);
+        put<uint32_t>(m_kv, GGUF_VALUE_TYPE_UINT32);
+        put<uint32_t>(m_kv, value);
+        ++m_kv_count;
+    }
+
+    void kv_f32_array(const std::string& key, const std::vector<float>& values) {
+        put_string(m_kv, key);
+        put<uint32_t>(m_kv, GGUF_VALUE_TYPE_ARRAY);
+        put<uint32_t>(m_kv, GGUF_VALUE_TYPE_FLOAT32);
+        put<uint64_t>(m_kv, values.size());
+        for (float v : values) {
+            put<float>(m_kv, v);
+        }
+        ++m_kv_count;
+    }
+
+    // `depth` arrays nested in each other, the innermost one is an empty u32 array.
+    void kv_nested_array(const std::string& key, size_t depth) {
+        put_string(m_kv, key);
+        put<uint32_t>(m_kv, GGUF_VALUE_TYPE_ARRAY);
+        for (size_t i = 1; i < depth; ++i) {
+            put<uint32_t>(m_kv, GGUF_VALUE_TYPE_ARRAY);
+            put<uint64_t>(m_kv, 1);
+        }
+        put<uint32_t>(m_kv, GGUF_VALUE_TYPE_UINT32);
+        put<uint64_t>(m_kv, 0);
+        ++m_kv_count;
+    }
+
+    // `dims` in GGUF order (fastest-varying first).
+    void tensor(const std::string& name,
+                const std::vector<uint64_t>& dims,
+                gguf_tensor_type type,
+                const std::vector<uint8_t>& bytes) {
+        while (m_data.size() % kAlignment) {
+            m_data.push_back(0);
+        }
+        put_string(m_infos, name);
+        put<uint32_t>(m_infos, static_cast<uint32_t>(dims.size()));
+        for (auto d : dims) {
+            put<uint64_t>(m_infos, d);
+        }
+        put<uint32_t>(m_infos, type);
+        put<uint64_t>(m_infos, m_data.size());
+        m_data.insert(m_data.end(), bytes.begin(), bytes.end());
+        ++m_tensor_count;
+    }
+
+    std::vector<uint8_t> bytes() const {
+        std::vector<uint8_t> out;
+        put<uint32_t>(out, 0x46554747);
+        put<uint32_t>(out, 3);
+        put<uint64_t>(out, m_tensor_count);
+        put<uint64_t>(out, m_kv_count);
+        out.insert(out.end(), m_kv.begin(), m_kv.end());
+        out.insert(out.end(), m_infos.begin(), m_infos.end());
+        while (out.size() % kAlignment) {
+            out.push_back(0);
+        }
+        out.insert(out.end(), m_data.begin(), m_data.end());
+        return out;
+    }
+
+    void write(const std::string& path) const {
+        const auto data = bytes();
+        std::ofstream f(path, std::ios::binary);
+        f.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+private:
+    static constexpr size_t kAlignment = 32;
+
+    template <typename T>
+    static void put(std::vector<uint8_t>& buf, T value) {
+        const auto* p = reinterpret_cast<const uint8_t*>(&value);
+        buf.insert(buf.end(), p, p + sizeof(T));
+    }
+
+    static void put_string(std::vector<uint8_t>& buf, const std::string& s) {
+        put<uint64_t>(buf, s.size());
+        buf.insert(buf.end(), s.begin(), s.end());
+    }
+
+    std::vector<uint8_t> m_kv, m_infos, m_data;
+    uint64_t m_kv_count = 0, m_tensor_count = 0;
+};
+
+template <typename T>
+std::vector<uint8_t> to_bytes(const std::vector<T>& values) {
+    std::vector<uint8_t> out(values.size() * sizeof(T));
+    std::memcpy(out.data(), values.data(), out.size());
+    return out;
+}
+
+// One Q8_0 block per row: f16 scale 0.5 followed by 32 i8 quants q = i - 16.
+std::vector<uint8_t> make_q8_0_rows(size_t rows) {
+    std::vector<uint8_t> out;
+    for (size_t r = 0; r < rows; ++r) {
+        const uint16_t d = ov::float16(0.5f).to_bits();
+        out.push_back(static_cast<uint8_t>(d & 0xFF));
+        out.push_back(static_cast<uint8_t>(d >> 8));
+        for (int i = 0; i < 32; ++i) {
+            out.push_back(static_cast<uint8_t>(static_cast<int8_t>(i - 16)));
+        }
+    }
+    return out;
+}
+
+class GGUFFileTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_path = ov::test::utils::generateTestFilePrefix() + "_model.gguf";
+        for (int i = 0; i < 2 * 32; ++i) {
+            m_f32.push_back(0.25f * static_cast<float>(i));
+        }
+        for (int i = 0; i < 32; ++i) {
+            m_f16.push_back(ov::float16(static_cast<float>(i) - 3.0f));
+        }
+        GgufWriter writer;
+        writer.kv_string("general.architecture", "llama");
+        writer.kv_u32("llama.embedding_length", 64);
+        writer.kv_u32("llama.attention.head_count", 4);
+        writer.kv_f32_array("test.array", {1.0f, 2.0f, 3.0f});
+        writer.tensor("a.weight", {32, 2}, GGUF_TYPE_F32, to_bytes(m_f32));
+        writer.tensor("b.weight", {32}, GGUF_TYPE_F16, to_bytes(m_f16));
+        writer.tensor("c.weight", {32, 2}, GGUF_TYPE_Q8_0, make_q8_0_rows(2));
+        writer.write(m_path);
+    }
+
+    void TearDown() override {
+        ov::test::utils::removeFile(m_path);
+    }
+
+    std::string m_path;
+    std::vector<float> m_f32;
+    std::vector<ov::float16> m_f16;
+};
+
+std::vector<float> folded_values(const std::shared_ptr<ov::Model>& model, size_t idx) {
+    auto node = model->get_results()[idx]->get_input_node_shared_ptr(0);
+    auto cnst = std::dynamic_pointer_cast<ov::op::v0::Constant>(node);
+    EXPECT_NE(cnst, nullptr) << "output " << idx << " did not fold to a Constant";
+    return cnst ? cnst->cast_vector<float>() : std::vector<float>{};
+}
+
+}  // namespace
+
+TEST_F(GGUFFileTest, ParsesHeaderMetadataAndTensors) {
+    ASSERT_TRUE(GgufFile::is_supported(m_path));
+    GgufFile file(m_path);
+    EXPECT_EQ(file.get_version(), 3u);
+    EXPECT_EQ(file.get_alignment(), 32u);
+
+    const auto& meta = file.get_metadata();
+    ASSERT_EQ(std::get<std::string>(meta.at("general.architecture")), "llama");
+    const auto& embedding = std::get<ov::Tensor>(meta.at("llama.embedding_length"));
+    EXPECT_EQ(embedding.get_element_type(), ov::element::u32);
+    EXPECT_EQ(*embedding.data<const uint32_t>(), 64u);
+    const auto& array = std::get<ov::Tensor>(meta.at("test.array"));
+    ASSERT_EQ(array.get_shape(), ov::Shape{3});
+    EXPECT_EQ(array.data<const float>()[2], 3.0f);
+
+    ASSERT_EQ(file.get_tensor_names(), (std::vector<std::string>{"a.weight", "b.weight", "c.weight"}));
+    const auto* a = file.find_tensor("a.weight");
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(GgufFile::get_logical_shape(*a), (ov::Shape{2, 32}));
+    EXPECT_EQ(a->bsize, m_f32.size() * sizeof(float));
+    EXPECT_EQ(std::memcmp(a->weights_data, m_f32.data(), a->bsize), 0);
+    const auto* c = file.find_tensor("c.weight");
+    ASSERT_NE(c, nullptr);
+    EXPECT_EQ(c->bsize, 2u * 34u);
+    EXPECT_EQ(file.find_tensor("missing"), nullptr);
+}
+
+TEST_F(GGUFFileTest, LoadsWeightsFromFile) {
+    auto fe = std::make_shared<FrontEnd>();
+    ASSERT_TRUE(fe->supported(m_path));
+    auto input_model = fe->load(m_path);
+    ASSERT_NE(input_model, nullptr);
+    auto model = fe->convert(input_model);
+    ASSERT_EQ(model->get_results().size(), 3u);
+    EXPECT_EQ(model->get_results()[0]->get_output_partial_shape(0), (ov::PartialShape{2, 32}));
+    EXPECT_EQ(model->get_results()[1]->get_output_partial_shape(0), (ov::PartialShape{32}));
+
+    // F32 weights are not copied: the Constant wraps the mapped file bytes directly.
+    auto file = std::make_shared<GgufFile>(m_path);
+    std::shared_ptr<GgufDecoder> decoder = std::make_shared<GgufFileDecoder>(file);
+    auto direct = fe->convert(fe->load(decoder));
+    auto a_const =
+        std::dynamic_pointer_cast<ov::op::v0::Constant>(direct->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_NE(a_const, nullptr);
+    EXPECT_EQ(a_const->get_data_ptr(), file->find_tensor("a.weight")->weights_data);
+
+    ov::pass::Manager pm;
+    pm.register_pass<ov::pass::ConstantFolding>();
+    pm.run_passes(model);
+
+    EXPECT_EQ(folded_values(model, 0), m_f32);
+    const auto b = folded_values(model, 1);
+    ASSERT_EQ(b.size(), m_f16.size());
+    for (size_t i = 0; i < b.size(); ++i) {
+        EXPECT_EQ(b[i], static_cast<float>(m_f16[i]));
+    }
+    const auto c = folded_values(model, 2);
+    ASSERT_EQ(c.size(), 64u);
+    for (size_t i = 0; i < c.size(); ++i) {
+        EXPECT_EQ(c[i], 0.5f * (static_cast<float>(i % 32) - 16.0f)) << "index " << i;
+    }
+}
+
+TEST_F(GGUFFileTest, RopeConfigFromMetadata) {
+    GgufFileDecoder decoder(std::make_shared<GgufFile>(m_path));
+    const auto config = decoder.get_attribute("rope_config").as<RopeConfig>();
+    EXPECT_EQ(config.n_dims, 16);
+    EXPECT_EQ(config.freq_base, 10000.0f);
+    EXPECT_EQ(config.freq_scale, 1.0f);
+}
+
+TEST(GGUFFile, RejectsTruncatedFile) {
+    const auto path = ov::test::utils::generateTestFilePrefix() + "_truncated.gguf";
+    {
+        GgufWriter writer;
+        writer.kv_string("general.architecture", "llama");
+        auto bytes = writer.bytes();
+        bytes.resize(bytes.size() - 4);
+        std::ofstream f(path, std::ios::binary);
+        f.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+    EXPECT_ANY_THROW(GgufFile{path});
+    ov::test::utils::removeFile(path);
+}
+
+TEST(GGUFFile, RejectsOverflowingTensorSize) {
+    // 2^32 x 2^32 elements wraps the element count to 0, which would pass the bounds check of the mapping
+    const auto path = ov::test::utils::generateTestFilePrefix() + "_overflow.gguf";
+    GgufWriter writer;
+    writer.kv_string("general.architecture", "llama");
+    writer.tensor("a.weight", {uint64_t{1} << 32, uint64_t{1} << 32}, GGUF_TYPE_F32, {});
+    writer.write(path);
+    EXPECT_ANY_THROW(GgufFile{path});
+    ov::test::utils::removeFile(path);
+}
+
+TEST(GGUFFile, SkipsNestedMetadataArrays) {
+    const auto path = ov::test::utils::generateTestFilePrefix() + "_nested.gguf";
+    GgufWriter writer;
+    writer.kv_string("general.architecture", "llama");
+    writer.kv_nested_array("test.nested", 4);
+    writer.kv_u32("llama.embedding_length", 64);
+    writer.write(path);
+    {
+        GgufFile file(path);
+        const auto& meta = file.get_metadata();
+        EXPECT_TRUE(std::holds_alternative<std::monostate>(meta.at("test.nested")));
+        EXPECT_EQ(*std::get<ov::Tensor>(meta.at("llama.embedding_length")).data<const uint32_t>(), 64u);
+    }
+    ov::test::utils::removeFile(path);
+}
+
+TEST(GGUFFile, RejectsDeeplyNestedMetadataArrays) {
+    // every level is recursed into while the value is skipped, the depth must be bounded before the stack is
+    const auto path = ov::test::utils::generateTestFilePrefix() + "_deep.gguf";
+    GgufWriter writer;
+    writer.kv_string("general.architecture", "llama");
+    writer.kv_nested_array("test.nested", 100000);
+    writer.write(path);
+    EXPECT_ANY_THROW(GgufFile{path});
+    ov::test::utils::removeFile(path);
+}
@@ -13,10 +13,14 @@
 
 #include <cmath>
 #include <cstring>
+#include <utility>
+#include <vector>
 
 #include "op_test_utils.hpp"
+#include "quant/weights.hpp"
 
 using namespace ov_gguf_test;
+using ov::frontend::gguf::WeightDataRelease;
 
 namespace {
 
@@ -91,6 +95,57 @@ INSTANTIATE_TEST_SUITE_P(AllQuantTypes,
                              return std::string(i.param.stem);
                          });
 
+// A decoder-provided "data_release" callback is handed back every packed byte exactly once, after
+// the bytes have been converted, and the converted weight is unchanged.
+TEST(GGUFWeightRelease, QuantizedSourceIsReleasedAfterConversion) {
+    const auto qbytes = load_npy<uint8_t>("q4_k_qbytes");
+    const auto ref = load_npy<float>("q4_k_deq");
+    std::vector<std::pair<size_t, size_t>> released;
+    WeightDataRelease release = [&](size_t offset, size_t size) {
+        released.emplace_back(offset, size);
+    };
+
+    auto model = SingleOpBuilder()
+                     .op("GGML_OP_NONE")
+                     .output("w", ov::element::f32, {kRows, kCols})
+                     .attr<ov::Tensor>("data", bytes_to_u8_tensor(qbytes))
+                     .attr<std::string>("quant_type", "Q4_K")
+                     .attr<WeightDataRelease>("data_release", release)
+                     .build();
+
+    size_t next = 0;
+    for (const auto& range : released) {
+        EXPECT_EQ(range.first, next);
+        next += range.second;
+    }
+    EXPECT_EQ(next, qbytes.size());
+
+    auto out = run_on_cpu(model, {});
+    ASSERT_EQ(out.get_size(), ref.size());
+    const float* a = out.data<float>();
+    for (size_t i = 0; i < ref.size(); ++i)
+        ASSERT_NEAR(a[i], ref[i], kTolIntZp) << "index " << i;
+}
+
+// A non-quantized weight is a zero-copy view of the decoder bytes and is never released.
+TEST(GGUFWeightRelease, PlainWeightIsNotReleased) {
+    std::vector<float> vals{1.0f, -2.0f, 3.5f, -4.25f};
+    ov::Tensor data(ov::element::u8, ov::Shape{vals.size() * sizeof(float)});
+    std::memcpy(data.data(), vals.data(), data.get_byte_size());
+    bool called = false;
+
+    SingleOpBuilder()
+        .op("GGML_OP_NONE")
+        .output("w", ov::element::f32, {2, 2})
+        .attr<ov::Tensor>("data", data)
+        .attr<std::string>("quant_type", "F32")
+        .attr<WeightDataRelease>("data_release", [&](size_t, size_t) {
+            called = true;
+        })
+        .build();
+    EXPECT_FALSE(called);
+}
+
 // An F16 weight is wrapped directly as a constant (no dequant); round-trips the raw bytes.
 TEST(GGUFWeightPlain, F16) {
     std::vector<ov::float16> vals{1.0f, -2.0f, 3.5f, -4.25f, 0.0f, 7.0f};
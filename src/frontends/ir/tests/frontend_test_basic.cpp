@@ -1833,3 +1833,39 @@ TEST_F(IRFrontendTests, VeryShortValidModel) {
     OV_ASSERT_NO_THROW(version = model->get_rt_info().at("version").as<int64_t>());
     ASSERT_EQ(11, version);
 }
+
+TEST_F(IRFrontendTests, model_with_many_constants) {
+    // more constants than in one chunk of the parallel layers parsing
+    constexpr size_t constants_count = 300;
+    std::shared_ptr<ov::Model> modelRef;
+    {
+        auto parameter = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 4});
+        parameter->set_friendly_name("input");
+        ov::Output<ov::Node> output = parameter;
+        for (size_t i = 0; i < constants_count; ++i) {
+            auto constant = ov::opset1::Constant::create(ov::element::f32,
+                                                         ov::Shape{1, 4},
+                                                         {1.f * i, 2.f * i, 3.f * i, 4.f * i});
+            constant->set_friendly_name("constant_" + std::to_string(i));
+            auto add = std::make_shared<ov::opset1::Add>(output, constant);
+            add->set_friendly_name("add_" + std::to_string(i));
+            output = add;
+        }
+        auto result = std::make_shared<ov::opset1::Result>(output);
+        result->set_friendly_name("output");
+        modelRef = std::make_shared<ov::Model>(ov::OutputVector{result}, ov::ParameterVector{parameter});
+    }
+    ov::save_model(modelRef, xmlFileName, false);
+
+    std::shared_ptr<ov::Model> model;
+    OV_ASSERT_NO_THROW(model = core.read_model(xmlFileName, binFileName));
+    ASSERT_TRUE(!!model);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(model, modelRef);
+    EXPECT_TRUE(res.valid) << res.message;
+}
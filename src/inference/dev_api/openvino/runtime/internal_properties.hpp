@@ -61,6 +61,13 @@ static constexpr Property<std::string, PropertyMutability::WO> config_device_id{
  */
 static constexpr Property<int32_t, PropertyMutability::RW> threads_per_stream{"THREADS_PER_STREAM"};
 
+/**
+ * @brief Gives every thread of a CPU streams executor its own task queue and lets idle streams steal tasks queued to
+ * other streams of the same NUMA node, instead of pulling all the tasks from a single shared queue
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> streams_work_stealing{"STREAMS_WORK_STEALING"};
+
 /**
  * @brief It contains compiled_model_runtime_properties information to make plugin runtime can check whether it is
  * compatible with the cached compiled model, the result is returned by get_property() calling.
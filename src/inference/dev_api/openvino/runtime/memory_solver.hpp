@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <map>
+#include <utility>
 #include <vector>
 
 #include "openvino/core/except.hpp"
@@ -67,6 +68,17 @@ public:
         int64_t id;
     };
 
+    /** @brief Box placement strategy used by solve(). Both place the biggest boxes first. */
+    enum class Strategy {
+        /** Start each box at the bottom and lift it above every intersecting box until it fits. */
+        POPUP,
+        /**
+         * Place each box into the tightest gap left between the already placed boxes whose live time
+         * intersects with it, or on top of them if no gap is big enough (greedy by size, best fit).
+         */
+        BEST_FIT,
+    };
+
     /** @brief Performes inplace normalization of the input boxes
         @return lifespan of all boxes
     */
@@ -110,7 +122,9 @@ public:
         return ts_f - rm_ts_f;
     }
 
-    explicit MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+    explicit MemorySolver(const std::vector<Box>& boxes, Strategy strategy = Strategy::POPUP)
+        : _boxes(boxes),
+          _strategy(strategy) {
         // TODO: add validation of data correctness:
         // 1. Box.start >= 0 and Box.finish >= -1
         // 2. Box.finish >= Box.start (except Box.finish == -1)
@@ -134,6 +148,39 @@ public:
      * @return Size of common memory blob required for storing all
      */
     int64_t solve() {
+        return _strategy == Strategy::BEST_FIT ? solve_best_fit() : solve_popup();
+    }
+
+    /** Provides calculated offset for specified box id */
+    int64_t get_offset(int id) const {
+        auto res = _offsets.find(id);
+        if (res == _offsets.end())
+            OPENVINO_THROW("There are no box for provided ID");
+        return res->second;
+    }
+
+    /** Additional info. Max sum of box sizes required for any time stamp. */
+    int64_t max_depth() {
+        if (_depth == -1)
+            calc_depth();
+        return _depth;
+    }
+    /** Additional info. Max num of boxes required for any time stamp. */
+    int64_t max_top_depth() {
+        if (_top_depth == -1)
+            calc_depth();
+        return _top_depth;
+    }
+
+private:
+    std::vector<Box> _boxes;
+    Strategy _strategy;
+    std::map<int64_t, int64_t> _offsets;
+    int64_t _top_depth = -1;
+    int64_t _depth = -1;
+    int _time_duration = -1;
+
+    int64_t solve_popup() {
         max_top_depth();  // at first make sure that we no need more for boxes sorted by box.start
         std::vector<std::vector<const Box*>> time_slots(_time_duration);
         for (auto& slot : time_slots)
@@ -176,33 +223,57 @@ public:
         return _min_required;
     }
 
-    /** Provides calculated offset for specified box id */
-    int64_t get_offset(int id) const {
-        auto res = _offsets.find(id);
-        if (res == _offsets.end())
-            OPENVINO_THROW("There are no box for provided ID");
-        return res->second;
-    }
+    int64_t solve_best_fit() {
+        max_top_depth();  // the depth is calculated on boxes sorted by box.start
+        // Biggest first, longest living first among equally sized ones. The stable sort keeps the rest
+        // of the ties in execution order.
+        std::stable_sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) {
+            return l.size > r.size || (l.size == r.size && l.finish - l.start > r.finish - r.start);
+        });
 
-    /** Additional info. Max sum of box sizes required for any time stamp. */
-    int64_t max_depth() {
-        if (_depth == -1)
-            calc_depth();
-        return _depth;
-    }
-    /** Additional info. Max num of boxes required for any time stamp. */
-    int64_t max_top_depth() {
-        if (_top_depth == -1)
-            calc_depth();
-        return _top_depth;
-    }
+        std::vector<std::vector<size_t>> time_slots(_time_duration);  // indexes of placed boxes per time stamp
+        std::vector<int64_t> offsets(_boxes.size());
+        std::vector<size_t> visited(_boxes.size(), 0);  // dedups boxes spanning several slots
+        std::vector<std::pair<int64_t, int64_t>> busy;  // [begin, end) of the intersecting boxes
 
-private:
-    std::vector<Box> _boxes;
-    std::map<int64_t, int64_t> _offsets;
-    int64_t _top_depth = -1;
-    int64_t _depth = -1;
-    int _time_duration = -1;
+        int64_t _min_required = 0;
+
+        for (size_t i_box = 0; i_box < _boxes.size(); i_box++) {
+            const Box& box = _boxes[i_box];
+            busy.clear();
+            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
+                for (size_t placed : time_slots[i_slot]) {
+                    if (visited[placed] != i_box + 1) {
+                        visited[placed] = i_box + 1;
+                        busy.emplace_back(offsets[placed], offsets[placed] + _boxes[placed].size);
+                    }
+                }
+            }
+            std::sort(busy.begin(), busy.end());
+
+            // pick the smallest gap the box fits in, the top of the busy intervals otherwise
+            int64_t top = 0;
+            int64_t best_offset = -1;
+            int64_t best_gap = 0;
+            for (const auto& interval : busy) {
+                const int64_t gap = interval.first - top;
+                if (gap >= box.size && (best_offset == -1 || gap < best_gap)) {
+                    best_offset = top;
+                    best_gap = gap;
+                }
+                top = std::max(top, interval.second);
+            }
+            offsets[i_box] = best_offset == -1 ? top : best_offset;
+
+            for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
+                time_slots[i_slot].push_back(i_box);
+
+            _min_required = std::max(_min_required, offsets[i_box] + box.size);
+            _offsets[box.id] = offsets[i_box];
+        }
+
+        return _min_required;
+    }
 
     void calc_depth() {
         int64_t top_depth = 0;
@@ -4,12 +4,22 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "openvino/core/weight_sharing_util.hpp"
 #include "openvino/runtime/icache_manager.hpp"
 #include "openvino/runtime/tlv_format.hpp"
 #include "openvino/util/ov_version.hpp"
 
 namespace ov::runtime {
+/**
+ * @brief Append-only cache storage keeping all entries in a single file.
+ *
+ * The file may be shared by several processes. Writers serialize their appends with an exclusive lock on a sidecar
+ * "<file>.lock" file and close every append with a Commit record; readers never lock. Only records followed by a
+ * Commit record are indexed, so a torn append (a writer crashed or threw mid-record) stays invisible and is overwritten
+ * by the next append. An instance picks up entries appended by other processes when a lookup misses its index.
+ */
 class SingleFileStorage final : public ICacheManager, public IContextStore {
 public:
     /** @brief Current version of the single file storage format. */
@@ -19,6 +29,7 @@ public:
         String = 0x02,
         Blob = 0x03,
         BlobMap = 0x04,
+        Commit = 0x05,
         ConstantMeta = 0x10,
         WeightSource = 0x11,
     };
@@ -77,7 +88,16 @@ private:
     };
     std::unordered_map<BlobIdType, BlobInfo> m_blob_index;
     std::shared_ptr<wsh::Context> m_shared_context;
-    bool build_content_index(std::ifstream& stream);
+    /** @brief File offset just past the last committed record: the index covers everything before it. */
+    uint64_t m_committed_end;
+    /** @brief Whether the file has any Commit record. Files without one are indexed entirely (legacy layout). */
+    bool m_has_commits;
+    mutable std::mutex m_mutex;
+
+    bool build_content_index(std::istream& stream);
+    bool refresh_content_index();
+    std::fstream open_for_append();
+    void commit_append(std::fstream& stream);
 
     static BlobIdType convert_blob_id(const std::string& blob_id);
     void write_blob_entry(std::fstream& stream, BlobIdType blob_id, StreamWriter& writer);
@@ -9,8 +9,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -24,6 +27,9 @@ namespace threading {
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
  *        It uses custom threads to pull tasks from single queue.
+ *        In the work stealing mode (see ov::internal::streams_work_stealing) every stream thread has its own task
+ *        queue instead, and takes tasks from the queues of the other streams of the same NUMA node when its own
+ *        queue is empty.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -32,6 +38,17 @@ public:
      */
     using Ptr = std::shared_ptr<CPUStreamsExecutor>;
 
+    /**
+     * @brief Task queue counters of a stream thread in the work stealing mode
+     */
+    struct QueueStatistics {
+        int numa_node_id = 0;     //!< NUMA node of the stream, tasks are stolen only within it
+        size_t depth = 0;         //!< Number of tasks currently waiting in the queue of the stream
+        uint64_t executed = 0;    //!< Number of tasks executed by the stream
+        uint64_t stolen = 0;      //!< Number of executed tasks taken from the queues of other streams
+        uint64_t overflowed = 0;  //!< Number of tasks that did not fit the queue and went to the NUMA node one
+    };
+
     /**
      * @brief Constructor
      * @param config Stream executor parameters
@@ -59,6 +76,12 @@ public:
 
     void cpu_reset() override;
 
+    /**
+     * @brief Returns task queue counters of every stream thread
+     * @return The counters in the stream threads order, or an empty vector if the work stealing mode is off
+     */
+    std::vector<QueueStatistics> get_queue_statistics();
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
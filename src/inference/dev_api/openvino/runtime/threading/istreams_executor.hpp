@@ -95,6 +95,7 @@ public:
         int _sub_streams = 0;
         std::vector<int> _rank = {};
         bool _add_lock = true;
+        bool _work_stealing = false;  //!< Whether stream threads have own task queues and steal from each other
 
         /**
          * @brief Get and reserve cpu ids based on configuration and hardware information,
@@ -209,6 +210,9 @@ public:
         std::vector<int> get_rank() const {
             return _rank;
         }
+        bool get_work_stealing() const {
+            return _work_stealing;
+        }
         StreamsMode get_sub_stream_mode() const {
             const auto proc_type_table = get_proc_type_table();
             int sockets = proc_type_table.size() > 1 ? static_cast<int>(proc_type_table.size()) - 1 : 1;
@@ -218,7 +222,8 @@ public:
         bool operator==(const Config& config) {
             if (_name == config._name && _streams == config._streams &&
                 _threads_per_stream == config._threads_per_stream &&
-                _thread_preferred_core_type == config._thread_preferred_core_type && _rank == config._rank) {
+                _thread_preferred_core_type == config._thread_preferred_core_type && _rank == config._rank &&
+                _work_stealing == config._work_stealing) {
                 return true;
             } else {
                 return false;
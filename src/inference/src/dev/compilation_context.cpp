@@ -13,12 +13,11 @@
 
 #include "itt.hpp"
 #include "openvino/core/memory_util.hpp"
+#include "openvino/core/model_hash.hpp"
 #include "openvino/core/parallel.hpp"
-#include "openvino/pass/manager.hpp"
 #include "openvino/runtime/compilation_context.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
-#include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -75,16 +74,13 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
 
     OPENVINO_ASSERT(model);
 
-    uint64_t seed = 0;
-    // 1. Calculate hash on function, skipping weights if model path is provided
-    ov::pass::Manager m;
-    m.register_pass<ov::pass::Hash>(seed, !model_path.empty());
-    m.run_passes(std::const_pointer_cast<ov::Model>(model));
+    // 1. Calculate structural hash of the model, skipping weights if model path is provided
+    uint64_t seed = ov::util::compute_model_hash(*model, !model_path.empty());
 
-    // 2. Compute hash on serialized data and options
+    // 2. Add compile options
     seed = hash_combine_options(seed, compile_options);
 
-    // 3. Add runtime information which may not be serialized
+    // 3. Add runtime information which is not covered by the structural hash
     for (const auto& op : model->get_ordered_ops()) {
         // Skip runtime attributes which are not hash-able
         for (const auto& [name, attribute] : op->get_rt_info()) {
@@ -7,6 +7,8 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -391,11 +393,23 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = std::move(numaNodes);
         }
+        if (_config.get_work_stealing()) {
+            for (auto streamId = 0; streamId < streams_num; ++streamId) {
+                _workers.emplace_back(new Worker);
+            }
+        }
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             if (_config.get_cpu_reservation()) {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
                 _cpu_ids_all.insert(_cpu_ids_all.end(), processor_ids[streamId].begin(), processor_ids[streamId].end());
             }
+            if (!_workers.empty()) {
+                _threads.emplace_back([this, streamId] {
+                    openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
+                    WorkStealingLoop(streamId);
+                });
+                continue;
+            }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
                 for (bool stopped = false; !stopped;) {
@@ -416,9 +430,226 @@ struct CPUStreamsExecutor::Impl {
                 }
             });
         }
+        if (!_workers.empty()) {
+            // stealing domains are known only once every thread has created its stream
+            std::unique_lock<std::mutex> lock(_mutex);
+            _queueCondVar.wait(lock, [&] {
+                return _registeredWorkers == _workers.size();
+            });
+            for (auto& worker : _workers) {
+                auto& node = _numaNodes[worker->_numaNodeId];
+                if (!node) {
+                    node.reset(new NumaNode);
+                }
+                node->_workers.push_back(worker.get());
+                worker->_node = node.get();
+            }
+            _workersReady = true;
+            _queueCondVar.notify_all();
+        }
+    }
+
+    // Bounded lock free multi-producer multi-consumer task queue (D. Vyukov's algorithm). Every cell carries a
+    // sequence number which tells producers whether the cell is free to be written, and consumers whether it is ready
+    // to be read, so pushing and popping a task costs one compare-and-swap on the queue position.
+    class TaskRing {
+    public:
+        explicit TaskRing(size_t capacity) : _cells(capacity), _mask(capacity - 1) {
+            OPENVINO_ASSERT(capacity > 0 && (capacity & _mask) == 0, "TaskRing capacity must be a power of two");
+            for (size_t i = 0; i < capacity; ++i) {
+                _cells[i]._sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool push(Task& task) {
+            Cell* cell = nullptr;
+            size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &_cells[pos & _mask];
+                const size_t seq = cell->_sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                if (diff == 0) {
+                    if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;  // full
+                } else {
+                    pos = _enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            cell->_task = std::move(task);
+            cell->_sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool pop(Task& task) {
+            Cell* cell = nullptr;
+            size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &_cells[pos & _mask];
+                const size_t seq = cell->_sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+                if (diff == 0) {
+                    if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;  // empty
+                } else {
+                    pos = _dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            task = std::move(cell->_task);
+            cell->_task = nullptr;
+            cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        size_t size() const {
+            const size_t dequeued = _dequeuePos.load(std::memory_order_relaxed);
+            const size_t enqueued = _enqueuePos.load(std::memory_order_relaxed);
+            return enqueued > dequeued ? enqueued - dequeued : 0;
+        }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> _sequence{0};
+            Task _task;
+        };
+
+        std::vector<Cell> _cells;
+        const size_t _mask;
+        alignas(64) std::atomic<size_t> _enqueuePos{0};
+        alignas(64) std::atomic<size_t> _dequeuePos{0};
+    };
+
+    // Work stealing mode state. Each stream thread owns a worker queue, the worker queues of the streams pinned to the
+    // same NUMA node form a stealing domain.
+    struct NumaNode;
+    struct Worker {
+        TaskRing _queue{256};
+        NumaNode* _node = nullptr;
+        int _numaNodeId = 0;
+        std::atomic<uint64_t> _executed{0};
+        std::atomic<uint64_t> _stolen{0};
+        std::atomic<uint64_t> _overflowed{0};
+    };
+    struct NumaNode {
+        std::vector<Worker*> _workers;
+        std::atomic<int64_t> _pending{0};  // tasks queued to the node and not yet taken
+        std::atomic<int> _sleepers{0};
+        std::mutex _mutex;
+        std::condition_variable _condVar;
+        std::queue<Task> _overflowQueue;  // tasks that did not fit the worker queues, guarded by _mutex
+    };
+
+    void WorkStealingLoop(int workerId) {
+        auto& worker = *_workers[workerId];
+        auto stream = _streams->local();
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            worker._numaNodeId = stream->_numaNodeId;
+            ++_registeredWorkers;
+            _queueCondVar.notify_all();
+            _queueCondVar.wait(lock, [&] {
+                return _workersReady;
+            });
+        }
+        t_worker = {this, &worker};
+        auto& node = *worker._node;
+        for (;;) {
+            Task task;
+            bool stolen = false;
+            if (!worker._queue.pop(task)) {
+                stolen = Steal(worker, task);
+            }
+            if (!task) {
+                std::unique_lock<std::mutex> lock(node._mutex);
+                if (!node._overflowQueue.empty()) {
+                    task = std::move(node._overflowQueue.front());
+                    node._overflowQueue.pop();
+                } else {
+                    // pending tasks which are not visible yet are being pushed or taken right now, so retry
+                    ++node._sleepers;
+                    node._condVar.wait(lock, [&] {
+                        return node._pending.load() > 0 || _workStealingStopped.load();
+                    });
+                    --node._sleepers;
+                    if (node._pending.load() == 0 && _workStealingStopped.load()) {
+                        break;
+                    }
+                    continue;
+                }
+            }
+            --node._pending;
+            worker._executed.fetch_add(1, std::memory_order_relaxed);
+            if (stolen) {
+                worker._stolen.fetch_add(1, std::memory_order_relaxed);
+            }
+            Execute(task, *stream);
+        }
+        t_worker = {};
+    }
+
+    bool Steal(const Worker& thief, Task& task) {
+        const auto& victims = thief._node->_workers;
+        // start from the next neighbour, so the thieves of a domain do not all hit the same queue
+        const auto self = std::find(victims.begin(), victims.end(), &thief) - victims.begin();
+        for (size_t i = 1; i < victims.size(); ++i) {
+            if (victims[(self + i) % victims.size()]->_queue.pop(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void EnqueueToWorker(Task task) {
+        // The least loaded queue wins, the round robin start spreads the ties. A stream never queues to itself: it may
+        // be going to wait for the task, and the task would be stuck if no other stream of the node could steal it.
+        const Worker* self = t_worker.first == this ? t_worker.second : nullptr;
+        const size_t start = _nextWorker.fetch_add(1);
+        Worker* worker = nullptr;
+        for (size_t i = 0; i < _workers.size(); ++i) {
+            auto* candidate = _workers[(start + i) % _workers.size()].get();
+            if (candidate != self && (!worker || candidate->_queue.size() < worker->_queue.size())) {
+                worker = candidate;
+            }
+        }
+        if (!worker) {
+            worker = _workers.front().get();
+        }
+        auto& node = *worker->_node;
+        if (!worker->_queue.push(task)) {
+            worker->_overflowed.fetch_add(1, std::memory_order_relaxed);
+            std::lock_guard<std::mutex> lock(node._mutex);
+            node._overflowQueue.push(std::move(task));
+        }
+        ++node._pending;
+        if (node._sleepers.load() > 0) {
+            {
+                // orders the notification after a sleeper that has not seen the task yet started waiting
+                std::lock_guard<std::mutex> lock(node._mutex);
+            }
+            node._condVar.notify_one();
+        }
+    }
+
+    void StopWorkers() {
+        _workStealingStopped = true;
+        for (auto& node : _numaNodes) {
+            {
+                std::lock_guard<std::mutex> lock(node.second->_mutex);
+            }
+            node.second->_condVar.notify_all();
+        }
     }
 
     void Enqueue(Task task) {
+        if (!_workers.empty()) {
+            EnqueueToWorker(std::move(task));
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -500,8 +731,18 @@ struct CPUStreamsExecutor::Impl {
     bool _isExit = false;
     std::vector<int> _cpu_ids_all;
     std::mutex _cpu_ids_mutex;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::map<int, std::unique_ptr<NumaNode>> _numaNodes;
+    size_t _registeredWorkers = 0;
+    bool _workersReady = false;
+    std::atomic<bool> _workStealingStopped{false};
+    std::atomic<size_t> _nextWorker{0};
+    static thread_local std::pair<const Impl*, Worker*> t_worker;
 };
 
+thread_local std::pair<const CPUStreamsExecutor::Impl*, CPUStreamsExecutor::Impl::Worker*>
+    CPUStreamsExecutor::Impl::t_worker = {};
+
 CPUStreamsExecutor::Impl::CustomThreadLocal::ThreadCleaner::ResourceKeeper
     CPUStreamsExecutor::Impl::CustomThreadLocal::ThreadCleaner::global_resource_holder;
 
@@ -538,6 +779,21 @@ std::vector<int> CPUStreamsExecutor::get_rank() {
     return stream->_rank;
 }
 
+std::vector<CPUStreamsExecutor::QueueStatistics> CPUStreamsExecutor::get_queue_statistics() {
+    std::vector<QueueStatistics> statistics;
+    statistics.reserve(_impl->_workers.size());
+    for (const auto& worker : _impl->_workers) {
+        QueueStatistics record;
+        record.numa_node_id = worker->_numaNodeId;
+        record.depth = worker->_queue.size();
+        record.executed = worker->_executed.load(std::memory_order_relaxed);
+        record.stolen = worker->_stolen.load(std::memory_order_relaxed);
+        record.overflowed = worker->_overflowed.load(std::memory_order_relaxed);
+        statistics.push_back(record);
+    }
+    return statistics;
+}
+
 void CPUStreamsExecutor::cpu_reset() {
     {
         std::lock_guard<std::mutex> lock(_impl->_cpu_ids_mutex);
@@ -556,6 +812,7 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
         _impl->_isStopped = true;
     }
     _impl->_queueCondVar.notify_all();
+    _impl->StopWorkers();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
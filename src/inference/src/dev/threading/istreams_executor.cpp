@@ -63,6 +63,8 @@ void IStreamsExecutor::Config::set_property(const ov::AnyMap& property) {
             _threads = val_i;
         } else if (key == ov::internal::threads_per_stream) {
             _threads_per_stream = static_cast<int>(value.as<size_t>());
+        } else if (key == ov::internal::streams_work_stealing) {
+            _work_stealing = value.as<bool>();
         } else {
             OPENVINO_THROW("Not recognized property key ", key);
         }
@@ -83,6 +85,8 @@ ov::Any IStreamsExecutor::Config::get_property(const std::string& key) const {
         return decltype(ov::inference_num_threads)::value_type{_threads};
     } else if (key == ov::internal::threads_per_stream) {
         return decltype(ov::internal::threads_per_stream)::value_type{_threads_per_stream};
+    } else if (key == ov::internal::streams_work_stealing) {
+        return decltype(ov::internal::streams_work_stealing)::value_type{_work_stealing};
     } else {
         OPENVINO_THROW("Wrong value for property key ", key);
     }
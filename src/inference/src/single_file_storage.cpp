@@ -4,12 +4,27 @@
 
 #include "openvino/runtime/single_file_storage.hpp"
 
+#include <optional>
+
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/mmap_object.hpp"
 #include "openvino/util/parallel_read_streambuf.hpp"
 #include "openvino/util/variant_visitor.hpp"
 
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <unistd.h>
+
+#    include <cerrno>
+#endif
+
 namespace ov::runtime {
 
 namespace {
@@ -54,6 +69,84 @@ bool read_tlv_string(std::istream& stream, std::string& str) {
     }
 }
 
+constexpr uint64_t version_header_size = 3 * sizeof(uint16_t);  // major, minor, patch
+constexpr uint64_t tlv_header_size = sizeof(TLVTraits::TagType) + sizeof(TLVTraits::LengthType);
+
+/**
+ * @brief Writes a Commit record holding its own file offset and returns the offset just past it.
+ * The self offset lets a reader tell a real Commit record from leftovers of a torn append.
+ */
+uint64_t write_commit_record(std::ostream& stream) {
+    const auto position = static_cast<uint64_t>(stream.tellp());
+    write_tlv_record(stream,
+                     static_cast<TLVTraits::TagType>(SingleFileStorage::Tag::Commit),
+                     sizeof(position),
+                     reinterpret_cast<const char*>(&position));
+    return position + tlv_header_size + sizeof(position);
+}
+
+std::filesystem::path lock_file_path(const std::filesystem::path& path) {
+    auto lock_path = path;
+    lock_path += ".lock";
+    return lock_path;
+}
+
+/**
+ * @brief Exclusive inter-process lock on a sidecar file, held for the lifetime of the object.
+ * The lock belongs to the open file description, so it also serializes several storages of one process.
+ */
+class FileLock {
+public:
+    explicit FileLock(const std::filesystem::path& path) {
+#ifdef _WIN32
+        m_handle = CreateFileW(path.c_str(),
+                               GENERIC_READ | GENERIC_WRITE,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr,
+                               OPEN_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL,
+                               nullptr);
+        OPENVINO_ASSERT(m_handle != INVALID_HANDLE_VALUE, "Failed to open lock file ", path);
+        OVERLAPPED overlapped{};
+        if (!LockFileEx(m_handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+            CloseHandle(m_handle);
+            OPENVINO_THROW("Failed to lock ", path);
+        }
+#else
+        m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+        OPENVINO_ASSERT(m_fd != -1, "Failed to open lock file ", path);
+        int rc = 0;
+        while ((rc = ::flock(m_fd, LOCK_EX)) == -1 && errno == EINTR) {
+        }
+        if (rc == -1) {
+            ::close(m_fd);
+            OPENVINO_THROW("Failed to lock ", path);
+        }
+#endif
+    }
+
+    ~FileLock() {
+#ifdef _WIN32
+        OVERLAPPED overlapped{};
+        UnlockFileEx(m_handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+        CloseHandle(m_handle);
+#else
+        ::flock(m_fd, LOCK_UN);
+        ::close(m_fd);
+#endif
+    }
+
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+
+private:
+#ifdef _WIN32
+    HANDLE m_handle;
+#else
+    int m_fd;
+#endif
+};
+
 void write_padding(std::ostream& stream, uint64_t alignment) {
     const uint64_t padding_pos = static_cast<uint64_t>(stream.tellp()) + sizeof(SingleFileStorage::PadSizeType);
     auto aligned_pos = padding_pos + alignment - 1;
@@ -76,21 +169,33 @@ const size_t SingleFileStorage::blob_alignment = []() {
 SingleFileStorage::SingleFileStorage(const std::filesystem::path& path)
     : m_file_path{path},
       m_blob_index{},
-      m_shared_context{std::make_shared<wsh::Context>()} {
+      m_shared_context{std::make_shared<wsh::Context>()},
+      m_committed_end{version_header_size},
+      m_has_commits{false} {
     util::create_directory_recursive(m_file_path.parent_path());
-    if (!util::file_exists(m_file_path)) {
-        std::ofstream stream(m_file_path, std::ios::binary);
-        write_version(stream, m_version);
-    } else {
-        std::ifstream stream(m_file_path, std::ios::binary);
-        util::Version file_version{0, 0, 0};
-        read_version(stream, file_version);
-        validate_version(file_version);
+    const auto has_header = [this] {
+        std::error_code ec;
+        return util::file_exists(m_file_path) && std::filesystem::file_size(m_file_path, ec) > 0 && !ec;
+    };
+    if (!has_header()) {
+        // Another process may be creating the same file right now; only one of them writes the header.
+        FileLock file_lock(lock_file_path(m_file_path));
+        if (!has_header()) {
+            std::ofstream stream(m_file_path, std::ios::binary);
+            write_version(stream, m_version);
+            return;
+        }
     }
+    std::ifstream stream(m_file_path, std::ios::binary);
+    util::Version file_version{0, 0, 0};
+    read_version(stream, file_version);
+    validate_version(file_version);
 }
 
-bool SingleFileStorage::build_content_index(std::ifstream& stream) {
-    const auto blob_reader = [this](std::istream& s, TLVTraits::LengthType size) {
+bool SingleFileStorage::build_content_index(std::istream& stream) {
+    // Records are applied to the index only once the Commit record closing their append has been read.
+    std::vector<std::function<void()>> pending;
+    const auto blob_reader = [this, &pending](std::istream& s, TLVTraits::LengthType size) {
         if (size == 0) {
             return true;
         }
@@ -114,11 +219,13 @@ bool SingleFileStorage::build_content_index(std::ifstream& stream) {
         if (!s.good()) {
             return false;
         }
-        m_blob_index[id].offset = static_cast<uint64_t>(blob_data_pos);
-        m_blob_index[id].size = static_cast<uint64_t>(blob_data_size);
+        pending.emplace_back([this, id, blob_data_pos, blob_data_size] {
+            m_blob_index[id].offset = static_cast<uint64_t>(blob_data_pos);
+            m_blob_index[id].size = static_cast<uint64_t>(blob_data_size);
+        });
         return true;
     };
-    const auto blob_map_reader = [this](std::istream& s, TLVTraits::LengthType size) {
+    const auto blob_map_reader = [this, &pending](std::istream& s, TLVTraits::LengthType size) {
         if (size == 0) {
             return true;
         }
@@ -131,13 +238,15 @@ bool SingleFileStorage::build_content_index(std::ifstream& stream) {
             return false;
         }
         if (std::string model_name; read_tlv_string(s, model_name)) {
-            m_blob_index[id].model_name = std::move(model_name);
+            pending.emplace_back([this, id, model_name = std::move(model_name)] {
+                m_blob_index[id].model_name = model_name;
+            });
             return true;
         } else {
             return false;
         }
     };
-    const auto constant_meta_reader = [this](std::istream& s, TLVTraits::LengthType size) {
+    const auto constant_meta_reader = [this, &pending](std::istream& s, TLVTraits::LengthType size) {
         if (size == 0) {
             return true;
         }
@@ -161,14 +270,16 @@ bool SingleFileStorage::build_content_index(std::ifstream& stream) {
             s.read(reinterpret_cast<char*>(&const_size), sizeof(const_size));
             s.read(reinterpret_cast<char*>(&const_type), sizeof(const_type));
             if (s.good()) {
-                m_shared_context->m_weight_registry[source_id][const_id] = {static_cast<size_t>(const_offset),
-                                                                            static_cast<size_t>(const_size),
-                                                                            element::Type_t{const_type}};
+                pending.emplace_back([this, source_id, const_id, const_offset, const_size, const_type] {
+                    m_shared_context->m_weight_registry[source_id][const_id] = {static_cast<size_t>(const_offset),
+                                                                                static_cast<size_t>(const_size),
+                                                                                element::Type_t{const_type}};
+                });
             }
         }
         return s.good();
     };
-    const auto weight_source_reader = [this](std::istream& s, TLVTraits::LengthType size) {
+    const auto weight_source_reader = [this, &pending](std::istream& s, TLVTraits::LengthType size) {
         if (size == 0) {
             return true;
         }
@@ -189,17 +300,90 @@ bool SingleFileStorage::build_content_index(std::ifstream& stream) {
             return false;
         }
         const auto weight_size = size - header_size - padding_size;
-        m_shared_context->m_cache_sources[source_id] = {};
+        pending.emplace_back([this, source_id] {
+            m_shared_context->m_cache_sources[source_id] = {};
+        });
         s.seekg(weight_size, std::ios::cur);
         return s.good();
     };
+    const auto commit_reader = [this, &pending](std::istream& s, TLVTraits::LengthType size) {
+        const auto record_pos = static_cast<uint64_t>(s.tellg()) - tlv_header_size;
+        uint64_t position = 0;
+        if (size != sizeof(position)) {
+            return false;
+        }
+        s.read(reinterpret_cast<char*>(&position), sizeof(position));
+        if (!s.good() || position != record_pos) {
+            return false;
+        }
+        for (const auto& apply : pending) {
+            apply();
+        }
+        pending.clear();
+        m_committed_end = record_pos + tlv_header_size + size;
+        m_has_commits = true;
+        return true;
+    };
     const TLVValueScanner scanners = {
         {static_cast<TLVTraits::TagType>(Tag::Blob), blob_reader},
         {static_cast<TLVTraits::TagType>(Tag::BlobMap), blob_map_reader},
         {static_cast<TLVTraits::TagType>(Tag::ConstantMeta), constant_meta_reader},
         {static_cast<TLVTraits::TagType>(Tag::WeightSource), weight_source_reader},
+        {static_cast<TLVTraits::TagType>(Tag::Commit), commit_reader},
     };
-    return scan_tlv_records(stream, scanners);
+    const auto scan_begin = stream.tellg();
+    const auto scan_end = stream.seekg(0, std::ios::end).tellg();
+    stream.seekg(scan_begin);
+    const bool scanned = scan_tlv_records(stream, scanners);
+    if (m_has_commits) {
+        // Anything past the last Commit record is an append still in progress or a torn one: not an error.
+        return true;
+    }
+    // Legacy layout without Commit records: every record counts and the whole file must be well formed.
+    if (!scanned) {
+        return false;
+    }
+    for (const auto& apply : pending) {
+        apply();
+    }
+    m_committed_end = static_cast<uint64_t>(scan_end);
+    return true;
+}
+
+bool SingleFileStorage::refresh_content_index() {
+    std::ifstream stream(m_file_path, std::ios::binary);
+    if (!stream.good()) {
+        return false;
+    }
+    stream.seekg(static_cast<std::streamoff>(m_committed_end));
+    return stream.good() && build_content_index(stream);
+}
+
+std::fstream SingleFileStorage::open_for_append() {
+    std::fstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::out);
+    OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for writing");
+    // Appends start at the committed end: whatever follows it is left over from a torn append.
+    stream.seekp(static_cast<std::streamoff>(m_committed_end));
+    if (!m_has_commits) {
+        // From now on only committed records count, so a torn append of this writer cannot corrupt the file.
+        m_committed_end = write_commit_record(stream);
+        m_has_commits = true;
+    }
+    return stream;
+}
+
+void SingleFileStorage::commit_append(std::fstream& stream) {
+    // The records must reach the file before the Commit record that publishes them to other readers.
+    stream.flush();
+    const auto committed_end = write_commit_record(stream);
+    stream.close();
+    OPENVINO_ASSERT(!stream.fail(), "Failed to commit append to cache file ", m_file_path);
+    m_committed_end = committed_end;
+    // Drop the tail of an earlier torn append that was longer than this one.
+    std::error_code ec;
+    if (std::filesystem::file_size(m_file_path, ec) > committed_end && !ec) {
+        std::filesystem::resize_file(m_file_path, committed_end, ec);
+    }
 }
 
 SingleFileStorage::BlobIdType SingleFileStorage::convert_blob_id(const std::string& blob_id) {
@@ -240,9 +424,23 @@ void SingleFileStorage::write_blob_entry(std::fstream& stream, BlobIdType blob_i
 
 void SingleFileStorage::write_cache_entry(const std::string& blob_id, StreamWriter writer) {
     ScopedLocale plocal_C(LC_ALL, "C");
-    std::fstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
-    OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for writing blob id ", blob_id);
-    write_blob_entry(stream, convert_blob_id(blob_id), writer);
+    const auto id = convert_blob_id(blob_id);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    OPENVINO_ASSERT(!has_blob_id(id), "Blob with id ", id, " already exists in cache.");
+
+    FileLock file_lock(lock_file_path(m_file_path));
+    refresh_content_index();
+    if (has_blob_id(id)) {
+        return;  // Stored by another process meanwhile
+    }
+    auto stream = open_for_append();
+    write_blob_entry(stream, id, writer);
+    try {
+        commit_append(stream);
+    } catch (...) {
+        m_blob_index.erase(id);
+        throw;
+    }
 }
 
 void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable_mmap, StreamReader reader) {
@@ -250,8 +448,14 @@ void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable
 
     const auto cid = convert_blob_id(blob_id);
 
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!has_blob_id(cid)) {
+        // The entry may have been appended by another process since the index was built.
+        refresh_content_index();
+    }
     if (std::filesystem::exists(m_file_path) && has_blob_id(cid)) {
-        const auto& [blob_pos, blob_size, model_name] = m_blob_index[cid];
+        const auto [blob_pos, blob_size, model_name] = m_blob_index[cid];
+        lock.unlock();
         if (enable_mmap) {
             CompiledBlobVariant compiled_blob{std::in_place_index<0>,
                                               read_tensor_data(m_file_path,
@@ -272,12 +476,24 @@ void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable
 void SingleFileStorage::remove_cache_entry(const std::string& id) {}
 
 std::shared_ptr<wsh::Context> SingleFileStorage::get_context() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return m_shared_context;
 }
 
 void SingleFileStorage::write_context(const weight_sharing::Context& context) {
     ScopedLocale plocal_C(LC_ALL, "C");
-    std::ofstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::ate);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    FileLock file_lock(lock_file_path(m_file_path));
+    refresh_content_index();
+
+    // Opened on first use: a context without new entries leaves the file untouched.
+    std::optional<std::fstream> append_stream;
+    const auto stream = [&]() -> std::fstream& {
+        if (!append_stream) {
+            append_stream.emplace(open_for_append());
+        }
+        return *append_stream;
+    };
 
     weight_sharing::WeightRegistry delta_weight_registry;
     for (const auto& [source_id, const_meta_map] : context.m_weight_registry) {
@@ -305,7 +521,7 @@ void SingleFileStorage::write_context(const weight_sharing::Context& context) {
                 m_shared_context->m_weight_registry[source_id][const_id] = props;
             }
         };
-        write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::ConstantMeta), const_meta_writer);
+        write_tlv_record(stream(), static_cast<TLVTraits::TagType>(Tag::ConstantMeta), const_meta_writer);
     }
 
     weight_sharing::WeightSourceRegistry delta_cache_sources;
@@ -318,7 +534,7 @@ void SingleFileStorage::write_context(const weight_sharing::Context& context) {
         const auto& source_id = cache_registry.first;
         const auto& weight_buffer = cache_registry.second;
         if (auto weights = weight_buffer.m_weights.lock()) {
-            write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::WeightSource), [&](std::ostream& s) {
+            write_tlv_record(stream(), static_cast<TLVTraits::TagType>(Tag::WeightSource), [&](std::ostream& s) {
                 const auto device_id = static_cast<uint64_t>(std::strtoul(weight_buffer.m_device.c_str(), nullptr, 10));
                 s.write(reinterpret_cast<const char*>(&device_id), sizeof(device_id));
                 s.write(reinterpret_cast<const char*>(&source_id), sizeof(source_id));
@@ -329,12 +545,17 @@ void SingleFileStorage::write_context(const weight_sharing::Context& context) {
         }
     }
 
+    if (append_stream) {
+        commit_append(*append_stream);
+    }
+
     for (const auto& [source_id, buffer] : context.m_runtime_sources) {
         m_shared_context->m_runtime_sources.emplace(source_id, buffer);
     }
 }
 
 void SingleFileStorage::initialize(std::shared_ptr<ov::wsh::Context> weight_sharing_context) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (weight_sharing_context) {
         m_shared_context = std::move(weight_sharing_context);
     }
@@ -343,6 +564,8 @@ void SingleFileStorage::initialize(std::shared_ptr<ov::wsh::Context> weight_shar
         util::Version file_version;
         read_version(stream, file_version);
         OPENVINO_ASSERT(util::is_version_compatible(m_version, file_version), "Incompatible cache format");
+        m_committed_end = version_header_size;
+        m_has_commits = false;
         OPENVINO_ASSERT(build_content_index(stream), "The cache file may be corrupted or in an unsupported format");
     }
 }
@@ -9,6 +9,7 @@
 
 #include "common_test_utils/test_assertions.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 
@@ -217,6 +218,66 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
 
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
+static std::shared_ptr<CPUStreamsExecutor> makeWorkStealingExecutor(int streams) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1};
+    config.set_property(ov::internal::streams_work_stealing.name(), true);
+    return std::make_shared<CPUStreamsExecutor>(config);
+}
+
+TEST(CPUStreamsExecutorWorkStealingTests, idleStreamStealsTasksOfBlockedStream) {
+    auto taskExecutor = makeWorkStealingExecutor(2);
+    std::mutex mutex_block_emulation;
+    std::condition_variable cv_block_emulation;
+    bool isBlocked = true;
+    auto blocked = async(taskExecutor, [&] {
+        std::unique_lock<std::mutex> lock(mutex_block_emulation);
+        cv_block_emulation.wait(lock, [&isBlocked] {
+            return !isBlocked;
+        });
+    });
+
+    // some of the tasks are queued to the blocked stream, they can only complete if the other stream steals them
+    std::vector<Future> futures;
+    for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE * 4; i++) {
+        futures.emplace_back(async(taskExecutor, [] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }));
+    }
+    for (auto& f : futures) {
+        ASSERT_EQ(std::future_status::ready, f.wait_for(std::chrono::seconds(10)));
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_block_emulation);
+        isBlocked = false;
+    }
+    cv_block_emulation.notify_all();
+    blocked.wait();
+
+    const auto statistics = taskExecutor->get_queue_statistics();
+    ASSERT_EQ(statistics.size(), 2u);
+    uint64_t executed = 0, stolen = 0;
+    for (const auto& stream : statistics) {
+        executed += stream.executed;
+        stolen += stream.stolen;
+        EXPECT_EQ(stream.depth, 0u);
+    }
+    EXPECT_EQ(executed, futures.size() + 1);
+    EXPECT_GT(stolen, 0u);
+}
+
+TEST(CPUStreamsExecutorWorkStealingTests, noQueueStatisticsWithSharedQueue) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2, 1});
+    EXPECT_TRUE(taskExecutor->get_queue_statistics().empty());
+}
+
+TEST(CPUStreamsExecutorWorkStealingTests, configProperty) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 2, 1};
+    EXPECT_FALSE(config.get_property(ov::internal::streams_work_stealing.name()).as<bool>());
+    config.set_property(ov::internal::streams_work_stealing.name(), true);
+    EXPECT_TRUE(config.get_work_stealing());
+    EXPECT_FALSE(config == IStreamsExecutor::Config("TestCPUStreamsExecutor", 2, 1));
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = get_number_of_cpu_cores();
@@ -236,6 +297,10 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
     },
+    [] {
+        auto streams = get_number_of_cpu_cores();
+        return makeWorkStealingExecutor(streams);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     });
@@ -260,6 +325,10 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
+    },
+    [] {
+        auto streams = get_number_of_cpu_cores();
+        return makeWorkStealingExecutor(streams);
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
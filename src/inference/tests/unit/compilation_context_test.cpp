@@ -18,6 +18,7 @@
 #include "openvino/op/constant.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/subtract.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -322,6 +323,48 @@ TEST(NetworkContext, HashWithDifferentResults) {
     ASSERT_EQ(ov::ModelCache::compute_hash(net2, {}), ov::ModelCache::compute_hash(net3, {}));
 }
 
+static std::shared_ptr<ov::Model> create_model_with_weights(int32_t weight) {
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::Shape{4});
+    auto weights = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{4}, {1, 2, 3, weight});
+    auto add = std::make_shared<ov::op::v1::Add>(data, weights);
+    return std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{data});
+}
+
+TEST(NetworkContext, HashWithDifferentWeights) {
+    auto net1 = create_model_with_weights(4);
+    auto net2 = create_model_with_weights(4);
+    auto net3 = create_model_with_weights(5);
+    ASSERT_EQ(ov::ModelCache::compute_hash(net1, {}), ov::ModelCache::compute_hash(net2, {}));
+    ASSERT_NE(ov::ModelCache::compute_hash(net2, {}), ov::ModelCache::compute_hash(net3, {}));
+
+    // weights are not hashed when the model is read from a file
+    const std::filesystem::path model_path{"model.xml"};
+    ASSERT_EQ(ov::ModelCache::compute_hash(net2, model_path, {}), ov::ModelCache::compute_hash(net3, model_path, {}));
+}
+
+TEST(NetworkContext, HashWithDifferentTopology) {
+    auto make_model = [](bool swap_inputs) {
+        auto data1 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2});
+        auto data2 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2});
+        auto sub = swap_inputs ? std::make_shared<ov::op::v1::Subtract>(data2, data1)
+                               : std::make_shared<ov::op::v1::Subtract>(data1, data2);
+        return std::make_shared<ov::Model>(ov::OutputVector{sub}, ov::ParameterVector{data1, data2});
+    };
+    ASSERT_EQ(ov::ModelCache::compute_hash(make_model(false), {}), ov::ModelCache::compute_hash(make_model(false), {}));
+    ASSERT_NE(ov::ModelCache::compute_hash(make_model(false), {}), ov::ModelCache::compute_hash(make_model(true), {}));
+}
+
+TEST(NetworkContext, HashWithDifferentAttributes) {
+    auto make_model = [](ov::op::AutoBroadcastType broadcast) {
+        auto data1 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2});
+        auto data2 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2});
+        auto add = std::make_shared<ov::op::v1::Add>(data1, data2, broadcast);
+        return std::make_shared<ov::Model>(ov::OutputVector{add}, ov::ParameterVector{data1, data2});
+    };
+    ASSERT_NE(ov::ModelCache::compute_hash(make_model(ov::op::AutoBroadcastType::NONE), {}),
+              ov::ModelCache::compute_hash(make_model(ov::op::AutoBroadcastType::NUMPY), {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ov::Model serialization)
 TEST(NetworkContext, HashOfSameMultiThreading) {
     auto net1 = create_simple_model();
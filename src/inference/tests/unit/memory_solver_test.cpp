@@ -336,3 +336,67 @@ TEST(MemSolverTest, BestSolution1) {
         for (int j = i + 1; j < n; j++)
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
+
+// Same boxes as in DISABLED_Unefficiency: best fit puts box 4 into the gap under box 3
+TEST(MemSolverTest, BestFitUnefficiency) {
+    std::vector<Box> boxes{
+        {6, 7, 3},
+        {2, 5, 2},
+        {5, 8, 2},
+        {2, 3, 2},
+    };
+
+    ov::MemorySolver ms(boxes, ov::MemorySolver::Strategy::BEST_FIT);
+    EXPECT_EQ(ms.solve(), 5);
+    EXPECT_EQ(ms.max_depth(), 5);
+}
+
+TEST(MemSolverTest, BestFitOptimalAlexnet) {
+    std::vector<int64_t> sizes{3 * 227 * 227, 96 * 55 * 55, 96 * 55 * 55, 96 * 55 * 55, 96 * 27 * 27, 256 * 27 * 27,
+                               256 * 27 * 27, 256 * 27 * 27, 256 * 13 * 13, 384 * 13 * 13, 384 * 13 * 13,
+                               384 * 13 * 13, 384 * 13 * 13, 256 * 13 * 13, 256 * 13 * 13, 256 * 6 * 6,
+                               4069,          4069,          4069,          4069,          1000,          1000};
+
+    int n = 0;
+    std::vector<Box> boxes;
+    for (auto size : sizes) {
+        boxes.push_back({n, n + 1, size, n});
+        n++;
+    }
+
+    ov::MemorySolver ms(boxes, ov::MemorySolver::Strategy::BEST_FIT);
+    EXPECT_EQ(ms.solve(), ms.max_depth());
+}
+
+TEST(MemSolverTest, BestFitRandomBoxesDoNotOverlap) {
+    std::vector<Box> boxes;
+    uint32_t seed = 42;
+    auto next = [&seed](uint32_t range) {
+        seed = seed * 1664525u + 1013904223u;
+        return static_cast<int>((seed >> 8) % range);
+    };
+    for (int n = 0; n < 200; n++) {
+        const int start = next(100);
+        const int finish = next(10) == 0 ? -1 : start + next(20);
+        boxes.push_back({start, finish, 1 + next(64), n});
+    }
+
+    ov::MemorySolver ms(boxes, ov::MemorySolver::Strategy::BEST_FIT);
+    const int64_t total = ms.solve();
+    EXPECT_GE(total, ms.max_depth());
+
+    auto normalized = boxes;
+    ov::MemorySolver::normalize_boxes(normalized);
+    for (size_t i = 0; i < normalized.size(); i++) {
+        const auto& box1 = normalized[i];
+        const int64_t off1 = ms.get_offset(static_cast<int>(box1.id));
+        ASSERT_LE(off1 + box1.size, total);
+        for (size_t j = i + 1; j < normalized.size(); j++) {
+            const auto& box2 = normalized[j];
+            const int64_t off2 = ms.get_offset(static_cast<int>(box2.id));
+            ASSERT_TRUE(box1.finish < box2.start || box1.start > box2.finish || off1 + box1.size <= off2 ||
+                        off1 >= off2 + box2.size)
+                << "Box overlapping is detected";
+        }
+    }
+}
@@ -6,6 +6,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <thread>
+
 #include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/test_assertions.hpp"
@@ -44,6 +47,7 @@ protected:
     void TearDown() override {
         m_storage.reset();
         std::filesystem::remove(m_file_path);
+        std::filesystem::remove(m_file_path.string() + ".lock");
     }
 };
 
@@ -361,6 +365,110 @@ TEST_F(SingleFileStorageTest, ContextWeightSourceAppendDelta) {
         << "Rewriting the same context should not increase file size";
 }
 
+TEST_F(SingleFileStorageTest, TornAppendIsIgnored) {
+    const std::vector<uint8_t> blob_data(300, 0x5A);
+    const auto blob_writer = [&](std::ostream& s) {
+        s.write(reinterpret_cast<const char*>(blob_data.data()), blob_data.size());
+    };
+    m_storage->write_cache_entry("1", blob_writer);
+    m_storage.reset();
+    {
+        // A writer died in the middle of a blob record: its length is still the placeholder.
+        std::fstream fs(m_file_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
+        const auto tag = static_cast<TLVTraits::TagType>(SingleFileStorage::Tag::Blob);
+        const TLVTraits::LengthType length = 0;
+        const std::vector<char> partial(1000, 0x33);
+        fs.write(reinterpret_cast<const char*>(&tag), sizeof(tag));
+        fs.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        fs.write(partial.data(), partial.size());
+    }
+
+    SingleFileStorage storage{m_file_path};
+    ASSERT_NO_THROW(storage.initialize());
+    bool read_called = false;
+    storage.read_cache_entry("1", false, [&](const ICacheManager::CompiledBlobVariant&) {
+        read_called = true;
+    });
+    EXPECT_TRUE(read_called);
+
+    // The next append overwrites the torn tail, otherwise a rescan would stop in front of it.
+    storage.write_cache_entry("2", blob_writer);
+
+    SingleFileStorage reopened{m_file_path};
+    ASSERT_NO_THROW(reopened.initialize());
+    for (const auto& id : {"1", "2"}) {
+        read_called = false;
+        reopened.read_cache_entry(id, true, [&](const ICacheManager::CompiledBlobVariant& blob) {
+            const auto& tensor = std::get<const ov::Tensor>(blob);
+            ASSERT_EQ(tensor.get_byte_size(), blob_data.size());
+            EXPECT_EQ(std::memcmp(tensor.data(), blob_data.data(), blob_data.size()), 0);
+            read_called = true;
+        });
+        EXPECT_TRUE(read_called) << "blob " << id;
+    }
+}
+
+TEST_F(SingleFileStorageTest, SharedFileSeesOtherWriters) {
+    SingleFileStorage other{m_file_path};
+    other.initialize();
+
+    other.write_cache_entry("7", [](std::ostream& s) {
+        s.put('x');
+    });
+    bool read_called = false;
+    m_storage->read_cache_entry("7", false, [&](const ICacheManager::CompiledBlobVariant&) {
+        read_called = true;
+    });
+    EXPECT_TRUE(read_called) << "entry appended through another storage must be found on lookup";
+
+    other.write_cache_entry("8", [](std::ostream& s) {
+        s.put('y');
+    });
+    const auto size_before = test::utils::fileSize(m_file_path.string());
+    EXPECT_NO_THROW(m_storage->write_cache_entry("8", [](std::ostream& s) {
+        s.put('z');
+    }));
+    EXPECT_EQ(test::utils::fileSize(m_file_path.string()), size_before) << "entry already stored by another writer";
+}
+
+TEST_F(SingleFileStorageTest, ConcurrentWriters) {
+    constexpr size_t writers = 4;
+    constexpr size_t blobs_per_writer = 8;
+    std::vector<std::thread> threads;
+    for (size_t w = 0; w < writers; ++w) {
+        threads.emplace_back([&, w] {
+            SingleFileStorage storage{m_file_path};
+            storage.initialize();
+            for (size_t b = 0; b < blobs_per_writer; ++b) {
+                const auto id = w * blobs_per_writer + b;
+                storage.write_cache_entry(std::to_string(id), [&](std::ostream& s) {
+                    const std::vector<char> data(100 + id, static_cast<char>(id));
+                    s.write(data.data(), data.size());
+                });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    SingleFileStorage reopened{m_file_path};
+    ASSERT_NO_THROW(reopened.initialize());
+    for (size_t id = 0; id < writers * blobs_per_writer; ++id) {
+        bool read_called = false;
+        reopened.read_cache_entry(std::to_string(id), true, [&](const ICacheManager::CompiledBlobVariant& blob) {
+            const auto& tensor = std::get<const ov::Tensor>(blob);
+            ASSERT_EQ(tensor.get_byte_size(), 100 + id);
+            const auto* data = static_cast<const char*>(tensor.data());
+            EXPECT_TRUE(std::all_of(data, data + tensor.get_byte_size(), [&](char c) {
+                return c == static_cast<char>(id);
+            }));
+            read_called = true;
+        });
+        EXPECT_TRUE(read_called) << "blob " << id;
+    }
+}
+
 TEST_F(SingleFileStorageTest, WriterMisposition) {
     OV_EXPECT_THROW(m_storage->write_cache_entry("42",
                                                  [&](std::ostream& s) {
@@ -65,12 +65,21 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                if (workerInferRequest->_adaptive_timeout)
+                    workerInferRequest->_timeout_estimator.on_arrival();
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
                 if (sz == workerInferRequest->_batch_size) {
                     workerInferRequest->_is_wakeup = true;
                     workerInferRequest->_cond.notify_one();
+                } else if (workerInferRequest->_adaptive_timeout) {
+                    // the worker re-evaluates the timeout for the rest of the batch
+                    {
+                        std::lock_guard<std::mutex> lock(workerInferRequest->_mutex);
+                        workerInferRequest->_is_wakeup = true;
+                    }
+                    workerInferRequest->_cond.notify_one();
                 }
             };
             AsyncInferRequest* _this = nullptr;
@@ -112,6 +121,8 @@ std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
     check_state();
     if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->get_profiling_info();
+    else if (SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+        return m_sync_request->m_partial_batch_request->get_profiling_info();
     else
         return m_request_without_batch->get_profiling_info();
 }
@@ -120,8 +131,16 @@ std::vector<ov::SoPtr<ov::IVariableState>> AsyncInferRequest::query_state() cons
     check_state();
     if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->query_state();
-    else
-        return m_request_without_batch->query_state();
+    if (SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status) {
+        const auto& partial_batch_request = m_sync_request->m_partial_batch_request;
+        auto states = partial_batch_request->query_state();
+        for (auto&& state : states) {
+            if (!state._so)
+                state._so = partial_batch_request._so;
+        }
+        return states;
+    }
+    return m_request_without_batch->query_state();
 }
 
 void AsyncInferRequest::infer_thread_unsafe() {
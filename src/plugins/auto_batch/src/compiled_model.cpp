@@ -17,18 +17,52 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::size_t>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>&
+                                 compiled_models_with_partial_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_with_partial_batch(compiled_models_with_partial_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto adaptive = config.find(adaptive_timeout.name());
+    m_adaptive_timeout = adaptive != config.end() && adaptive->second.as<bool>();
+}
+
+void CompiledModel::TimeoutEstimator::on_arrival() {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_last_arrival != std::chrono::steady_clock::time_point{}) {
+        const double interval = std::chrono::duration<double, std::micro>(now - m_last_arrival).count();
+        m_arrival_interval = m_arrival_interval > 0.0 ? 0.75 * m_arrival_interval + 0.25 * interval : interval;
+    }
+    m_last_arrival = now;
+}
+
+void CompiledModel::TimeoutEstimator::on_batch_completed(std::chrono::steady_clock::duration latency) {
+    const double value = std::chrono::duration<double, std::micro>(latency).count();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_batch_latency = m_batch_latency > 0.0 ? 0.75 * m_batch_latency + 0.25 * value : value;
+}
+
+std::chrono::microseconds CompiledModel::TimeoutEstimator::get_timeout(int missing,
+                                                                       std::chrono::microseconds max_timeout) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_arrival_interval <= 0.0)
+        return max_timeout;
+    // the expected time to collect the rest of the batch, with one more interval for the jitter of the arrivals
+    double timeout = (missing + 1) * m_arrival_interval;
+    // waiting longer than a batch executes costs more than executing the collected requests as a partial batch now
+    if (m_batch_latency > 0.0)
+        timeout = std::min(timeout, m_batch_latency);
+    return std::min(max_timeout, std::chrono::microseconds(static_cast<int64_t>(timeout)));
 }
 
 CompiledModel::~CompiledModel() {
@@ -62,13 +96,21 @@ CompiledModel::GetWorkerInferRequest() const {
         workerRequestPtr->_infer_request_batched._ptr = m_compiled_model_with_batch->create_infer_request();
         if (workerRequestPtr->_infer_request_batched._so == nullptr)
             workerRequestPtr->_infer_request_batched._so = m_compiled_model_with_batch._so;
+        for (const auto& partial : m_compiled_models_with_partial_batch) {
+            auto& request = workerRequestPtr->_infer_requests_partial_batch[static_cast<int>(partial.first)];
+            request = {partial.second->create_infer_request(), partial.second._so};
+        }
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        workerRequestPtr->_adaptive_timeout = m_adaptive_timeout;
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                if (workerRequestPtr->_adaptive_timeout)
+                    workerRequestPtr->_timeout_estimator.on_batch_completed(std::chrono::steady_clock::now() -
+                                                                            workerRequestPtr->_batch_start);
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -80,11 +122,30 @@ CompiledModel::GetWorkerInferRequest() const {
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            // the moment the first of the collected requests arrived, for the adaptive timeout
+            std::chrono::steady_clock::time_point collection_start;
             while (1) {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    std::chrono::microseconds time_out = std::chrono::milliseconds(m_time_out);
+                    if (workerRequestPtr->_adaptive_timeout) {
+                        const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
+                        if (sz == 0) {
+                            collection_start = {};
+                        } else {
+                            const auto now = std::chrono::steady_clock::now();
+                            if (collection_start == std::chrono::steady_clock::time_point{})
+                                collection_start = now;
+                            const auto waited =
+                                std::chrono::duration_cast<std::chrono::microseconds>(now - collection_start);
+                            time_out = workerRequestPtr->_timeout_estimator.get_timeout(
+                                workerRequestPtr->_batch_size - sz,
+                                time_out);
+                            time_out = std::max(std::chrono::microseconds(0), time_out - waited);
+                        }
+                    }
+                    status = workerRequestPtr->_cond.wait_for(lock, time_out);
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -104,31 +165,12 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        collection_start = {};
+                        workerRequestPtr->_batch_start = std::chrono::steady_clock::now();
                         workerRequestPtr->_infer_request_batched->start_async();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
-                        std::atomic<int> arrived = {0};
-                        std::promise<void> all_completed;
-                        auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            t.first->m_request_without_batch->set_callback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
-                                    if (p)
-                                        t.first->m_sync_request->m_exception_ptr = p;
-                                    t.second();
-                                    if (sz == ++arrived) {
-                                        all_completed.set_value();
-                                    }
-                                });
-                            t.first->m_sync_request->m_batched_request_status =
-                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
-                            t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
-                            t.first->m_request_without_batch->start_async();
-                        }
-                        all_completed_future.get();
+                        collection_start = {};
+                        execute_timed_out_requests(*workerRequestPtr, sz);
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -138,6 +180,67 @@ CompiledModel::GetWorkerInferRequest() const {
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+void CompiledModel::execute_timed_out_requests(WorkerInferRequest& worker, int sz) const {
+    std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(sz);
+    for (int n = 0; n < sz; n++) {
+        OPENVINO_ASSERT(worker._tasks.try_pop(tasks[n]));
+    }
+    const auto start = std::chrono::steady_clock::now();
+    std::atomic<int> arrived = {0};
+    std::promise<void> all_completed;
+    auto all_completed_future = all_completed.get_future();
+    // the smallest partial batch that fits all the collected requests
+    auto partial = sz > 1 ? worker._infer_requests_partial_batch.lower_bound(sz)
+                          : worker._infer_requests_partial_batch.end();
+    if (partial != worker._infer_requests_partial_batch.end()) {
+        // the collected requests take the first slots of the partial batch, the rest slots are computed for nothing
+        auto& request = partial->second;
+        const auto batch_size = static_cast<size_t>(partial->first);
+        for (size_t n = 0; n < tasks.size(); n++) {
+            tasks[n].first->m_sync_request->copy_inputs_to_partial_batch(request, n, batch_size);
+            tasks[n].first->m_sync_request->m_batched_request_status =
+                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+            tasks[n].first->m_sync_request->m_partial_batch_request = request;
+        }
+        request->set_callback([&tasks, &request, batch_size, &all_completed](std::exception_ptr p) {
+            for (size_t n = 0; n < tasks.size(); n++) {
+                auto& sync_request = tasks[n].first->m_sync_request;
+                if (p) {
+                    sync_request->m_exception_ptr = p;
+                } else {
+                    try {
+                        sync_request->copy_outputs_from_partial_batch(request, n, batch_size);
+                    } catch (...) {
+                        sync_request->m_exception_ptr = std::current_exception();
+                    }
+                }
+                tasks[n].second();
+            }
+            all_completed.set_value();
+        });
+        request->start_async();
+    } else {
+        // no partial batch fits, have to execute the requests in the batch1 mode
+        for (auto& t : tasks) {
+            t.first->m_request_without_batch->set_callback([t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                if (p)
+                    t.first->m_sync_request->m_exception_ptr = p;
+                t.second();
+                if (sz == ++arrived) {
+                    all_completed.set_value();
+                }
+            });
+            t.first->m_sync_request->m_batched_request_status =
+                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+            t.first->m_sync_request->set_tensors_to_another_request(t.first->m_request_without_batch);
+            t.first->m_request_without_batch->start_async();
+        }
+    }
+    all_completed_future.get();
+    if (worker._adaptive_timeout)
+        worker._timeout_estimator.on_batch_completed(std::chrono::steady_clock::now() - start);
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     ov::SoPtr<ov::IAsyncInferRequest> infer_request_without_batch = {
         m_compiled_model_without_batch->create_infer_request(),
@@ -212,7 +315,9 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{partial_batches.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{adaptive_timeout.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
@@ -5,7 +5,10 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <map>
+#include <mutex>
 #include <thread>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
@@ -20,8 +23,26 @@ class AsyncInferRequest;
 
 class CompiledModel : public ov::ICompiledModel {
 public:
+    // Tunes the time to collect a batch by the arrival rate of the requests and the latency of the batches
+    class TimeoutEstimator {
+    public:
+        void on_arrival();
+        void on_batch_completed(std::chrono::steady_clock::duration latency);
+        // time to wait for the `missing` requests of the batch, capped by `max_timeout`
+        std::chrono::microseconds get_timeout(int missing, std::chrono::microseconds max_timeout) const;
+
+    private:
+        mutable std::mutex m_mutex;
+        std::chrono::steady_clock::time_point m_last_arrival;
+        // exponential moving averages, in us, zero until the first sample
+        double m_arrival_interval = 0.0;
+        double m_batch_latency = 0.0;
+    };
+
     struct WorkerInferRequest {
         ov::SoPtr<ov::IAsyncInferRequest> _infer_request_batched;
+        // requests of the smaller batch sizes, to execute the partial batches collected by the timeout
+        std::map<int, ov::SoPtr<ov::IAsyncInferRequest>> _infer_requests_partial_batch;
         int _batch_size;
         ov::threading::ThreadSafeQueueWithSize<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
             _tasks;
@@ -31,6 +52,9 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+        bool _adaptive_timeout = false;
+        TimeoutEstimator _timeout_estimator;
+        std::chrono::steady_clock::time_point _batch_start;
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -41,7 +65,8 @@ public:
                   const std::set<std::size_t>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>>& compiled_models_with_partial_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -68,17 +93,21 @@ protected:
 
     std::pair<std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>, int> GetWorkerInferRequest()
         const;
+    // Executes the `sz` collected requests either as one partial batch or each with batch1
+    void execute_timed_out_requests(WorkerInferRequest& worker, int sz) const;
     mutable std::vector<std::shared_ptr<WorkerInferRequest>> m_worker_requests;
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
     std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    bool m_adaptive_timeout = false;
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    const std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> m_compiled_models_with_partial_batch;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
@@ -12,6 +12,7 @@
 #include "openvino/runtime/intel_gpu/properties.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/util/container_util.hpp"
+#include "openvino/util/log.hpp"
 #include "transformations/common_optimizations/dimension_tracking.hpp"
 #include "transformations/init_node_info.hpp"
 #include "transformations/utils/utils.hpp"
@@ -22,7 +23,9 @@ namespace autobatch_plugin {
 std::vector<ov::PropertyName> supported_configKeys = {
     ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
-    ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW}};
+    ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{partial_batches.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{adaptive_timeout.name(), ov::PropertyMutability::RW}};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
     for (auto&& kvp : user_config) {
@@ -119,6 +122,8 @@ Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
     m_plugin_config.insert(ov::enable_profiling(false));
+    m_plugin_config.insert(partial_batches(false));
+    m_plugin_config.insert(adaptive_timeout(false));
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
@@ -291,6 +296,34 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         }
     }
 
+    std::map<uint32_t, ov::SoPtr<ov::ICompiledModel>> compiled_models_with_partial_batch;
+    if (compiled_model_with_batch && full_properties.at(partial_batches.name()).as<bool>()) {
+        // the buckets are optional, the requests are executed with batch1 when no bucket fits
+        for (uint32_t batch_size = 2; batch_size < meta_device.device_batch_size; batch_size *= 2) {
+            try {
+                auto partial = model->clone();
+                std::map<std::size_t, ov::PartialShape> partial_shapes;
+                const auto inputs = partial->inputs();
+                for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
+                    auto input_shape = inputs[input_id].get_shape();
+                    if (batched_inputs.count(input_id))
+                        input_shape[0] = batch_size;
+                    partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+                }
+                partial->reshape(partial_shapes);
+                compiled_models_with_partial_batch[batch_size] =
+                    context ? core->compile_model(partial, context, device_config_no_auto_batch)
+                            : core->compile_model(partial, device_name, device_config_no_auto_batch);
+            } catch (const ov::Exception& e) {
+                OPENVINO_WARN("Auto-batching: the batch ",
+                              batch_size,
+                              " bucket is not compiled, the partial batches it fits are executed with a bigger bucket "
+                              "or in the batch1 mode: ",
+                              e.what());
+            }
+        }
+    }
+
     ov::SoPtr<ov::IRemoteContext> device_context;
     if (!context) {
         try {
@@ -311,7 +344,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           compiled_models_with_partial_batch);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
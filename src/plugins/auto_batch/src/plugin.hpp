@@ -17,6 +17,18 @@
 namespace ov {
 namespace autobatch_plugin {
 
+/**
+ * @brief Compiles the model for the power-of-two batch sizes below the device batch size as well, so the requests
+ * collected by the time the timeout expires are executed as one partial batch rather than one by one
+ */
+static constexpr ov::Property<bool, ov::PropertyMutability::RW> partial_batches{"AUTO_BATCH_PARTIAL_BATCHES"};
+
+/**
+ * @brief Tunes the time to collect a batch by the observed arrival rate of the requests and the latency of the
+ * batches, ov::auto_batch_timeout is the upper bound
+ */
+static constexpr ov::Property<bool, ov::PropertyMutability::RW> adaptive_timeout{"AUTO_BATCH_ADAPTIVE_TIMEOUT"};
+
 struct DeviceInformation {
     std::string device_name;
     ov::AnyMap device_config;
@@ -108,25 +108,45 @@ void SyncInferRequest::copy_inputs_if_needed() {
     for (const auto& it : get_inputs()) {
         // this request is already in BUSY state, so using the internal functions safely
         auto dst_tensor = m_batched_request_wrapper->_infer_request_batched->get_tensor(it);
-        copy_tensor_if_needed(get_tensor(it), dst_tensor, true);
+        copy_tensor_if_needed(get_tensor(it), dst_tensor, true, m_batch_id, m_batch_size);
+    }
+}
+
+void SyncInferRequest::copy_inputs_to_partial_batch(ov::SoPtr<ov::IAsyncInferRequest>& req,
+                                                    size_t batch_id,
+                                                    size_t batch_size) {
+    for (const auto& it : get_inputs()) {
+        auto dst_tensor = req->get_tensor(it);
+        copy_tensor_if_needed(get_tensor(it), dst_tensor, true, batch_id, batch_size);
+    }
+}
+
+void SyncInferRequest::copy_outputs_from_partial_batch(ov::SoPtr<ov::IAsyncInferRequest>& req,
+                                                       size_t batch_id,
+                                                       size_t batch_size) {
+    for (const auto& it : get_outputs()) {
+        auto dst_tensor = get_tensor(it);
+        copy_tensor_if_needed(req->get_tensor(it), dst_tensor, false, batch_id, batch_size);
     }
 }
 
 void SyncInferRequest::copy_tensor_if_needed(const ov::SoPtr<ov::ITensor>& src,
                                              ov::SoPtr<ov::ITensor>& dst,
-                                             const bool bInput) {
+                                             const bool bInput,
+                                             size_t batch_id,
+                                             size_t batch_size) {
     auto ptrDst = static_cast<char*>(dst->data());
     auto ptrSrc = static_cast<char*>(src->data());
     ptrdiff_t szDst = dst->get_byte_size();
     ptrdiff_t szSrc = src->get_byte_size();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szDst / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szDst / batch_size : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? m_batch_id * szSrc / m_batch_size : 0;
+        ptrdiff_t offset = szSrc != szDst ? batch_id * szSrc / batch_size : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -138,7 +158,11 @@ void SyncInferRequest::copy_outputs_if_needed() {
     for (const auto& it : get_outputs()) {
         // this request is already in BUSY state, so using the internal functions safely
         auto dst_tensor = get_tensor(it);
-        copy_tensor_if_needed(m_batched_request_wrapper->_infer_request_batched->get_tensor(it), dst_tensor, false);
+        copy_tensor_if_needed(m_batched_request_wrapper->_infer_request_batched->get_tensor(it),
+                              dst_tensor,
+                              false,
+                              m_batch_id,
+                              m_batch_size);
     }
 }
 
@@ -67,6 +67,28 @@ INSTANTIATE_TEST_SUITE_P(nightly_GPU_AutoBatching,
                                             ::testing::ValuesIn(num_batch)),
                          AutoBatching_Test_DetectionOutput::getTestCaseName);
 
+// the requests left by the full batches are executed as a partial batch of 2 or 4 (e.g. the 2 remaining of 6 requests
+// with the batch of 4), or in the batch1 mode when no partial batch fits them (3 requests with the batch of 4)
+const std::vector<size_t> num_partial_requests{2, 3, 6};
+const std::vector<size_t> num_partial_batch{4, 8};
+INSTANTIATE_TEST_SUITE_P(smoke_TEMPLATE_AutoBatching,
+                         AutoBatching_Test_PartialBatches,
+                         ::testing::Combine(::testing::Values(ov::test::utils::DEVICE_TEMPLATE),
+                                            ::testing::ValuesIn(get_vs_set),
+                                            ::testing::Values(1),
+                                            ::testing::ValuesIn(num_partial_requests),
+                                            ::testing::ValuesIn(num_partial_batch)),
+                         AutoBatching_Test_PartialBatches::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(nightly_CPU_AutoBatching,
+                         AutoBatching_Test_PartialBatches,
+                         ::testing::Combine(::testing::Values(ov::test::utils::DEVICE_CPU),
+                                            ::testing::ValuesIn(get_vs_set),
+                                            ::testing::ValuesIn(num_streams),
+                                            ::testing::ValuesIn(num_partial_requests),
+                                            ::testing::ValuesIn(num_partial_batch)),
+                         AutoBatching_Test_PartialBatches::getTestCaseName);
+
 const std::vector<ov::AnyMap> default_properties = {
     {ov::auto_batch_timeout(1000)},
 };
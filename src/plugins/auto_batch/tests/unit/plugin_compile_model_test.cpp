@@ -205,6 +205,17 @@ const std::vector<plugin_compile_model_param> plugin_compile_model_param_test =
                                 {ov::intel_gpu::device_total_mem_size.name(), static_cast<uint64_t>(4096000000)}},
                                {{ov::auto_batch_timeout(static_cast<uint32_t>(200))}, {ov::device::priorities("CPU(32)")}},
                                32},
+    // Case 5: the partial batches are compiled in addition, and the timeout is adaptive
+    plugin_compile_model_param{{{ov::hint::performance_mode.name(), ov::hint::PerformanceMode::THROUGHPUT},
+                                {ov::optimal_batch_size.name(), static_cast<unsigned int>(16)},
+                                {ov::hint::num_requests(12)},
+                                {ov::intel_gpu::memory_statistics.name(), static_cast<uint64_t>(1024000)},
+                                {ov::intel_gpu::device_total_mem_size.name(), static_cast<uint64_t>(4096000000)}},
+                               {{ov::auto_batch_timeout(static_cast<uint32_t>(200))},
+                                {ov::device::priorities("CPU(8)")},
+                                {"AUTO_BATCH_PARTIAL_BATCHES", true},
+                                {"AUTO_BATCH_ADAPTIVE_TIMEOUT", true}},
+                               8},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
@@ -62,6 +62,8 @@ const std::vector<get_property_params> get_property_params_test = {
     get_property_params{ov::cache_dir.name(), true},
     get_property_params{ov::hint::performance_mode.name(), true},
     get_property_params{ov::enable_profiling.name(), false},
+    get_property_params{"AUTO_BATCH_PARTIAL_BATCHES", false},
+    get_property_params{"AUTO_BATCH_ADAPTIVE_TIMEOUT", false},
 };
 
 INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests,
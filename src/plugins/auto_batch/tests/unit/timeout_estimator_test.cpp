@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <thread>
+
+#include "mock_common.hpp"
+
+using TimeoutEstimator = CompiledModel::TimeoutEstimator;
+
+TEST(AutoBatchTimeoutEstimatorTest, UsesMaxTimeoutWithoutStatistics) {
+    TimeoutEstimator estimator;
+    EXPECT_EQ(estimator.get_timeout(3, std::chrono::milliseconds(200)), std::chrono::milliseconds(200));
+    // a single arrival gives no interval yet
+    estimator.on_arrival();
+    EXPECT_EQ(estimator.get_timeout(3, std::chrono::milliseconds(200)), std::chrono::milliseconds(200));
+}
+
+TEST(AutoBatchTimeoutEstimatorTest, WaitsForTheMissingRequests) {
+    TimeoutEstimator estimator;
+    estimator.on_arrival();
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    estimator.on_arrival();
+
+    const auto one_missing = estimator.get_timeout(1, std::chrono::seconds(10));
+    const auto many_missing = estimator.get_timeout(7, std::chrono::seconds(10));
+    EXPECT_GE(one_missing, std::chrono::milliseconds(4));
+    EXPECT_GT(many_missing, one_missing);
+    // the user timeout is the upper bound
+    EXPECT_EQ(estimator.get_timeout(7, std::chrono::microseconds(100)), std::chrono::microseconds(100));
+    EXPECT_EQ(estimator.get_timeout(7, std::chrono::microseconds(0)), std::chrono::microseconds(0));
+}
+
+TEST(AutoBatchTimeoutEstimatorTest, DoesNotWaitLongerThanBatchLatency) {
+    TimeoutEstimator estimator;
+    estimator.on_arrival();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    estimator.on_arrival();
+    estimator.on_batch_completed(std::chrono::milliseconds(1));
+
+    EXPECT_EQ(estimator.get_timeout(15, std::chrono::seconds(10)), std::chrono::milliseconds(1));
+}
@@ -4,9 +4,16 @@
 
 #include "async_infer_request.hpp"
 
+#include "compiled_model.hpp"
+
 struct RequestExecutor : ov::threading::ITaskExecutor {
-    explicit RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request) : m_request(request) {
+    RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request,
+                    std::shared_ptr<ov::hetero::CompiledModel::StageStatistics> statistics)
+        : m_request(request),
+          m_statistics(std::move(statistics)) {
         m_request->set_callback([this](std::exception_ptr exception_ptr) mutable {
+            if (m_statistics)
+                m_statistics->on_finish();
             m_exception_ptr = std::move(exception_ptr);
             auto task = std::move(m_task);
             task();
@@ -14,9 +21,12 @@ struct RequestExecutor : ov::threading::ITaskExecutor {
     }
     void run(ov::threading::Task task) override {
         m_task = std::move(task);
+        if (m_statistics)
+            m_statistics->on_start();
         m_request->start_async();
     };
     ov::SoPtr<ov::IAsyncInferRequest>& m_request;
+    std::shared_ptr<ov::hetero::CompiledModel::StageStatistics> m_statistics;
     std::exception_ptr m_exception_ptr;
     ov::threading::Task m_task;
 };
@@ -27,8 +37,15 @@ ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::heter
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
     m_pipeline.clear();
-    for (auto&& request : m_infer_request->m_subrequests) {
-        auto request_executor = std::make_shared<RequestExecutor>(request);
+    // each stage of the pipeline runs a submodel, so while one request runs a submodel the other requests may run the
+    // other ones; the output tensors of a submodel are shared with the inputs of the next ones, nothing is copied
+    const auto& stage_statistics =
+        std::static_pointer_cast<const ov::hetero::CompiledModel>(m_infer_request->get_compiled_model())
+            ->m_stage_statistics;
+    for (size_t i = 0; i < m_infer_request->m_subrequests.size(); i++) {
+        auto& request = m_infer_request->m_subrequests[i];
+        auto request_executor =
+            std::make_shared<RequestExecutor>(request, i < stage_statistics.size() ? stage_statistics[i] : nullptr);
         m_pipeline.emplace_back(request_executor, [request_executor] {
             if (nullptr != request_executor->m_exception_ptr) {
                 std::rethrow_exception(request_executor->m_exception_ptr);
@@ -158,7 +158,8 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         t0 = clock::now();
     }
 
-    const bool add_exclusive = submodels.size() > 1;
+    // the pipelined execution needs the submodels to execute the requests concurrently
+    const bool add_exclusive = submodels.size() > 1 && !m_cfg.pipelined_execution;
     const auto& hetero_plugin = get_hetero_plugin();
     const auto& core = hetero_plugin->get_core();
     const auto& device_properties = m_cfg.get_device_properties();
@@ -231,6 +232,7 @@ void ov::hetero::CompiledModel::compile_model(const std::vector<ov::hetero::Subm
         t_set_io_start = clock::now();
     }
     set_inputs_and_outputs();
+    init_stage_statistics();
     if (perf_logging_enabled) {
         t_set_io_end = clock::now();
         HETERO_PERF_LOG_LEVEL(PerfLogLevel::Summary,
@@ -368,6 +370,42 @@ ov::hetero::CompiledModel::CompiledModel(std::istream& model,
     }
     // clang-format on
     set_inputs_and_outputs();
+    init_stage_statistics();
+}
+
+void ov::hetero::CompiledModel::init_stage_statistics() {
+    m_stage_statistics.clear();
+    if (!m_cfg.pipelined_execution)
+        return;
+    for (size_t i = 0; i < m_compiled_submodels.size(); i++) {
+        m_stage_statistics.push_back(std::make_shared<StageStatistics>());
+    }
+}
+
+void ov::hetero::CompiledModel::StageStatistics::on_start() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_in_flight++ == 0)
+        m_busy_start = std::chrono::steady_clock::now();
+}
+
+void ov::hetero::CompiledModel::StageStatistics::on_finish() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_inferences++;
+    if (--m_in_flight == 0)
+        m_busy_time += std::chrono::steady_clock::now() - m_busy_start;
+}
+
+uint64_t ov::hetero::CompiledModel::StageStatistics::get_inferences() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_inferences;
+}
+
+std::chrono::microseconds ov::hetero::CompiledModel::StageStatistics::get_busy_time() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto busy_time = m_busy_time;
+    if (m_in_flight != 0)
+        busy_time += std::chrono::steady_clock::now() - m_busy_start;
+    return std::chrono::duration_cast<std::chrono::microseconds>(busy_time);
 }
 
 std::shared_ptr<ov::ISyncInferRequest> ov::hetero::CompiledModel::create_sync_infer_request() const {
@@ -427,7 +465,8 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
                                                     ov::optimal_number_of_infer_requests,
                                                     ov::execution_devices,
                                                     ov::loaded_from_cache,
-                                                    ov::hetero::number_of_submodels};
+                                                    ov::hetero::number_of_submodels,
+                                                    ov::hetero::stage_statistics};
         return ro_properties;
     };
 
@@ -436,6 +475,7 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
         add_ro_properties(ov::supported_properties.name(), supported_properties);
         add_ro_properties(ov::device::properties.name(), supported_properties);
         add_ro_properties(ov::device::priorities.name(), supported_properties);
+        add_ro_properties(ov::hetero::pipelined_execution.name(), supported_properties);
         return decltype(ov::supported_properties)::value_type(std::move(supported_properties));
     } else if (ov::device::properties == name) {
         ov::AnyMap all_devices = {};
@@ -457,9 +497,11 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
     } else if (ov::optimal_number_of_infer_requests == name) {
         unsigned int value = 0u;
         for (const auto& comp_model_desc : m_compiled_submodels) {
-            value = std::max(value,
-                             comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
-                                 .as<unsigned int>());
+            const auto submodel_value =
+                comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
+                    .as<unsigned int>();
+            // in the pipelined execution every submodel is to be kept busy by its own requests
+            value = m_cfg.pipelined_execution ? value + submodel_value : std::max(value, submodel_value);
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
@@ -472,6 +514,15 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
             device_names.push_back(comp_model_desc.device);
         }
         return decltype(ov::execution_devices)::value_type{std::move(device_names)};
+    } else if (ov::hetero::stage_statistics == name) {
+        std::map<std::string, uint64_t> statistics;
+        for (size_t i = 0; i < m_stage_statistics.size(); i++) {
+            const auto prefix = std::string("subgraph") + std::to_string(i);
+            statistics[prefix + ".inferences"] = m_stage_statistics[i]->get_inferences();
+            statistics[prefix + ".busy_time_us"] =
+                static_cast<uint64_t>(m_stage_statistics[i]->get_busy_time().count());
+        }
+        return decltype(ov::hetero::stage_statistics)::value_type{std::move(statistics)};
     } else if (ov::hetero::number_of_submodels == name) {
         return decltype(ov::hetero::number_of_submodels)::value_type{
             (m_compiled_submodels.size() - get_hetero_plugin()->independent_submodel_size)};
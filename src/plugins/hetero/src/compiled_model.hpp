@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <memory>
+#include <mutex>
+
 #include "config.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/so_ptr.hpp"
@@ -16,9 +20,26 @@ namespace hetero {
 
 class Plugin;
 class InferRequest;
+class AsyncInferRequest;
 
 class CompiledModel : public ov::ICompiledModel {
 public:
+    // Number of inferences and busy time of a submodel, the time when at least one request executes it is busy
+    class StageStatistics {
+    public:
+        void on_start();
+        void on_finish();
+        uint64_t get_inferences() const;
+        std::chrono::microseconds get_busy_time() const;
+
+    private:
+        mutable std::mutex m_mutex;
+        size_t m_in_flight = 0;
+        uint64_t m_inferences = 0;
+        std::chrono::steady_clock::duration m_busy_time{};
+        std::chrono::steady_clock::time_point m_busy_start;
+    };
+
     CompiledModel(const std::shared_ptr<ov::Model>& model,
                   const std::vector<ov::hetero::SubmodelInfo>& compiled_submodels,
                   const SubgraphsMappingInfo& mapping_info,
@@ -47,6 +68,7 @@ public:
 
 private:
     friend class InferRequest;
+    friend class AsyncInferRequest;
 
     void compile_model(const std::vector<ov::hetero::SubmodelInfo>& submodels);
 
@@ -56,6 +78,8 @@ private:
 
     void set_inputs_and_outputs();
 
+    void init_stage_statistics();
+
     Configuration m_cfg;
     std::string m_name;
     const bool m_loaded_from_cache;
@@ -69,6 +93,8 @@ private:
         ov::SoPtr<ov::ICompiledModel> compiled_model;
     };
     std::vector<CompiledModelDesc> m_compiled_submodels;
+    // per submodel, collected in the pipelined execution mode only
+    std::vector<std::shared_ptr<StageStatistics>> m_stage_statistics;
 };
 }  // namespace hetero
 }  // namespace ov
@@ -33,6 +33,8 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
                 }
             }
             modelDistributionPolicy = value.as<std::set<ov::hint::ModelDistributionPolicy>>();
+        } else if (ov::hetero::pipelined_execution == key) {
+            pipelined_execution = value.as<bool>();
         } else if (ov::cache_encryption_callbacks == key) {
             encryption_callbacks = value.as<EncryptionCallbacks>();
         } else {
@@ -48,6 +50,8 @@ ov::Any Configuration::get(const std::string& name) const {
         return {device_priorities};
     } else if (name == ov::hint::model_distribution_policy) {
         return {modelDistributionPolicy};
+    } else if (name == ov::hetero::pipelined_execution) {
+        return {pipelined_execution};
     } else {
         OPENVINO_THROW("Property was not found: ", name);
     }
@@ -60,7 +64,8 @@ std::vector<ov::PropertyName> Configuration::get_supported() const {
 
 ov::AnyMap Configuration::get_hetero_properties() const {
     return {{ov::device::priorities.name(), device_priorities},
-            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy}};
+            {ov::hint::model_distribution_policy.name(), modelDistributionPolicy},
+            {ov::hetero::pipelined_execution.name(), pipelined_execution}};
 }
 
 ov::AnyMap Configuration::get_device_properties() const {
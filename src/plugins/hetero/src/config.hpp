@@ -38,6 +38,8 @@ struct Configuration {
 
     std::set<ov::hint::ModelDistributionPolicy> modelDistributionPolicy = {};
 
+    bool pipelined_execution = false;
+
     EncryptionCallbacks encryption_callbacks;
 
     ov::AnyMap device_properties;
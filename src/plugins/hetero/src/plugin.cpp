@@ -575,7 +575,9 @@ ov::Any ov::hetero::Plugin::get_property(const std::string& name, const ov::AnyM
         return ro_properties;
     };
     const auto& default_rw_properties = []() {
-        std::vector<ov::PropertyName> rw_properties{ov::device::priorities, ov::hint::model_distribution_policy};
+        std::vector<ov::PropertyName> rw_properties{ov::device::priorities,
+                                                    ov::hint::model_distribution_policy,
+                                                    ov::hetero::pipelined_execution};
         return rw_properties;
     };
 
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include "openvino/runtime/properties.hpp"
 
 namespace ov {
@@ -17,5 +20,18 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  * @brief Read-only property showing number of compiled submodels
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
+
+/**
+ * @brief Read-write property to let the infer requests flow through the submodels concurrently: the submodels are
+ * compiled without the exclusive async requests, so each of them executes the requests on its own streams
+ */
+static constexpr Property<bool, PropertyMutability::RW> pipelined_execution{"HETERO_PIPELINED_EXECUTION"};
+
+/**
+ * @brief Read-only property with the number of inferences and the busy time (in microseconds) of each submodel in the
+ * pipelined execution, as "subgraph<index>.inferences" and "subgraph<index>.busy_time_us"
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> stage_statistics{
+    "HETERO_STAGE_STATISTICS"};
 }  // namespace hetero
 }  // namespace ov
@@ -6,6 +6,7 @@
 #include "openvino/runtime/exec_model_info.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero::tests;
 
@@ -99,6 +100,47 @@ TEST_F(HeteroTests, compile_with_device_properties_no_exclusive) {
     EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
 }
 
+TEST_F(HeteroTests, compile_pipelined_execution) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::hetero::pipelined_execution(true),
+                         ov::device::properties("MOCK0", ov::num_streams(4)),
+                         ov::device::properties("MOCK1", ov::num_streams(6))};
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_HETERO, config);
+    EXPECT_TRUE(compiled_model.get_property(ov::hetero::pipelined_execution));
+    // the submodels keep their streams to execute the requests concurrently
+    auto device_properties = compiled_model.get_property(ov::device::properties.name()).as<ov::AnyMap>();
+    auto mock0_properties = device_properties.at("MOCK0.0").as<ov::AnyMap>();
+    EXPECT_EQ(4, mock0_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+    auto mock1_properties = device_properties.at("MOCK1.0").as<ov::AnyMap>();
+    EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
+
+    constexpr size_t num_requests = 4;
+    constexpr size_t num_iterations = 8;
+    std::vector<ov::InferRequest> infer_requests;
+    for (size_t i = 0; i < num_requests; i++) {
+        infer_requests.push_back(compiled_model.create_infer_request());
+        infer_requests.back().set_input_tensor(
+            create_and_fill_tensor(compiled_model.input().get_element_type(), compiled_model.input().get_shape()));
+    }
+    for (size_t iteration = 0; iteration < num_iterations; iteration++) {
+        for (auto& infer_request : infer_requests) {
+            infer_request.start_async();
+        }
+        for (auto& infer_request : infer_requests) {
+            ASSERT_NO_THROW(infer_request.wait());
+        }
+    }
+
+    // every request passed each of the two submodels in every iteration
+    const auto statistics = compiled_model.get_property(ov::hetero::stage_statistics);
+    for (const auto& prefix : {"subgraph0", "subgraph1"}) {
+        ASSERT_TRUE(statistics.count(std::string(prefix) + ".inferences"));
+        EXPECT_EQ(num_requests * num_iterations, statistics.at(std::string(prefix) + ".inferences"));
+        ASSERT_TRUE(statistics.count(std::string(prefix) + ".busy_time_us"));
+    }
+}
+
 TEST_F(HeteroTests, get_runtime_model) {
     ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1")};
     auto model = create_model_with_subtract_reshape();
@@ -53,3 +53,9 @@ void ov::intel_cpu::AsyncInferRequest::setSubInferRequest(
 void ov::intel_cpu::AsyncInferRequest::infer() {
     m_infer_func();
 }
+
+void ov::intel_cpu::AsyncInferRequest::start_async() {
+    // the offloaded KV cache is read ahead while the request waits for a stream
+    static_cast<SyncInferRequest*>(m_internal_request.get())->prefetch_states();
+    ov::IAsyncInferRequest::start_async();
+}
@@ -9,6 +9,7 @@
 #include <functional>
 #include <utility>
 
+#include "concurrent_lru_cache.h"
 #include "lru_cache.h"
 
 namespace ov::intel_cpu {
@@ -18,6 +19,13 @@ public:
     enum class LookUpStatus : int8_t { Hit, Miss };
 
     virtual ~CacheEntryBase() = default;
+
+    /**
+     * @brief Returns the usage counters of the underlying storage, if the storage collects them
+     */
+    [[nodiscard]] virtual CacheStatistics getStatistics() const {
+        return {};
+    }
 };
 
 /**
@@ -68,4 +76,19 @@ public:
     ImplType _impl;
 };
 
+/**
+ * @brief Cache record which may be safely shared between several streams
+ * @note Concurrent misses on the same key may invoke the builder more than once, the last built value is stored.
+ */
+
+template <typename KeyType, typename ValType>
+class ConcurrentCacheEntry : public CacheEntry<KeyType, ValType, ConcurrentLruCache<KeyType, ValType>> {
+public:
+    using CacheEntry<KeyType, ValType, ConcurrentLruCache<KeyType, ValType>>::CacheEntry;
+
+    [[nodiscard]] CacheStatistics getStatistics() const override {
+        return this->_impl.getStatistics();
+    }
+};
+
 }  // namespace ov::intel_cpu
@@ -0,0 +1,260 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Snapshot of the cache usage counters.
+ */
+struct CacheStatistics {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    size_t size = 0;
+
+    CacheStatistics& operator+=(const CacheStatistics& rhs) {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        size += rhs.size;
+        return *this;
+    }
+};
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy.
+ * The key space is split into a number of independently locked shards, so concurrent lookups from different streams
+ * contend only when their keys fall into the same shard. Each shard keeps its records in a contiguous slot array and
+ * links them into an intrusive LRU list by slot indices, so no list node is allocated per record.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must be copy constructible and copy assignable
+ *
+ * @note The eviction policy is LRU within a shard, the overall capacity is evenly divided between the shards.
+ */
+template <typename Key, typename Value>
+class ConcurrentLruCache {
+public:
+    using value_type = std::pair<Key, Value>;
+
+    static constexpr size_t defaultShardsNum = 16;
+
+    explicit ConcurrentLruCache(size_t capacity, size_t shardsNum = defaultShardsNum) : _capacity(capacity) {
+        if (0 == _capacity) {
+            return;
+        }
+        shardsNum = std::max<size_t>(1, std::min(shardsNum, _capacity));
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; ++i) {
+            const size_t shardCapacity = _capacity / shardsNum + (i < _capacity % shardsNum ? 1 : 0);
+            _shards.emplace_back(std::make_unique<Shard>(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+    void put(const Key& key, const Value& val) {
+        if (0 == _capacity) {
+            return;
+        }
+        const size_t hash = key.hash();
+        getShard(hash).put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+    Value get(const Key& key) {
+        if (0 == _capacity) {
+            return Value();
+        }
+        const size_t hash = key.hash();
+        return getShard(hash).get(key);
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records from every shard
+     * @param n number of records to be evicted per shard, can be greater than capacity
+     */
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            shard->evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the accumulated usage counters of all the shards
+     */
+    [[nodiscard]] CacheStatistics getStatistics() const {
+        CacheStatistics result;
+        for (const auto& shard : _shards) {
+            result += shard->getStatistics();
+        }
+        return result;
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const Key& k) const {
+            return k.hash();
+        }
+    };
+
+    class Shard {
+    public:
+        explicit Shard(size_t capacity) : _shardCapacity(capacity) {}
+
+        void put(const Key& key, const Value& val) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto mapItr = _cacheMapper.find(key);
+            if (mapItr != _cacheMapper.end()) {
+                touch(mapItr->second);
+                _slots[mapItr->second].record->second = val;
+                return;
+            }
+            if (_cacheMapper.size() == _shardCapacity) {
+                evictUnlocked(1);
+            }
+            index_type idx = npos;
+            if (_freeHead != npos) {
+                idx = _freeHead;
+                _freeHead = _slots[idx].next;
+            } else {
+                idx = static_cast<index_type>(_slots.size());
+                _slots.emplace_back();
+            }
+            _slots[idx].record.emplace(key, val);
+            pushFront(idx);
+            _cacheMapper.emplace(key, idx);
+        }
+
+        Value get(const Key& key) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto itr = _cacheMapper.find(key);
+            if (itr == _cacheMapper.end()) {
+                ++_stats.misses;
+                return Value();
+            }
+            ++_stats.hits;
+            touch(itr->second);
+            return _slots[itr->second].record->second;
+        }
+
+        void evict(size_t n) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            evictUnlocked(n);
+        }
+
+        CacheStatistics getStatistics() const {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto result = _stats;
+            result.size = _cacheMapper.size();
+            return result;
+        }
+
+    private:
+        using index_type = uint32_t;
+        static constexpr index_type npos = std::numeric_limits<index_type>::max();
+
+        struct Slot {
+            std::optional<value_type> record;
+            index_type prev = npos;
+            index_type next = npos;
+        };
+
+        void unlink(index_type idx) {
+            auto& slot = _slots[idx];
+            if (slot.prev != npos) {
+                _slots[slot.prev].next = slot.next;
+            } else {
+                _head = slot.next;
+            }
+            if (slot.next != npos) {
+                _slots[slot.next].prev = slot.prev;
+            } else {
+                _tail = slot.prev;
+            }
+            slot.prev = slot.next = npos;
+        }
+
+        void pushFront(index_type idx) {
+            auto& slot = _slots[idx];
+            slot.prev = npos;
+            slot.next = _head;
+            if (_head != npos) {
+                _slots[_head].prev = idx;
+            }
+            _head = idx;
+            if (_tail == npos) {
+                _tail = idx;
+            }
+        }
+
+        void touch(index_type idx) {
+            if (idx == _head) {
+                return;
+            }
+            unlink(idx);
+            pushFront(idx);
+        }
+
+        void evictUnlocked(size_t n) {
+            for (size_t i = 0; i < n && _tail != npos; ++i) {
+                const index_type idx = _tail;
+                unlink(idx);
+                auto& slot = _slots[idx];
+                _cacheMapper.erase(slot.record->first);
+                slot.record.reset();
+                slot.next = _freeHead;
+                _freeHead = idx;
+                ++_stats.evictions;
+            }
+        }
+
+        mutable std::mutex _mutex;
+        std::vector<Slot> _slots;
+        std::unordered_map<Key, index_type, key_hasher> _cacheMapper;
+        index_type _head = npos;
+        index_type _tail = npos;
+        index_type _freeHead = npos;
+        size_t _shardCapacity;
+        CacheStatistics _stats;
+    };
+
+    Shard& getShard(size_t hash) {
+        // the low bits are consumed by the per shard hash map, so mix in the high ones to select the shard
+        return *_shards[(hash ^ (hash >> 17)) % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}  // namespace ov::intel_cpu
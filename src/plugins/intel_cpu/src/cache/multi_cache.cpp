@@ -5,9 +5,21 @@
 #include "multi_cache.h"
 
 #include <atomic>
+#include <mutex>
+
+#include "cache_entry.h"
 
 namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+CacheStatistics MultiCache::getStatistics() const {
+    CacheStatistics result;
+    std::lock_guard<std::mutex> lock(_storageMutex);
+    for (const auto& item : _storage) {
+        result += item.second->getStatistics();
+    }
+    return result;
+}
+
 }  // namespace ov::intel_cpu
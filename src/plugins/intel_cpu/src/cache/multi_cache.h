@@ -7,32 +7,109 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "cache_entry.h"
 
 namespace ov::intel_cpu {
 
+/**
+ * @brief Detects the key types which declare `static constexpr bool shareable_between_streams = true`.
+ * Values of such keys are taken from the cache shared by all the streams of a compiled model. They must be immutable
+ * after the creation: no per call scratch buffers and no binding to the threading context of the creating stream.
+ */
+template <typename KeyType, typename = void>
+struct is_shareable_between_streams : std::false_type {};
+
+template <typename KeyType>
+struct is_shareable_between_streams<KeyType, std::void_t<decltype(KeyType::shareable_between_streams)>>
+    : std::bool_constant<KeyType::shareable_between_streams> {};
+
+template <typename ValueType, typename = void>
+struct is_pointer_like : std::false_type {};
+
+template <typename ValueType>
+struct is_pointer_like<ValueType, std::void_t<decltype(std::declval<const ValueType&>().get())>>
+    : std::is_pointer<decltype(std::declval<const ValueType&>().get())> {};
+
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE unless it is constructed in the concurrent mode!
  */
 
 class MultiCache {
 public:
     template <typename KeyType, typename ValueType>
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    template <typename KeyType, typename ValueType>
+    using ConcurrentEntryTypeT = ConcurrentCacheEntry<KeyType, ValueType>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template <typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
 
     /**
      * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param concurrent enables the thread safe sharded storage, so a single cache instance may be shared between
+     * all the streams of a compiled model
      * @note zero capacity means empty cache so no records are stored and no entries are created
      */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool concurrent = false) : _capacity(capacity), _concurrent(concurrent) {}
+
+    /**
+     * @brief Creates the cache of a stream which takes the values of the keys shareable between streams from the
+     * shared concurrent cache and keeps all the other values in its own storage
+     */
+    MultiCache(size_t capacity, std::shared_ptr<MultiCache> shared)
+        : _capacity(capacity),
+          _shared(std::move(shared)) {}
+
+    MultiCache(const MultiCache& other)
+        : _capacity(other._capacity),
+          _concurrent(other._concurrent),
+          _shared(other._shared) {
+        std::lock_guard<std::mutex> lock(other._storageMutex);
+        _storage = other._storage;
+    }
+
+    MultiCache& operator=(const MultiCache& other) = delete;
+
+    /**
+     * @brief Collects the objects the current thread takes from the caches while the recorder is alive, except the
+     * values of the keys shareable between streams. The values are identified by the pointer they hold (shared_ptr,
+     * dnnl handles). Two nodes which took the same object share its mutable state (e.g. the scratch buffers of an
+     * executor), so they must not be executed concurrently
+     */
+    class ValueRecorder {
+    public:
+        ValueRecorder() : m_previous(active()) {
+            active() = this;
+        }
+        ~ValueRecorder() {
+            active() = m_previous;
+        }
+        ValueRecorder(const ValueRecorder&) = delete;
+        ValueRecorder& operator=(const ValueRecorder&) = delete;
+
+        [[nodiscard]] const std::vector<const void*>& values() const {
+            return m_values;
+        }
+
+    private:
+        friend class MultiCache;
+
+        static ValueRecorder*& active() {
+            thread_local ValueRecorder* recorder = nullptr;
+            return recorder;
+        }
+
+        ValueRecorder* m_previous;
+        std::vector<const void*> m_values;
+    };
 
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
@@ -47,18 +124,44 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
-        return entry->getOrCreate(key, std::move(builder));
+        if constexpr (is_shareable_between_streams<KeyType>::value) {
+            if (_shared) {
+                return _shared->getOrCreate(key, std::move(builder));
+            }
+        }
+        auto result = _concurrent
+                          ? getEntry<ConcurrentEntryTypeT<KeyType, ValueType>>()->getOrCreate(key, std::move(builder))
+                          : getEntry<EntryTypeT<KeyType, ValueType>>()->getOrCreate(key, std::move(builder));
+        if constexpr (!is_shareable_between_streams<KeyType>::value && is_pointer_like<ValueType>::value) {
+            auto* recorder = ValueRecorder::active();
+            if (recorder && result.first) {
+                recorder->m_values.push_back(static_cast<const void*>(result.first.get()));
+            }
+        }
+        return result;
     }
 
+    [[nodiscard]] bool isConcurrent() const noexcept {
+        return _concurrent;
+    }
+
+    /**
+     * @brief Returns hit/miss/eviction counters accumulated over all the entries
+     * @note Only the concurrent storage collects the counters, otherwise zeros are returned
+     */
+    [[nodiscard]] CacheStatistics getStatistics() const;
+
 private:
     template <typename T>
     size_t getTypeId();
-    template <typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template <typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    bool _concurrent = false;
+    std::shared_ptr<MultiCache> _shared;
+    mutable std::mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -68,10 +171,13 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template <typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template <typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock(_storageMutex, std::defer_lock);
+    if (_concurrent) {
+        lock.lock();
+    }
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
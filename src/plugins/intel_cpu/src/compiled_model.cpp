@@ -14,6 +14,8 @@
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/concurrent_lru_cache.h"
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "graph.h"
@@ -27,16 +29,19 @@
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#include "utils/graph_serializer/packed_weights.hpp"
 #include "utils/graph_serializer/serializer.hpp"
 #ifdef CPU_DEBUG_CAPS
 #    include "utils/memory_stats_dump.hpp"
@@ -77,13 +82,17 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              Config cfg,
                              const bool loaded_from_cache,
-                             std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                             std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                             const PackedWeights::Ptr& packed_weights)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
+      m_socketWeights(m_cfg.sharedWeightsDir,
+                      packed_weights,
+                      m_cfg.cachePackedWeights && m_cfg.m_cache_mode != ov::CacheMode::OPTIMIZE_SIZE),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
     const auto& core = m_plugin->get_core();
@@ -101,6 +110,9 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                                                                              false,
                                                                              true}
                                                   : m_cfg.streamExecutorConfig;
+        if (m_cfg.streamsWorkStealing) {
+            executor_config.set_property(ov::internal::streams_work_stealing.name(), true);
+        }
         m_task_executor = m_plugin->get_executor_manager()->get_idle_cpu_streams_executor(executor_config);
     }
     if (0 != m_cfg.streamExecutorConfig.get_streams()) {
@@ -120,9 +132,16 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
     int streams = std::max(1, executor_config.get_streams());
+    // the offload directory and thread are created with the first infer request which holds a KV cache state
+    if (!m_cfg.kvCacheOffloadDir.empty()) {
+        const size_t residentRequests =
+            m_cfg.kvCacheResidentRequests != 0 ? m_cfg.kvCacheResidentRequests : static_cast<size_t>(streams);
+        m_kvCacheOffloader = std::make_shared<KVCacheOffloader>(m_cfg.kvCacheOffloadDir, residentRequests);
+    }
     std::vector<Task> tasks;
     tasks.resize(streams);
     m_graphs.resize(streams);
+    m_shapePlanCaches.resize(streams);
     if (executor_config.get_streams() != 0) {
         auto all_graphs_ready = [&] {
             return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
@@ -202,17 +221,37 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                     auto isQuantizedFlag = (m_cfg.lpTransformsMode == Config::On) &&
                                            ov::pass::low_precision::LowPrecision::isFunctionQuantized(m_model);
                     auto cpuParallel = std::make_shared<CpuParallel>(m_cfg.tbbPartitioner);
+                    MultiCachePtr paramsCache = nullptr;
+                    if (m_cfg.rtCacheShared) {
+                        auto& sharedCache = m_sharedParamsCaches[socketId];
+                        if (!sharedCache) {
+                            sharedCache = std::make_shared<MultiCache>(m_cfg.rtCacheCapacity, true);
+                        }
+                        // executors with scratch buffers or bound to the stream threading stay in the stream cache
+                        paramsCache = std::make_shared<MultiCache>(m_cfg.rtCacheCapacity, sharedCache);
+                    }
+                    if (m_cfg.snippetsCodeCacheShared && !m_sharedSnippetsCodeCache) {
+                        m_sharedSnippetsCodeCache = std::make_shared<MultiCache>(m_cfg.snippetsCacheCapacity, true);
+                    }
                     ctx = std::make_shared<GraphContext>(m_cfg,
                                                          m_socketWeights[socketId],
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         paramsCache,
+                                                         m_sharedSnippetsCodeCache);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.Init(model, ctx);
-                graphLock._graph.Activate();
+                graphLock._graph.Activate(m_cfg.interOpParallel);
+                if (m_cfg.shapePlanCacheCapacity > 0) {
+                    graphLock._graph.CreateShapePlanCache(m_cfg.shapePlanCacheCapacity);
+                    // a rebuilt graph replaces the cache of its slot
+                    std::lock_guard<std::mutex> lock{*m_mutex};
+                    m_shapePlanCaches[graph_idx] = graphLock._graph.GetShapePlanCache();
+                }
             } catch (...) {
                 exception = std::current_exception();
             }
@@ -309,7 +348,18 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::key_cache_precision.name()),
             RO_property(ov::value_cache_precision.name()),
             RO_property(ov::key_cache_group_size.name()),
-            RO_property(ov::value_cache_group_size.name())};
+            RO_property(ov::value_cache_group_size.name()),
+            RO_property(ov::intel_cpu::cpu_runtime_cache_shared.name()),
+            RO_property(ov::intel_cpu::cpu_snippets_code_cache_shared.name()),
+            RO_property(ov::intel_cpu::cpu_runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::cpu_shared_weights_dir.name()),
+            RO_property(ov::intel_cpu::cpu_cache_packed_weights.name()),
+            RO_property(ov::intel_cpu::cpu_kv_cache_offload_dir.name()),
+            RO_property(ov::intel_cpu::cpu_kv_cache_resident_requests.name()),
+            RO_property(ov::intel_cpu::cpu_inter_op_parallel.name()),
+            RO_property(ov::intel_cpu::cpu_shape_plan_cache_capacity.name()),
+            RO_property(ov::intel_cpu::cpu_shape_plan_cache_statistics.name()),
+            RO_property(ov::intel_cpu::cpu_streams_statistics.name())};
 
         return ro_properties;
     }
@@ -408,6 +458,78 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::value_cache_group_size) {
         return static_cast<decltype(ov::value_cache_group_size)::value_type>(config.valueCacheGroupSize);
     }
+    if (name == ov::intel_cpu::cpu_runtime_cache_shared) {
+        return static_cast<decltype(ov::intel_cpu::cpu_runtime_cache_shared)::value_type>(config.rtCacheShared);
+    }
+    if (name == ov::intel_cpu::cpu_snippets_code_cache_shared) {
+        return static_cast<decltype(ov::intel_cpu::cpu_snippets_code_cache_shared)::value_type>(
+            config.snippetsCodeCacheShared);
+    }
+    if (name == ov::intel_cpu::cpu_cache_packed_weights) {
+        return static_cast<decltype(ov::intel_cpu::cpu_cache_packed_weights)::value_type>(config.cachePackedWeights);
+    }
+    if (name == ov::intel_cpu::cpu_shared_weights_dir) {
+        return static_cast<decltype(ov::intel_cpu::cpu_shared_weights_dir)::value_type>(config.sharedWeightsDir);
+    }
+    if (name == ov::intel_cpu::cpu_kv_cache_offload_dir) {
+        return static_cast<decltype(ov::intel_cpu::cpu_kv_cache_offload_dir)::value_type>(config.kvCacheOffloadDir);
+    }
+    if (name == ov::intel_cpu::cpu_kv_cache_resident_requests) {
+        return static_cast<decltype(ov::intel_cpu::cpu_kv_cache_resident_requests)::value_type>(
+            config.kvCacheResidentRequests);
+    }
+    if (name == ov::intel_cpu::cpu_inter_op_parallel) {
+        return static_cast<decltype(ov::intel_cpu::cpu_inter_op_parallel)::value_type>(config.interOpParallel);
+    }
+    if (name == ov::intel_cpu::cpu_shape_plan_cache_capacity) {
+        return static_cast<decltype(ov::intel_cpu::cpu_shape_plan_cache_capacity)::value_type>(
+            config.shapePlanCacheCapacity);
+    }
+    if (name == ov::intel_cpu::cpu_shape_plan_cache_statistics) {
+        CacheStatistics stats;
+        {
+            std::lock_guard<std::mutex> lock{*m_mutex};
+            for (const auto& cache : m_shapePlanCaches) {
+                if (cache) {
+                    stats += cache->getStatistics();
+                }
+            }
+        }
+        return decltype(ov::intel_cpu::cpu_shape_plan_cache_statistics)::value_type{{"hits", stats.hits},
+                                                                                   {"misses", stats.misses},
+                                                                                   {"evictions", stats.evictions},
+                                                                                   {"size", stats.size}};
+    }
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        CacheStatistics stats;
+        {
+            std::lock_guard<std::mutex> lock{*m_mutex};
+            for (const auto& [socketId, cache] : m_sharedParamsCaches) {
+                stats += cache->getStatistics();
+            }
+        }
+        return decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type{{"hits", stats.hits},
+                                                                                {"misses", stats.misses},
+                                                                                {"evictions", stats.evictions},
+                                                                                {"size", stats.size}};
+    }
+    if (name == ov::intel_cpu::cpu_streams_statistics) {
+        decltype(ov::intel_cpu::cpu_streams_statistics)::value_type stats{{"queue_depth", 0},
+                                                                         {"max_queue_depth", 0},
+                                                                         {"executed", 0},
+                                                                         {"stolen", 0},
+                                                                         {"overflowed", 0}};
+        if (auto executor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_task_executor)) {
+            for (const auto& stream : executor->get_queue_statistics()) {
+                stats["queue_depth"] += stream.depth;
+                stats["max_queue_depth"] = std::max<uint64_t>(stats["max_queue_depth"], stream.depth);
+                stats["executed"] += stream.executed;
+                stats["stolen"] += stream.stolen;
+                stats["overflowed"] += stream.overflowed;
+            }
+        }
+        return stats;
+    }
     if (name == ov::weights_path) {
         return static_cast<decltype(ov::weights_path)::value_type>("");
     }
@@ -415,8 +537,16 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
 }
 
 void CompiledModel::export_model(std::ostream& modelStream) const {
+    const auto blobBegin = modelStream.tellp();
     ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE);
     serializer << m_model;
+
+    if (m_cfg.cachePackedWeights && m_cfg.m_cache_mode != ov::CacheMode::OPTIMIZE_SIZE &&
+        blobBegin != std::streampos(-1)) {
+        // the serializer leaves the put position relative to the blob begin, so move it to the actual end
+        modelStream.seekp(0, std::ios::end);
+        writePackedWeights(modelStream, blobBegin, m_socketWeights.getPackedWeights());
+    }
 }
 
 void CompiledModel::release_memory() {
@@ -10,11 +10,14 @@
 #include <mutex>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "cache/multi_cache.h"
 #include "config.h"
 #include "graph.h"
+#include "kv_cache_offload.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
@@ -23,6 +26,7 @@
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "shape_plan_cache.h"
 #include "sub_memory_manager.hpp"
 #include "weights_cache.hpp"
 
@@ -44,7 +48,8 @@ public:
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   Config cfg,
                   bool loaded_from_cache,
-                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                  const PackedWeights::Ptr& packed_weights = nullptr);
 
     ~CompiledModel() override;
 
@@ -87,6 +92,15 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // moves the KV cache of idle infer requests to files (CPU_KV_CACHE_OFFLOAD_DIR mode only)
+    KVCacheOffloader::Ptr m_kvCacheOffloader;
+    // per socket runtime parameters caches shared by all the streams (CPU_RUNTIME_CACHE_SHARED mode only)
+    mutable std::unordered_map<int, MultiCachePtr> m_sharedParamsCaches;
+    // code of the static snippets generated once and reused by the graphs of all the streams
+    // (CPU_SNIPPETS_CODE_CACHE_SHARED mode only)
+    mutable MultiCachePtr m_sharedSnippetsCodeCache;
+    // shape plan caches indexed as m_graphs (CPU_SHAPE_PLAN_CACHE_CAPACITY mode only)
+    mutable std::vector<ShapePlanCache::Ptr> m_shapePlanCaches;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -148,6 +162,10 @@ public:
         return m_compiled_model;
     }
 
+    [[nodiscard]] const KVCacheOffloader::Ptr& kv_cache_offloader() const {
+        return m_compiled_model->m_kvCacheOffloader;
+    }
+
     [[nodiscard]] int id() const {
         return m_id;
     }
@@ -232,6 +232,16 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::internal::exclusive_async_requests.name(),
                                ". Expected only true/false");
             }
+        } else if (key == ov::internal::streams_work_stealing.name()) {
+            try {
+                streamsWorkStealing = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::internal::streams_work_stealing.name(),
+                               ". Expected only true/false");
+            }
         } else if (key == ov::internal::enable_lp_transformations.name()) {
             try {
                 lpTransformsMode = val.as<bool>() ? LPTransformsMode::On : LPTransformsMode::Off;
@@ -285,6 +295,74 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_runtime_cache_shared.name() == key) {
+            try {
+                rtCacheShared = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_shared.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (ov::intel_cpu::cpu_snippets_code_cache_shared.name() == key) {
+            try {
+                snippetsCodeCacheShared = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_snippets_code_cache_shared.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (ov::intel_cpu::cpu_shared_weights_dir.name() == key) {
+            sharedWeightsDir = val.as<std::string>();
+        } else if (ov::intel_cpu::cpu_cache_packed_weights.name() == key) {
+            try {
+                cachePackedWeights = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_cache_packed_weights.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (ov::intel_cpu::cpu_kv_cache_offload_dir.name() == key) {
+            kvCacheOffloadDir = val.as<std::string>();
+        } else if (ov::intel_cpu::cpu_kv_cache_resident_requests.name() == key) {
+            try {
+                kvCacheResidentRequests = val.as<uint32_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_kv_cache_resident_requests.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::cpu_inter_op_parallel.name() == key) {
+            try {
+                interOpParallel = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_inter_op_parallel.name(),
+                               ". Expected only true/false.");
+            }
+        } else if (ov::intel_cpu::cpu_shape_plan_cache_capacity.name() == key) {
+            int val_i = -1;
+            try {
+                ov::Any value = val.as<std::string>();
+                val_i = value.as<int>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_shape_plan_cache_capacity.name(),
+                               ". Expected only integer numbers");
+            }
+            // any negative value disables the cache
+            shapePlanCacheCapacity = std::max(val_i, 0);
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -75,6 +75,15 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    bool rtCacheShared = false;
+    bool snippetsCodeCacheShared = false;
+    bool streamsWorkStealing = false;
+    std::string sharedWeightsDir;
+    bool cachePackedWeights = false;
+    std::string kvCacheOffloadDir;
+    uint32_t kvCacheResidentRequests = 0;
+    bool interOpParallel = false;
+    size_t shapePlanCacheCapacity = 0UL;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -15,6 +15,7 @@
 #include <common/utils.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <optional>
@@ -24,11 +25,14 @@
 #include "cpu_memory.h"
 #include "cpu_types.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "memory_desc/dnnl_memory_desc.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "utils/sha256.hpp"
 #if defined(OV_CPU_WITH_ACL) || defined(OPENVINO_ARCH_X86_64)
 #    include "utils/general_utils.h"
 #endif
@@ -310,4 +314,33 @@ std::string DnnlExtensionUtils::computeWeightsStringHash(const std::shared_ptr<c
     return std::to_string(desc_hash) + "_" + std::to_string(reinterpret_cast<uint64_t>(memory->getData()));
 }
 
+std::string DnnlExtensionUtils::computeWeightsContentHash(const std::shared_ptr<const IMemory>& memory,
+                                                          const std::shared_ptr<MemoryDesc>& srcDesc,
+                                                          const std::shared_ptr<DnnlMemoryDesc>& dstDesc) {
+    const auto dnnlSrcDesc = MemoryDescUtils::convertToDnnlMemoryDesc(srcDesc);
+    const auto src_hash = dnnl::impl::primitive_hashing::get_md_hash(*dnnlSrcDesc->getDnnlDesc().get());
+    const auto dst_hash = dnnl::impl::primitive_hashing::get_md_hash(*dstDesc->getDnnlDesc().get());
+
+    // The key identifies weights shared with other processes, so the content is digested with SHA-256: a collision of
+    // a 64-bit hash would map foreign weights. The chunks are digested in parallel and the chunk digests are digested
+    // once more, so the result does not depend on the number of threads
+    constexpr size_t chunk_size = 1024 * 1024;
+    const auto* data = static_cast<const uint8_t*>(memory->getData());
+    const uint64_t size = memory->getSize();
+    const size_t chunks = (size + chunk_size - 1) / chunk_size;
+    std::vector<Sha256::Digest> chunk_digests(chunks);
+    ov::parallel_for(chunks, [&](size_t chunk) {
+        const size_t begin = chunk * chunk_size;
+        Sha256 sha;
+        sha.update(data + begin, std::min<size_t>(size - begin, chunk_size));
+        chunk_digests[chunk] = sha.finalize();
+    });
+    Sha256 sha;
+    sha.update(&size, sizeof(size));
+    sha.update(chunk_digests.data(), chunk_digests.size() * sizeof(Sha256::Digest));
+
+    return std::to_string(src_hash) + "_" + std::to_string(dst_hash) + "_" + std::to_string(size) + "_" +
+           Sha256::toHex(sha.finalize());
+}
+
 }  // namespace ov::intel_cpu
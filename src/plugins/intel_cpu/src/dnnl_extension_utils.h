@@ -26,6 +26,7 @@
 
 namespace ov::intel_cpu {
 
+class MemoryDesc;
 class DnnlMemoryDesc;
 class DnnlBlockedMemoryDesc;
 class Shape;
@@ -130,6 +131,19 @@ public:
      */
     static std::string computeWeightsStringHash(const std::shared_ptr<const IMemory>& memory,
                                                 const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
+
+    /**
+     * @brief Computes weights string hash based on weights content, source and requested descriptors. Unlike
+     * computeWeightsStringHash, the hash does not depend on the process, so it can identify repacked weights shared
+     * between processes. The content is identified by its size and SHA-256 digest
+     * @param memory Weights memory pointer
+     * @param srcDesc descriptor the weights memory is read with
+     * @param dstDesc descriptor defining weights representation after repacking
+     * @return string hash
+     */
+    static std::string computeWeightsContentHash(const std::shared_ptr<const IMemory>& memory,
+                                                 const std::shared_ptr<MemoryDesc>& srcDesc,
+                                                 const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
 };
 
 }  // namespace ov::intel_cpu
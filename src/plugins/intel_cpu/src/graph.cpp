@@ -9,6 +9,7 @@
 #include <oneapi/dnnl/dnnl_types.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
@@ -21,6 +22,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -33,6 +35,7 @@
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "cache/multi_cache.h"
 #include "cpu_memory.h"
 #include "cpu_types.h"
 #include "edge.h"
@@ -67,8 +70,10 @@
 #include "openvino/runtime/itensor.hpp"
 #include "openvino/runtime/profiling_info.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "openvino/util/hash_util.hpp"
 #include "perf_count.h"
 #include "proxy_mem_blk.h"
+#include "shape_plan_cache.h"
 #include "thread_pool_imp.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -86,6 +91,7 @@
 
 #if OV_THREAD_USE_TBB
 #    include <tbb/task.h>
+#    include <tbb/task_group.h>
 #endif
 
 #if defined(OPENVINO_ARCH_X86_64) && defined(__linux__)
@@ -392,15 +398,20 @@ void Graph::Init(const std::shared_ptr<const ov::Model>& model,
     Configure();
 }
 
-void Graph::Activate() {
+void Graph::Activate(bool interOpParallel) {
     // @todo It is possible that execution graph is already created in scope of
     // the allocation context collection from the outer graph so the state for inner graph is "Ready"
     // We probably want to avoid such uncertainty
     // OPENVINO_ASSERT(status == Status::Initialized, "Invalid graph status: ", static_cast<int>(status));
+    m_interOpParallel = interOpParallel;
     Allocate();
 
     CreatePrimitivesAndExecConstants();
 
+    if (m_interOpParallel) {
+        CreateInterOpSchedule();
+    }
+
 #ifndef CPU_DEBUG_CAPS
     for (auto& graphNode : graphNodes) {
         graphNode->cleanup();
@@ -534,7 +545,7 @@ void Graph::InitOptimalPrimitiveDescriptors() {
     }
 }
 
-void Graph::CreatePrimitivesAndExecConstants() const {
+void Graph::CreatePrimitivesAndExecConstants() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
     using shared_memory_ptr = WeightsSharing::SharedMemory::Ptr;
 
@@ -561,11 +572,30 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    // the nodes which may be executed concurrently with other nodes, see CollectInterOpAccesses
+    std::unordered_map<const Node*, size_t> interOpNodes;
+    for (size_t i = 0; i < m_interOpAccesses.size(); i++) {
+        if (!m_interOpAccesses[i].barrier) {
+            interOpNodes.emplace(m_executableGraphNodes[i].get(), i);
+        }
+    }
+
     for (const auto& node : graphNodes) {
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
-            node->createPrimitive();
+            const auto interOpNode = interOpNodes.find(node.get());
+            if (interOpNode == interOpNodes.end()) {
+                node->createPrimitive();
+            } else {
+                // The executors the node takes from the runtime caches are recorded: the nodes sharing one of them are
+                // not executed concurrently
+                MultiCache::ValueRecorder recorder;
+                node->createPrimitive();
+                auto& cachedValues = m_interOpAccesses[interOpNode->second].cachedValues;
+                cachedValues = recorder.values();
+                std::sort(cachedValues.begin(), cachedValues.end());
+            }
         }
 
         if (!node->isConstant() || !node->isExecutable()) {
@@ -922,6 +952,249 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
     return syncNodesInds;
 }
 
+namespace {
+
+bool CollectMemoryRanges(const std::vector<EdgeWeakPtr>& edges, std::vector<std::pair<uintptr_t, uintptr_t>>& ranges) {
+    for (const auto& weakEdge : edges) {
+        const auto edge = weakEdge.lock();
+        if (!edge) {
+            continue;
+        }
+        if (edge->getStatus() != Edge::Status::Allocated) {
+            return false;
+        }
+        const auto& memory = edge->getMemoryPtr();
+        const auto size = memory->getSize();
+        if (size == 0) {
+            continue;
+        }
+        const auto* data = memory->getData();
+        if (data == nullptr) {
+            return false;
+        }
+        const auto begin = reinterpret_cast<uintptr_t>(data);
+        ranges.emplace_back(begin, begin + size);
+    }
+    return true;
+}
+
+bool Overlap(const std::vector<std::pair<uintptr_t, uintptr_t>>& lhs,
+             const std::vector<std::pair<uintptr_t, uintptr_t>>& rhs) {
+    return std::any_of(lhs.begin(), lhs.end(), [&rhs](const auto& l) {
+        return std::any_of(rhs.begin(), rhs.end(), [&l](const auto& r) {
+            return l.first < r.second && r.first < l.second;
+        });
+    });
+}
+
+bool Intersect(const std::vector<const void*>& lhs, const std::vector<const void*>& rhs) {
+    auto l = lhs.begin();
+    auto r = rhs.begin();
+    while (l != lhs.end() && r != rhs.end()) {
+        if (*l == *r) {
+            return true;
+        }
+        if (*l < *r) {
+            ++l;
+        } else {
+            ++r;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+bool Graph::InterOpAccess::conflicts(const InterOpAccess& other) const {
+    return barrier || other.barrier || Overlap(writes, other.reads) || Overlap(reads, other.writes) ||
+           Overlap(writes, other.writes) || Intersect(cachedValues, other.cachedValues);
+}
+
+void Graph::CollectInterOpAccesses(const AllocationContext& allocationContext) {
+    m_interOpAccesses.clear();
+    if (status != Status::ReadyStatic || m_executableGraphNodes.size() < 2) {
+        return;
+    }
+
+    // The dependencies are derived from the actual memory the nodes read and write, so besides the data edges they
+    // cover the in-place edges and the reuse of memory between the edges with non-overlapping lifetimes, which is
+    // decided by the memory solver for the sequential execution order.
+    // The nodes with states access the memory outside of their edges, and the memory of the nested graphs is a part
+    // of the same memory solution, so such nodes are executed in the original order.
+    const auto nodesNum = m_executableGraphNodes.size();
+    std::vector<InterOpAccess> accesses(nodesNum);
+    for (size_t i = 0; i < nodesNum; i++) {
+        const auto& executableNode = m_executableGraphNodes[i];
+        const auto execIndex = allocationContext.execIndex.find(executableNode);
+        const bool hasNestedGraph =
+            execIndex == allocationContext.execIndex.end() || execIndex->second.first != execIndex->second.second;
+        auto& access = accesses[i];
+        access.barrier = hasNestedGraph || dynamic_cast<node::MemoryNode*>(executableNode.get()) != nullptr ||
+                         !CollectMemoryRanges(executableNode->getParentEdges(), access.reads) ||
+                         !CollectMemoryRanges(executableNode->getChildEdges(), access.writes);
+    }
+
+    // a chain of nodes is executed sequentially anyway
+    bool hasIndependentNodes = false;
+    for (size_t i = 1; i < nodesNum && !hasIndependentNodes; i++) {
+        hasIndependentNodes = !accesses[i - 1].conflicts(accesses[i]);
+    }
+    if (!hasIndependentNodes) {
+        DEBUG_LOG("Graph ", GetName(), " has no independent nodes, inter-op parallel execution is disabled");
+        return;
+    }
+    m_interOpAccesses = std::move(accesses);
+}
+
+void Graph::CreateInterOpSchedule() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::CreateInterOpSchedule");
+
+    m_interOpSchedule = {};
+    // the accesses are only needed to build the schedule
+    auto accesses = std::move(m_interOpAccesses);
+    m_interOpAccesses.clear();
+    if (accesses.empty()) {
+        return;
+    }
+
+    // the memory is collected once more, as the creation of the primitives may rebind the memory of the edges (e.g.
+    // to the weights cache)
+    const auto nodesNum = accesses.size();
+    for (size_t i = 0; i < nodesNum; i++) {
+        const auto& executableNode = m_executableGraphNodes[i];
+        auto& access = accesses[i];
+        access.reads.clear();
+        access.writes.clear();
+        access.barrier = access.barrier || !CollectMemoryRanges(executableNode->getParentEdges(), access.reads) ||
+                         !CollectMemoryRanges(executableNode->getChildEdges(), access.writes);
+    }
+
+    // the nodes sharing a cached executor may have turned a branching graph into a chain
+    bool hasIndependentNodes = false;
+    for (size_t i = 1; i < nodesNum && !hasIndependentNodes; i++) {
+        hasIndependentNodes = !accesses[i - 1].conflicts(accesses[i]);
+    }
+    if (!hasIndependentNodes) {
+        DEBUG_LOG("Graph ", GetName(), " has no independent nodes, inter-op parallel execution is disabled");
+        return;
+    }
+
+    // The address ranges of all the nodes split the memory into elementary regions, a node accessing a range accesses
+    // all the regions inside it. Instead of testing every pair of nodes, the dependencies are found per region: a node
+    // depends on the last writer of the regions it reads and writes, and a writer also on the readers since that
+    // write. The nodes sharing a cached value depend on its previous user. The conflicts with earlier accesses are
+    // then ordered transitively.
+    std::vector<uintptr_t> bounds;
+    for (const auto& access : accesses) {
+        for (const auto* ranges : {&access.reads, &access.writes}) {
+            for (const auto& [begin, end] : *ranges) {
+                bounds.push_back(begin);
+                bounds.push_back(end);
+            }
+        }
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+    auto forEachRegion = [&bounds](const std::vector<std::pair<uintptr_t, uintptr_t>>& ranges, const auto& func) {
+        for (const auto& [begin, end] : ranges) {
+            const auto first = std::lower_bound(bounds.begin(), bounds.end(), begin) - bounds.begin();
+            const auto last = std::lower_bound(bounds.begin(), bounds.end(), end) - bounds.begin();
+            for (auto region = first; region < last; region++) {
+                func(static_cast<size_t>(region));
+            }
+        }
+    };
+
+    constexpr size_t noNode = std::numeric_limits<size_t>::max();
+    // the accesses before a barrier are ordered by the barrier, the regions are reset lazily for every new epoch
+    struct Region {
+        size_t epoch = 0;
+        size_t lastWriter = noNode;
+        std::vector<size_t> readers;
+    };
+    std::vector<Region> regions(bounds.size());
+    size_t epoch = 0;
+    auto regionAt = [&regions, &epoch](size_t index) -> Region& {
+        auto& region = regions[index];
+        if (region.epoch != epoch) {
+            region = Region{epoch, noNode, {}};
+        }
+        return region;
+    };
+    std::unordered_map<const void*, size_t> lastCachedValueUsers;
+
+    auto& schedule = m_interOpSchedule;
+    schedule.successors.resize(nodesNum);
+    schedule.numPredecessors.resize(nodesNum, 0);
+    // all the dependencies of a node are added in a row, so the last successor of a node detects the duplicates
+    std::vector<size_t> lastSuccessors(nodesNum, noNode);
+    auto addDependency = [&](size_t from, size_t to) {
+        if (from == noNode || from == to || lastSuccessors[from] == to) {
+            return;
+        }
+        lastSuccessors[from] = to;
+        schedule.successors[from].push_back(to);
+        schedule.numPredecessors[to]++;
+    };
+
+    size_t lastBarrier = noNode;
+    std::vector<size_t> sinceBarrier;
+    for (size_t i = 0; i < nodesNum; i++) {
+        const auto& access = accesses[i];
+        if (access.barrier) {
+            for (const auto j : sinceBarrier) {
+                addDependency(j, i);
+            }
+            addDependency(lastBarrier, i);
+            lastBarrier = i;
+            sinceBarrier.clear();
+            lastCachedValueUsers.clear();
+            epoch++;
+            continue;
+        }
+
+        forEachRegion(access.reads, [&](size_t region) {
+            addDependency(regionAt(region).lastWriter, i);
+        });
+        forEachRegion(access.writes, [&](size_t region) {
+            auto& written = regionAt(region);
+            addDependency(written.lastWriter, i);
+            for (const auto reader : written.readers) {
+                addDependency(reader, i);
+            }
+        });
+        for (const auto* value : access.cachedValues) {
+            auto [user, inserted] = lastCachedValueUsers.emplace(value, i);
+            if (!inserted) {
+                addDependency(user->second, i);
+                user->second = i;
+            }
+        }
+        // a node without other predecessors is ordered after the last barrier directly
+        if (schedule.numPredecessors[i] == 0) {
+            addDependency(lastBarrier, i);
+        }
+
+        // the regions are updated after the dependencies are added, as a node may read and write the same region
+        forEachRegion(access.reads, [&](size_t region) {
+            regionAt(region).readers.push_back(i);
+        });
+        forEachRegion(access.writes, [&](size_t region) {
+            auto& written = regionAt(region);
+            written.lastWriter = i;
+            written.readers.clear();
+        });
+        sinceBarrier.push_back(i);
+    }
+
+    for (size_t i = 0; i < nodesNum; i++) {
+        if (schedule.numPredecessors[i] == 0) {
+            schedule.roots.push_back(i);
+        }
+    }
+    schedule.pending = std::make_unique<std::atomic<size_t>[]>(nodesNum);
+}
+
 static void ResolveInOutInPlaceEdges(const std::vector<EdgePtr>& edges) {
     for (const auto& edge : edges) {
         if (edge->getStatus() == Edge::Status::Uninitialized) {
@@ -1205,6 +1478,10 @@ void Graph::Allocate() {
     AllocatedReferencingEdges(edgeClusters);
 
     ValidateEdgeStatus(edges);
+
+    if (m_interOpParallel) {
+        CollectInterOpAccesses(allocationContext);
+    }
 }
 
 bool Graph::ProcessDynNodes() const {
@@ -1367,18 +1644,87 @@ void Graph::InferStatic(SyncInferRequest* request, int numaId) {
     }
 }
 
+void Graph::InferStaticInterOp(SyncInferRequest* request, int numaId) {
+#if OV_THREAD_USE_TBB
+    auto& schedule = m_interOpSchedule;
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        schedule.pending[i].store(schedule.numPredecessors[i], std::memory_order_relaxed);
+    }
+
+    tbb::task_group taskGroup;
+    std::atomic<bool> failed{false};
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+
+    std::function<void(size_t)> run = [&](size_t index) {
+        while (!failed.load(std::memory_order_acquire)) {
+            try {
+                ExecuteNodeWithCatch(m_executableGraphNodes[index], request, numaId);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+                failed.store(true, std::memory_order_release);
+                return;
+            }
+            // the first ready successor is executed by the same task, the others are spawned
+            size_t next = m_executableGraphNodes.size();
+            for (const auto successor : schedule.successors[index]) {
+                if (schedule.pending[successor].fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    continue;
+                }
+                if (next == m_executableGraphNodes.size()) {
+                    next = successor;
+                } else {
+                    taskGroup.run([&run, successor] {
+                        run(successor);
+                    });
+                }
+            }
+            if (next == m_executableGraphNodes.size()) {
+                return;
+            }
+            index = next;
+        }
+    };
+
+    for (const auto root : schedule.roots) {
+        taskGroup.run([&run, root] {
+            run(root);
+        });
+    }
+    taskGroup.wait();
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+#else
+    InferStatic(request, numaId);
+#endif
+}
+
 namespace {
 
+void UpdateNodeShapes(const NodePtr& node, ShapePlan* shapePlan, size_t execIndex) {
+    if (shapePlan && (*shapePlan)[execIndex].replayable) {
+        node->updateShapes((*shapePlan)[execIndex]);
+    } else {
+        node->updateShapes();
+    }
+}
+
 class UpdateNodesSeq {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, ShapePlan* shapePlan = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_shapePlan(shapePlan) {}
 
     void operator()(size_t stopIndx) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                UpdateNodeShapes(node, m_shapePlan, prepareCounter);
                 node->updateDynamicParams();
             }
         }
@@ -1387,6 +1733,7 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    ShapePlan* m_shapePlan;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1398,14 +1745,15 @@ using UpdateNodes = UpdateNodesSeq;
 
 class UpdateNodesBase {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, ShapePlan* shapePlan = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_shapePlan(shapePlan) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    UpdateNodeShapes(node, m_shapePlan, i);
                 }
                 m_prepareCounter.store(i, std::memory_order_release);
             }
@@ -1438,6 +1786,7 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    ShapePlan* m_shapePlan;
 };
 
 // NOLINTBEGIN(misc-include-cleaner) tbb has multiple implicit includes, which are not supposed to be included directly
@@ -1643,6 +1992,21 @@ void Graph::InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&&
     }
 }
 
+static uint64_t InputShapesSignature(const std::vector<NodePtr>& inputNodes) {
+    uint64_t signature = inputNodes.size();
+    for (const auto& input : inputNodes) {
+        if (input->getChildEdges().empty()) {
+            continue;
+        }
+        const auto& dims = input->getChildEdgeAt(0)->getMemory().getStaticDims();
+        signature = ov::util::u64_hash_combine(signature, dims.size());
+        for (const auto dim : dims) {
+            signature = ov::util::u64_hash_combine(signature, dim);
+        }
+    }
+    return signature;
+}
+
 static int GetNumaNodeId([[maybe_unused]] const GraphContext::CPtr& context) {
     int numaNodeId = -1;
 #if defined(OPENVINO_ARCH_X86_64) && defined(__linux__)
@@ -1660,15 +2024,24 @@ void Graph::Infer(SyncInferRequest* request) {
 
     m_context->allocateMemory();
 
+    ShapePlan* shapePlan = nullptr;
+    if (m_shapePlanCache && IsDynamic()) {
+        shapePlan = &m_shapePlanCache->get(InputShapesSignature(inputNodes));
+    }
+
     switch (status) {
     case Status::ReadyDynamic:
-        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
+        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes, shapePlan));
         break;
     case Status::ReadyDynamicSeq:
-        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
+        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes, shapePlan));
         break;
     case Status::ReadyStatic:
-        InferStatic(request, numaId);
+        if (m_interOpSchedule.pending) {
+            InferStaticInterOp(request, numaId);
+        } else {
+            InferStatic(request, numaId);
+        }
         break;
     default:
         OPENVINO_ASSERT(IsReady(),
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -11,6 +12,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "allocation_context.hpp"
@@ -26,6 +28,7 @@
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "proxy_mem_blk.h"
+#include "shape_plan_cache.h"
 #include "utils/general_utils.h"
 
 namespace ov::intel_cpu {
@@ -260,8 +263,21 @@ public:
 
     /**
      * Activate execution graph
+     * @param interOpParallel build the dependencies between the executable nodes of a static graph, so the nodes of
+     * independent branches are executed concurrently (CPU_INTER_OP_PARALLEL mode). Must be set for the top level
+     * graph only, as the memory of the inner graphs inputs is rebound by their owner nodes.
      */
-    void Activate();
+    void Activate(bool interOpParallel = false);
+
+    /**
+     * Enable the cache of the shape plans of an activated dynamic graph, keyed by the graph input shapes
+     * (CPU_SHAPE_PLAN_CACHE_CAPACITY mode only). Must be called for the top level graph only.
+     */
+    void CreateShapePlanCache(size_t capacity);
+
+    const ShapePlanCache::Ptr& GetShapePlanCache() const {
+        return m_shapePlanCache;
+    }
 
     /**
      * Register the graph in the global allocation context by transforming
@@ -297,6 +313,9 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_interOpSchedule = {};
+        m_interOpAccesses.clear();
+        m_shapePlanCache.reset();
     }
     Status status{Status::NotReady};
 
@@ -326,8 +345,10 @@ protected:
     void ResolveComplexInplaceConflicts();
     bool ProcessDynNodes() const;
     void AllocateWithReuse(const std::vector<size_t>& syncNodesInds, GlobalExecutionIndex globalExecIndex);
-    void CreatePrimitivesAndExecConstants() const;
+    void CreatePrimitivesAndExecConstants();
     std::vector<size_t> CreateExecutionGraph();
+    void CollectInterOpAccesses(const AllocationContext& allocationContext);
+    void CreateInterOpSchedule();
 
     /**
      * Execute a given \p node within \p request using \p numaId
@@ -349,6 +370,7 @@ protected:
     void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
 
     void InferStatic(SyncInferRequest* request, int numaId);
+    void InferStaticInterOp(SyncInferRequest* request, int numaId);
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -372,6 +394,31 @@ private:
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
 
+    // dependencies between m_executableGraphNodes, by the index of the node
+    struct InterOpSchedule {
+        std::vector<std::vector<size_t>> successors;
+        std::vector<size_t> numPredecessors;
+        std::vector<size_t> roots;
+        // the number of not yet executed predecessors of the nodes during an inference
+        std::unique_ptr<std::atomic<size_t>[]> pending;
+    };
+    InterOpSchedule m_interOpSchedule;
+
+    // what a node of m_executableGraphNodes accesses, collected while the graph is activated to build the schedule
+    struct InterOpAccess {
+        std::vector<std::pair<uintptr_t, uintptr_t>> reads;
+        std::vector<std::pair<uintptr_t, uintptr_t>> writes;
+        // objects taken from the runtime caches (e.g. executors with scratch buffers), sorted
+        std::vector<const void*> cachedValues;
+        // the node has to be ordered with respect to all the other nodes
+        bool barrier = false;
+
+        [[nodiscard]] bool conflicts(const InterOpAccess& other) const;
+    };
+    std::vector<InterOpAccess> m_interOpAccesses;
+    bool m_interOpParallel = false;
+    ShapePlanCache::Ptr m_shapePlanCache;
+
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
 };
@@ -27,12 +27,17 @@ GraphContext::GraphContext(Config config,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
                            std::shared_ptr<CpuParallel> cpuParallel,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MultiCachePtr rtParamsCache,
+                           MultiCachePtr snippetsCodeCache)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
+      m_rtParamsCache(rtParamsCache ? std::move(rtParamsCache)
+                                     : std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
       m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
+      m_snippetsCodeCache(snippetsCodeCache ? std::move(snippetsCodeCache) : m_snippetsParamsCache),
       m_isGraphQuantizedFlag(isGraphQuantized),
+      m_privateScratchPads(m_config.interOpParallel),
       m_streamExecutor(std::move(streamExecutor)),
       m_cpuParallel(std::move(cpuParallel)),
       m_subMemoryManager(std::move(sub_memory_manager)),
@@ -37,7 +37,9 @@ public:
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
                  std::shared_ptr<CpuParallel> cpuParallel = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MultiCachePtr rtParamsCache = nullptr,
+                 MultiCachePtr snippetsCodeCache = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -55,10 +57,24 @@ public:
         return m_snippetsParamsCache;
     }
 
+    // generated code of the static snippets, may be shared by all the streams of the compiled model
+    [[nodiscard]] MultiCachePtr getSnippetsCodeCache() const {
+        return m_snippetsCodeCache;
+    }
+
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
+        if (m_privateScratchPads) {
+            return std::make_shared<DnnlScratchPad>(getEngine(), m_numaNodeId);
+        }
         return m_rtScratchPads[m_numaNodeId];
     }
 
+    // The nodes executed concurrently with other nodes (CPU_INTER_OP_PARALLEL mode, see Graph::Activate) cannot share
+    // a scratch pad, so in this mode every primitive gets a private one
+    [[nodiscard]] bool hasPrivateScratchPads() const {
+        return m_privateScratchPads;
+    }
+
     [[nodiscard]] const std::vector<DnnlScratchPadPtr>& getScratchPads() const {
         return m_rtScratchPads;
     }
@@ -117,10 +133,12 @@ private:
     // primitive cache
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
+    MultiCachePtr m_snippetsCodeCache;
     // global scratch pad
     DnnlScratchPadPtr m_rtScratchPad;
 
     bool m_isGraphQuantizedFlag = false;
+    bool m_privateScratchPads = false;
     // scratch pad per sub-stream
     std::vector<DnnlScratchPadPtr> m_rtScratchPads;
     // stream executor for current graph
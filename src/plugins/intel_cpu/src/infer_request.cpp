@@ -23,6 +23,7 @@
 #include "dnnl_extension_utils.h"
 #include "edge.h"
 #include "itt.h"
+#include "kv_cache_offload.h"
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -76,6 +77,21 @@ void SyncInferRequest::create_infer_request() {
 
     // create states according to the list of the MemoryStateNodes
     m_memory_states = m_compiled_model.graph().memoryStates();
+    if (const auto& offloader = m_compiled_model.kv_cache_offloader()) {
+        offloader->registerRequest(this, m_memory_states);
+    }
+}
+
+SyncInferRequest::~SyncInferRequest() {
+    if (const auto& offloader = m_compiled_model.kv_cache_offloader()) {
+        offloader->unregisterRequest(this);
+    }
+}
+
+void SyncInferRequest::prefetch_states() {
+    if (const auto& offloader = m_compiled_model.kv_cache_offloader()) {
+        offloader->prefetch(this);
+    }
 }
 
 void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
@@ -126,6 +142,9 @@ void SyncInferRequest::infer() {
 
     throw_if_canceled();
 
+    // the offloaded KV cache is read back before the states are assigned to the graph
+    KVCacheOffloader::Guard offloadGuard(m_compiled_model.kv_cache_offloader(), this);
+
     // state -> node
     if (!m_memory_states.empty()) {
         graph.assignStates(m_memory_states);
@@ -34,6 +34,7 @@ class AsyncInferRequest;
 class SyncInferRequest : public ov::ISyncInferRequest {
 public:
     explicit SyncInferRequest(CompiledModelHolder compiled_model);
+    ~SyncInferRequest() override;
 
     void infer() override;
 
@@ -63,6 +64,11 @@ public:
 
     void throw_if_canceled() const;
 
+    /**
+     * @brief Starts reading the offloaded KV cache of the request ahead of the inference, see KVCacheOffloader
+     */
+    void prefetch_states();
+
 private:
     class OutputControlBlock {
     public:
@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
 
@@ -20,6 +21,86 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Enables a thread safe CPU runtime parameters cache shared by all the streams of a compiled model for the
+ * cached objects which are immutable after the creation. Executors with per call scratch buffers or bound to the
+ * threading context of a stream are still cached per stream.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_shared{"CPU_RUNTIME_CACHE_SHARED"};
+
+/**
+ * @brief Enables an in-memory cache of the code generated for the static snippets subgraphs which is shared by the
+ * graphs of all the streams of a compiled model, so each subgraph is lowered once per process. The code is not stored
+ * in the exported compiled model.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_snippets_code_cache_shared{
+    "CPU_SNIPPETS_CODE_CACHE_SHARED"};
+
+/**
+ * @brief Reports hit, miss, eviction and size counters of the shared CPU runtime parameters cache.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Reports queue depth, executed, stolen and overflowed task counters of the inference streams, summed over the
+ * streams. Only available when the streams work stealing mode (ov::internal::streams_work_stealing) is enabled.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_streams_statistics{
+    "CPU_STREAMS_STATISTICS"};
+
+/**
+ * @brief Directory through which the repacked weights are shared with the other processes of the host that run the same
+ * model, so they all map one physical copy of the packed weights. A tmpfs mount (e.g. /dev/shm) keeps the weights in
+ * RAM. Empty (default) keeps the repacked weights private to the process.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_shared_weights_dir{"CPU_SHARED_WEIGHTS_DIR"};
+
+/**
+ * @brief Stores the repacked (blocked) weights in the exported compiled model, tagged with the CPU ISA they are packed
+ * for. A compiled model imported on a CPU with the same ISA uses them in place instead of repacking the weights.
+ * Ignored with ov::CacheMode::OPTIMIZE_SIZE.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_cache_packed_weights{"CPU_CACHE_PACKED_WEIGHTS"};
+
+/**
+ * @brief Directory for the KV cache of idle stateful infer requests. When set, the KV cache states of the least
+ * recently used infer requests above ov::intel_cpu::cpu_kv_cache_resident_requests are moved to files in this directory
+ * in the background and are read back on the next inference of the request. A directory created by the plugin and the
+ * files are accessible to the current user only. Empty (default) keeps the KV cache of all requests in memory.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_kv_cache_offload_dir{"CPU_KV_CACHE_OFFLOAD_DIR"};
+
+/**
+ * @brief Number of infer requests which keep their KV cache in memory when ov::intel_cpu::cpu_kv_cache_offload_dir is
+ * set. 0 (default) means the number of inference streams.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> cpu_kv_cache_resident_requests{
+    "CPU_KV_CACHE_RESIDENT_REQUESTS"};
+
+/**
+ * @brief Executes the independent branches of a static model concurrently. The dependencies between the nodes are
+ * derived at compile time from the data they read and write, including the memory reused by the memory solver, and
+ * the ready nodes run as tasks of the stream, each of them using the threads of the stream for its own parallel loops.
+ * The nodes sharing an executor taken from the runtime cache are ordered, and every primitive gets its own scratch pad
+ * instead of the one shared by the stream. Models with dynamic shapes are executed sequentially.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_inter_op_parallel{"CPU_INTER_OP_PARALLEL"};
+
+/**
+ * @brief Defines how many shape plans of a dynamic model are cached per stream. A shape plan keeps the output dims of
+ * the nodes inferred for a signature of the input shapes, so an inference which repeats a cached signature skips the
+ * shape inference of the nodes whose output shapes do not depend on the input data. 0 (default) disables the cache.
+ */
+static constexpr Property<int32_t, PropertyMutability::RW> cpu_shape_plan_cache_capacity{
+    "CPU_SHAPE_PLAN_CACHE_CAPACITY"};
+
+/**
+ * @brief Reports hit, miss, eviction and size counters of the shape plan caches, summed over the streams.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_shape_plan_cache_statistics{
+    "CPU_SHAPE_PLAN_CACHE_STATISTICS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -0,0 +1,207 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_offload.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "memory_state.h"
+#include "openvino/runtime/internal_properties.hpp"
+#include "utils/owner_only_file.hpp"
+
+namespace ov::intel_cpu {
+
+KVCacheOffloader::KVCacheOffloader(std::filesystem::path dir, size_t maxResidentRequests)
+    : m_dir(std::move(dir)),
+      m_maxResidentRequests(maxResidentRequests),
+      m_filePrefix((static_cast<uint64_t>(std::random_device{}()) << 32) | std::random_device{}()) {}
+
+KVCacheOffloader::~KVCacheOffloader() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_offloadRequested.notify_all();
+    if (m_offloadThread.joinable()) {
+        m_offloadThread.join();
+    }
+}
+
+void KVCacheOffloader::start() {
+    // the offloaded cache holds user data, so the directory is not accessible to other users
+    createOwnerOnlyDirectory(m_dir);
+    m_offloadThread = std::thread([this] {
+        offloadLoop();
+    });
+}
+
+void KVCacheOffloader::registerRequest(const void* request, const std::vector<MemStatePtr>& states) {
+    Entry entry;
+    for (const auto& state : states) {
+        auto kvState = std::dynamic_pointer_cast<VariableStateKVcache>(state);
+        if (kvState && kvState->get_spec().alg != ov::internal::CacheQuantAlgorithm::TURBO) {
+            entry.states.push_back(std::move(kvState));
+        }
+    }
+    if (entry.states.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_offloadThread.joinable()) {
+        start();
+    }
+    auto& registered = m_entries.emplace(request, std::move(entry)).first->second;
+    registered.idlePos = m_idleRequests.insert(m_idleRequests.end(), request);
+    m_residentRequests++;
+}
+
+void KVCacheOffloader::unregisterRequest(const void* request) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(request);
+    if (it == m_entries.end()) {
+        return;
+    }
+    auto& entry = it->second;
+    m_released.wait(lock, [&entry] {
+        return !entry.busy && !entry.writing;
+    });
+    // a pending request is not counted as resident, its queued offload is skipped
+    if (!entry.offloaded && !entry.pending) {
+        m_idleRequests.erase(entry.idlePos);
+        m_residentRequests--;
+    }
+    // the offloaded files are removed together with the states
+    m_entries.erase(request);
+}
+
+void KVCacheOffloader::prefetch(const void* request) {
+    std::vector<std::shared_ptr<VariableStateKVcache>> states;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(request);
+        if (it == m_entries.end() || !it->second.offloaded || it->second.busy) {
+            return;
+        }
+        states = it->second.states;
+    }
+    for (const auto& state : states) {
+        state->prefetch();
+    }
+}
+
+void KVCacheOffloader::acquire(const void* request) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(request);
+    if (it == m_entries.end()) {
+        return;
+    }
+    auto& entry = it->second;
+    m_released.wait(lock, [&entry] {
+        return !entry.busy && !entry.writing;
+    });
+    entry.busy = true;
+    if (entry.pending) {
+        // the offload has not started yet, the states are still in memory
+        entry.pending = false;
+        m_residentRequests++;
+        return;
+    }
+    if (!entry.offloaded) {
+        m_idleRequests.erase(entry.idlePos);
+        return;
+    }
+
+    lock.unlock();
+    try {
+        for (const auto& state : entry.states) {
+            state->restore();
+        }
+    } catch (...) {
+        lock.lock();
+        entry.busy = false;
+        m_released.notify_all();
+        throw;
+    }
+    lock.lock();
+    entry.offloaded = false;
+    m_residentRequests++;
+}
+
+void KVCacheOffloader::release(const void* request) {
+    bool scheduled = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(request);
+        if (it == m_entries.end()) {
+            return;
+        }
+        auto& entry = it->second;
+        entry.busy = false;
+        entry.idlePos = m_idleRequests.insert(m_idleRequests.end(), request);
+        while (m_residentRequests > m_maxResidentRequests && !m_idleRequests.empty()) {
+            const auto* victim = m_idleRequests.front();
+            m_idleRequests.pop_front();
+            m_entries.at(victim).pending = true;
+            m_pendingOffloads.push_back(victim);
+            m_residentRequests--;
+            scheduled = true;
+        }
+    }
+    m_released.notify_all();
+    if (scheduled) {
+        m_offloadRequested.notify_one();
+    }
+}
+
+void KVCacheOffloader::offloadLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_offloadRequested.wait(lock, [this] {
+            return m_stop || !m_pendingOffloads.empty();
+        });
+        if (m_stop) {
+            return;
+        }
+        const auto* request = m_pendingOffloads.front();
+        m_pendingOffloads.pop_front();
+        // the request may have been acquired or unregistered since it was scheduled
+        auto it = m_entries.find(request);
+        if (it == m_entries.end() || !it->second.pending) {
+            continue;
+        }
+        auto& entry = it->second;
+        entry.pending = false;
+        entry.writing = true;
+        // the entry is not erased while it is being written, see unregisterRequest()
+        lock.unlock();
+        offload(entry);
+        lock.lock();
+        entry.writing = false;
+        entry.offloaded = true;
+        m_released.notify_all();
+    }
+}
+
+void KVCacheOffloader::offload(Entry& entry) {
+    for (const auto& state : entry.states) {
+        std::stringstream name;
+        name << "ov_cpu_kv_" << std::hex << std::setw(16) << std::setfill('0') << m_filePrefix << "_" << std::dec
+             << m_fileCounter++ << ".bin";
+        // a state which failed to offload stays in memory and is used as is
+        state->offload((m_dir / name.str()).string());
+    }
+}
+
+}  // namespace ov::intel_cpu
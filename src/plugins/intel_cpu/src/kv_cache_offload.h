@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "memory_state.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * Keeps the KV cache states of at most `maxResidentRequests` infer requests of a compiled model in memory. When more
+ * requests hold KV cache, the states of the least recently used idle requests are moved to files in `dir` (see
+ * VariableStateKVcache::offload) by a background thread, so the request which triggered the eviction does not wait for
+ * the writes. An offloaded request is prefetched when it is started and its states are read back when it runs the next
+ * inference, as a part of its asynchronous pipeline.
+ *
+ * The directory and the thread are created with the first request which has a KV cache state.
+ */
+class KVCacheOffloader {
+public:
+    using Ptr = std::shared_ptr<KVCacheOffloader>;
+
+    KVCacheOffloader(std::filesystem::path dir, size_t maxResidentRequests);
+    ~KVCacheOffloader();
+
+    KVCacheOffloader(const KVCacheOffloader&) = delete;
+    KVCacheOffloader& operator=(const KVCacheOffloader&) = delete;
+
+    void registerRequest(const void* request, const std::vector<MemStatePtr>& states);
+    void unregisterRequest(const void* request);
+
+    // Starts reading the offloaded states of the request ahead of acquire(), does not block
+    void prefetch(const void* request);
+    // Makes the states of the request resident, they are not offloaded until release()
+    void acquire(const void* request);
+    // Marks the request as the most recently used and schedules the offload of the requests above the limit
+    void release(const void* request);
+
+    // Acquires the request for the scope of an inference
+    class Guard {
+    public:
+        Guard(const Ptr& offloader, const void* request) : m_offloader(offloader), m_request(request) {
+            if (m_offloader) {
+                m_offloader->acquire(m_request);
+            }
+        }
+        ~Guard() {
+            if (m_offloader) {
+                m_offloader->release(m_request);
+            }
+        }
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        const Ptr& m_offloader;
+        const void* m_request;
+    };
+
+private:
+    struct Entry {
+        std::vector<std::shared_ptr<VariableStateKVcache>> states;
+        // runs an inference
+        bool busy = false;
+        // waits in m_pendingOffloads, acquire() takes it back without any I/O
+        bool pending = false;
+        // the states are being written by the offload thread
+        bool writing = false;
+        bool offloaded = false;
+        // position in m_idleRequests, valid for an idle resident request
+        std::list<const void*>::iterator idlePos;
+    };
+
+    void start();
+    void offloadLoop();
+    void offload(Entry& entry);
+
+    std::filesystem::path m_dir;
+    size_t m_maxResidentRequests;
+    uint64_t m_filePrefix;
+    std::atomic<uint64_t> m_fileCounter{0};
+
+    std::mutex m_mutex;
+    std::condition_variable m_released;
+    std::unordered_map<const void*, Entry> m_entries;
+    // idle resident requests, the least recently used first
+    std::list<const void*> m_idleRequests;
+    size_t m_residentRequests = 0;
+
+    // requests to offload, served by m_offloadThread in order
+    std::deque<const void*> m_pendingOffloads;
+    std::condition_variable m_offloadRequested;
+    std::thread m_offloadThread;
+    bool m_stop = false;
+};
+
+}  // namespace ov::intel_cpu
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -229,13 +230,24 @@ private:
             box.size = div_up(box.size, alignment);
         });
 
-        ov::MemorySolver staticMemSolver(boxes_to_process);
-        m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+        // Neither placement heuristic dominates the other on real graphs, and both are cheap compared to the
+        // graph compilation, so pack with each of them and keep the smaller workspace
+        std::unique_ptr<ov::MemorySolver> staticMemSolver;
+        int64_t minRequired = 0;
+        for (auto strategy : {ov::MemorySolver::Strategy::POPUP, ov::MemorySolver::Strategy::BEST_FIT}) {
+            auto solver = std::make_unique<ov::MemorySolver>(boxes_to_process, strategy);
+            const int64_t required = solver->solve();
+            if (!staticMemSolver || required < minRequired) {
+                staticMemSolver = std::move(solver);
+                minRequired = required;
+            }
+        }
+        m_totalSize = static_cast<size_t>(minRequired) * alignment;
 
         m_workspace = std::make_shared<MemoryBlockWithRelease>();
 
         for (const auto& box : boxes_to_process) {
-            int64_t offset = staticMemSolver.get_offset(static_cast<int>(box.id));
+            int64_t offset = staticMemSolver->get_offset(static_cast<int>(box.id));
             auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offset * alignment);
             m_blocks[box.id] = std::move(memoryBlock);
         }
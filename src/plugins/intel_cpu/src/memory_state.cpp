@@ -9,9 +9,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -31,9 +38,16 @@
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/itensor.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "openvino/util/mmap_object.hpp"
+#include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#include "utils/owner_only_file.hpp"
 #include "utils/plain_tensor.hpp"
 
+#ifndef _WIN32
+#    include <sys/mman.h>
+#endif
+
 using namespace ov::Extensions::Cpu::XARCH;
 
 namespace ov::intel_cpu {
@@ -224,6 +238,14 @@ void VariableStateSingleBuffer::commit_impl() {
     // nothing to do
 }
 
+namespace {
+
+size_t scale_zp_bytes(const VectorDims& dims) {
+    return dims.empty() ? 0 : std::accumulate(dims.begin(), dims.end(), sizeof(float), std::multiplies<>());
+}
+
+}  // namespace
+
 VariableStateKVcache::VariableStateKVcache(const std::string& name,
                                            MemoryDescPtr external_desc,
                                            BlockedMemoryDescPtr dense_internal_desc,
@@ -235,18 +257,26 @@ VariableStateKVcache::VariableStateKVcache(const std::string& name,
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
 }
 
+VariableStateKVcache::~VariableStateKVcache() {
+    drop_offloaded();
+}
+
 ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     OPENVINO_ASSERT(m_spec.alg != ov::internal::CacheQuantAlgorithm::TURBO,
                     "get_state() is not supported for KV cache with TURBO quantization. "
                     "TURBO stores packed bits and per-token norm in separate metadata; "
                     "scalar dequant path cannot reconstruct the original tensor.");
-    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    // an offloaded state is read from the file, but stays offloaded
+    auto [internal_mem, hidden_state, scale_zp] =
+        m_offloaded ? load_offloaded() : ResidentCache{m_internal_mem, m_hidden_state, m_scale_zp};
+    if (!internal_mem || !hidden_state || is_reset_state()) {
         auto new_desc = to_static(get_external_desc());
         auto external_mem = std::make_shared<Memory>(get_engine(), new_desc);
         return std::make_shared<Tensor>(external_mem);
     }
 
-    auto actual_internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    auto actual_internal_desc = internal_mem->getDescWithType<BlockedMemoryDesc>();
     auto&& dims = actual_internal_desc->getShape().getStaticDims();
 
     auto actual_external_desc = get_external_desc()->cloneWithNewDims(dims);
@@ -264,8 +294,8 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
     PlainTensor pastkv;
     PlainTensor beam_table;
     output.reset(external_mem);
-    beam_table.reset(m_hidden_state);
-    pastkv.reset(m_internal_mem);
+    beam_table.reset(hidden_state);
+    pastkv.reset(internal_mem);
     output = output.permute(actual_internal_order);
     pastkv = pastkv.permute(actual_internal_order);
     // S should be always the last dimension
@@ -288,8 +318,8 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
                                            S,
                                            pastkv.m_strides[2],
                                            S,
-                                           m_scale_zp.ptr<float>(group_id * 2, b_kv, h),
-                                           m_scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
+                                           scale_zp.ptr<float>(group_id * 2, b_kv, h),
+                                           scale_zp.ptr<float>(group_id * 2 + 1, b_kv, h));
                 cpu_parallel_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
         } else {
@@ -300,7 +330,7 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
                     attn_dequant_u8(pastkv.ptr<uint8_t>(m, b_kv, h, group_id * m_spec.group_size),
                                     buffers[ithr].ptr<float>() + group_id * m_spec.group_size,
                                     m_spec.group_size,
-                                    m_scale_zp.ptr<float>(m, b_kv, h, group_id * 2));
+                                    scale_zp.ptr<float>(m, b_kv, h, group_id * 2));
                 }
                 cpu_parallel_convert(buffers[ithr].ptr<float>(), output.ptr_v(m, b, h), element::f32, output.m_dt, S);
             });
@@ -320,6 +350,8 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
                     "set_state() is not supported for KV cache with TURBO quantization. "
                     "TURBO requires rotation+codebook encoding plus per-token norm metadata "
                     "owned by the SDPA node; external state cannot be injected directly.");
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    drop_offloaded();
     // 1. reset the memory object
     m_state = state;  // simply to extend the lifetime
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
@@ -409,7 +441,8 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
 }
 
 void VariableStateKVcache::reset_impl() {
-    // nothing to do
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    drop_offloaded();
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -443,4 +476,124 @@ MemoryPtr VariableStateKVcache::hidden_state_mem() const {
 void VariableStateKVcache::assign_hidden_state(const MemoryPtr& mem) {
     m_hidden_state = mem;
 }
+
+bool VariableStateKVcache::offload(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    // TURBO keeps a part of the cache (per-token norms) in the node, so such a state stays resident
+    if (m_offloaded || !m_internal_mem || !m_hidden_state || is_reset_state() ||
+        m_spec.alg == ov::internal::CacheQuantAlgorithm::TURBO) {
+        return false;
+    }
+
+    OffloadedCache offloaded{path, m_internal_mem->getDescPtr(), m_hidden_state->getDescPtr(), m_scale_zp.shape()};
+    try {
+        // the cache holds user data, so the file is not accessible to other users
+        createOwnerOnlyFile(path);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        OPENVINO_ASSERT(file.is_open(), "Cannot open ", path);
+        file.write(m_internal_mem->getDataAs<const char>(),
+                   static_cast<std::streamsize>(offloaded.internal_desc->getCurrentMemSize()));
+        file.write(m_hidden_state->getDataAs<const char>(),
+                   static_cast<std::streamsize>(offloaded.hidden_desc->getCurrentMemSize()));
+        if (m_scale_zp) {
+            file.write(m_scale_zp.ptr<const char>(),
+                       static_cast<std::streamsize>(scale_zp_bytes(offloaded.scale_zp_dims)));
+        }
+        OPENVINO_ASSERT(file.good(), "Cannot write ", path);
+    } catch (const std::exception& e) {
+        DEBUG_LOG("Cannot offload KV cache state ", get_name(), " to ", path, ": ", e.what());
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        return false;
+    }
+
+    m_offloaded = std::move(offloaded);
+    m_internal_mem.reset();
+    m_hidden_state.reset();
+    m_scale_zp = PlainTensor{};
+    // the node reallocates the buffers when the state grows, so no memory is kept in reserve
+    m_internal_mem_max_size = 0;
+    m_hidden_state_max_size = 0;
+    return true;
+}
+
+void VariableStateKVcache::prefetch() {
+    std::unique_lock<std::mutex> lock(m_offload_mutex, std::try_to_lock);
+    if (!lock.owns_lock() || !m_offloaded || m_offloaded->mapping) {
+        return;
+    }
+    try {
+        m_offloaded->mapping = ov::load_mmap_object(m_offloaded->path);
+    } catch (const std::exception& e) {
+        DEBUG_LOG("Cannot map offloaded KV cache ", m_offloaded->path, ": ", e.what());
+        return;
+    }
+#ifndef _WIN32
+    // the pages are read ahead by the OS while the request waits for its stream
+    if (m_offloaded->mapping->size() != 0) {
+        madvise(m_offloaded->mapping->data(), m_offloaded->mapping->size(), MADV_WILLNEED);
+    }
+#endif
+}
+
+void VariableStateKVcache::restore() {
+    std::lock_guard<std::mutex> lock(m_offload_mutex);
+    if (!m_offloaded) {
+        return;
+    }
+    auto [internal_mem, hidden_state, scale_zp] = load_offloaded();
+    m_internal_mem = internal_mem;
+    m_hidden_state = hidden_state;
+    m_scale_zp = scale_zp;
+    // the restored buffers hold exactly the current tokens, the node reallocates them on the next growth
+    const auto& internal_desc = m_internal_mem->getDesc();
+    const auto& hidden_desc = m_hidden_state->getDesc();
+    m_internal_mem_max_size = internal_desc.getCurrentMemSize() / internal_desc.getPrecision().size();
+    m_hidden_state_max_size = hidden_desc.getCurrentMemSize() / hidden_desc.getPrecision().size();
+    drop_offloaded();
+}
+
+VariableStateKVcache::ResidentCache VariableStateKVcache::load_offloaded() const {
+    const auto& offloaded = *m_offloaded;
+    const auto internal_size = offloaded.internal_desc->getCurrentMemSize();
+    const auto hidden_size = offloaded.hidden_desc->getCurrentMemSize();
+    const auto scale_zp_size = scale_zp_bytes(offloaded.scale_zp_dims);
+
+    auto mapping = offloaded.mapping ? offloaded.mapping : ov::load_mmap_object(offloaded.path);
+    OPENVINO_ASSERT(mapping->size() == internal_size + hidden_size + scale_zp_size,
+                    "Offloaded KV cache file ",
+                    offloaded.path,
+                    " of state ",
+                    get_name(),
+                    " is corrupted");
+    // the pages are read back in parallel chunks
+    auto copy = [&](void* dst, size_t offset, size_t size) {
+        constexpr size_t chunk = 1024 * 1024;
+        parallel_for(div_up(size, chunk), [&](size_t i) {
+            const auto begin = i * chunk;
+            std::memcpy(static_cast<uint8_t*>(dst) + begin,
+                        mapping->data() + offset + begin,
+                        std::min(chunk, size - begin));
+        });
+    };
+
+    ResidentCache cache;
+    cache.internal_mem = std::make_shared<Memory>(get_engine(), offloaded.internal_desc);
+    cache.hidden_state = std::make_shared<Memory>(get_engine(), offloaded.hidden_desc);
+    copy(cache.internal_mem->getData(), 0, internal_size);
+    copy(cache.hidden_state->getData(), internal_size, hidden_size);
+    if (scale_zp_size != 0) {
+        cache.scale_zp.resize<float>(offloaded.scale_zp_dims);
+        copy(cache.scale_zp.ptr<float>(), internal_size + hidden_size, scale_zp_size);
+    }
+    return cache;
+}
+
+void VariableStateKVcache::drop_offloaded() {
+    if (m_offloaded) {
+        std::error_code ec;
+        std::filesystem::remove(m_offloaded->path, ec);
+        m_offloaded.reset();
+    }
+}
 }  // namespace ov::intel_cpu
@@ -7,16 +7,20 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 #include <string>
 
 #include "cpu_memory.h"
+#include "cpu_types.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "nodes/kernels/scaled_attn/cache_spec.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "utils/plain_tensor.hpp"
 
 namespace ov::intel_cpu {
@@ -125,6 +129,7 @@ public:
                          MemoryDescPtr external_desc,
                          BlockedMemoryDescPtr dense_internal_desc,
                          ov::Extensions::Cpu::CacheSpec spec);
+    ~VariableStateKVcache() override;
 
     // ov::IVariableState
     ov::SoPtr<ov::ITensor> get_state() const override;
@@ -166,12 +171,39 @@ public:
         return m_spec;
     }
 
+    // Moves the KV cache to the file at `path` and releases its memory. Must not be called during an inference which
+    // uses the state. Returns false if the cache was kept in memory.
+    bool offload(const std::string& path);
+    // Maps the offloaded KV cache and asks the OS to read it ahead, so restore() copies from memory. Never blocks on
+    // a concurrent offload() or restore(), it is only a hint.
+    void prefetch();
+    // Reads the offloaded KV cache back to memory, no-op for a resident state
+    void restore();
+
 private:
+    struct OffloadedCache {
+        std::string path;
+        MemoryDescPtr internal_desc;
+        MemoryDescPtr hidden_desc;
+        VectorDims scale_zp_dims;
+        // set by prefetch()
+        std::shared_ptr<ov::MappedMemory> mapping;
+    };
+
+    struct ResidentCache {
+        MemoryPtr internal_mem;
+        MemoryPtr hidden_state;
+        PlainTensor scale_zp;
+    };
+
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
     void reset_impl() override;
     void commit_impl() override;
 
+    ResidentCache load_offloaded() const;
+    void drop_offloaded();
+
     MemoryPtr m_internal_mem;  // kv cache
     MemoryPtr m_hidden_state;  // beam access table
     size_t m_internal_mem_max_size = 0;
@@ -183,6 +215,9 @@ private:
     // for u8 kv cache: [B, H, L, 2], 0 for scale, 1 for zp
     PlainTensor m_scale_zp;
     ov::Extensions::Cpu::CacheSpec m_spec;
+
+    std::optional<OffloadedCache> m_offloaded;
+    mutable std::mutex m_offload_mutex;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
@@ -793,6 +793,39 @@ void Node::updateShapes() {
     }
 }
 
+void Node::updateShapes(NodeShapePlan& plan) {
+    const size_t inputsNum = getParentEdges().size();
+    bool planned = !plan.outputDims.empty() && plan.inputDims.size() == inputsNum;
+    for (size_t i = 0; planned && i < inputsNum; i++) {
+        planned = plan.inputDims[i] == getParentEdgeAt(i)->getMemory().getStaticDims();
+    }
+
+    if (!planned) {
+        updateShapes();
+        plan.inputDims.resize(inputsNum);
+        for (size_t i = 0; i < inputsNum; i++) {
+            plan.inputDims[i] = getParentEdgeAt(i)->getMemory().getStaticDims();
+        }
+        plan.outputDims.resize(outputShapes.size());
+        for (size_t port = 0; port < outputShapes.size(); port++) {
+            const auto& shape = getChildEdgeAt(port)->getMemory().getShape();
+            if (!shape.isStatic()) {
+                // the output shapes are only known after the execution
+                plan.replayable = false;
+                return;
+            }
+            plan.outputDims[port] = shape.getStaticDims();
+        }
+        return;
+    }
+
+    try {
+        redefineOutputMemory(plan.outputDims);
+    } catch (const std::exception& exp) {
+        CPU_NODE_THROW(exp.what());
+    }
+}
+
 void Node::updateDynamicParams() {
     OPENVINO_ASSERT(isDynamicNode(),
                     "Node::updateDynamicParams() is called to a static shape node of type: ",
@@ -1132,7 +1165,10 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
     if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
         const auto string_hash = name + "_" + std::to_string(indx) + "_" +
                                  DnnlExtensionUtils::computeWeightsStringHash(internalBlob, intDesc);
-        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreate(string_hash, create));
+        auto persistentKey = [&]() {
+            return DnnlExtensionUtils::computeWeightsContentHash(internalBlob, internalBlob->getDescPtr(), intDesc);
+        };
+        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreate(string_hash, create, persistentKey, engine, intDesc));
     } else {
         ptr = create();
     }
@@ -1178,7 +1214,11 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     auto weightCache = context->getWeightsCache();
     if (weightCache != nullptr) {
         const auto string_hash = DnnlExtensionUtils::computeWeightsStringHash(edgeMem, dstWeightDesc);
-        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreate(string_hash, create));
+        auto persistentKey = [&]() {
+            return DnnlExtensionUtils::computeWeightsContentHash(edgeMem, srcWeightDesc, dstWeightDesc);
+        };
+        ptr = static_cast<MemoryPtr>(
+            *weightCache->findOrCreate(string_hash, create, persistentKey, getEngine(), dstWeightDesc));
     } else {
         ptr = create();
     }
@@ -41,6 +41,7 @@
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "perf_count.h"
+#include "shape_plan_cache.h"
 #include "utils/bit_util.hpp"
 #include "utils/debug_capabilities.h"
 
@@ -491,6 +492,9 @@ public:
     // is a temprorary solution, do it this way for now.
     void executeStatic(const dnnl::stream& strm, int numaId = -1);
     void updateShapes();
+    // Same as updateShapes(), but takes the output dims from the plan when the input dims match the recorded ones,
+    // otherwise records the inferred output dims into the plan
+    void updateShapes(NodeShapePlan& plan);
     void updateDynamicParams();
     void executeDynamic(const dnnl::stream& strm, int numaId = -1);
     virtual void redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes);
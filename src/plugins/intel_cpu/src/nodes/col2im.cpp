@@ -4,6 +4,7 @@
 
 #include "col2im.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -23,7 +24,6 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/col2im.hpp"
-#include "openvino/reference/col2im.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 
@@ -114,15 +114,63 @@ void Col2Im::executeDynamicImpl(const dnnl::stream& strm) {
 
 template <class T, class T_idx>
 void Col2Im::executeImpl() {
-    ov::reference::col2im<T, T_idx>(getSrcDataAtPortAs<const T>(0),
-                                    ov::Shape{getSrcMemoryAtPort(0)->getStaticDims()},
-                                    getSrcDataAtPortAs<const T_idx>(1),
-                                    getSrcDataAtPortAs<const T_idx>(2),
-                                    getDstDataAtPortAs<T>(0),
-                                    strides,
-                                    dilations,
-                                    padsBegin,
-                                    padsEnd);
+    const auto* data = getSrcDataAtPortAs<const T>(0);
+    const auto* outputSize = getSrcDataAtPortAs<const T_idx>(1);
+    const auto* kernelSize = getSrcDataAtPortAs<const T_idx>(2);
+    auto* out = getDstDataAtPortAs<T>(0);
+    const auto& dataDims = getSrcMemoryAtPort(0)->getStaticDims();
+
+    const bool isBatched = dataDims.size() == 3;
+    const auto batchCount = static_cast<int64_t>(isBatched ? dataDims[0] : 1);
+    const auto channelsPerColumn = static_cast<int64_t>(dataDims[isBatched ? 1 : 0]);
+    const auto outH = static_cast<int64_t>(outputSize[0]);
+    const auto outW = static_cast<int64_t>(outputSize[1]);
+    const auto kernelH = static_cast<int64_t>(kernelSize[0]);
+    const auto kernelW = static_cast<int64_t>(kernelSize[1]);
+    const int64_t kernelProduct = kernelH * kernelW;
+    const int64_t channelCount = channelsPerColumn / kernelProduct;
+
+    auto originalDim = [&](int64_t size, int64_t kernel, size_t idx) {
+        const auto padded = size + static_cast<int64_t>(padsBegin[idx] + padsEnd[idx]);
+        const auto dilatedKernel = static_cast<int64_t>(dilations[idx]) * (kernel - 1) + 1;
+        return (padded - dilatedKernel) / static_cast<int64_t>(strides[idx]) + 1;
+    };
+    const int64_t columnH = originalDim(outH, kernelH, 0);
+    const int64_t columnW = originalDim(outW, kernelW, 1);
+    const auto strideH = static_cast<int64_t>(strides[0]);
+    const auto strideW = static_cast<int64_t>(strides[1]);
+    const auto dilationH = static_cast<int64_t>(dilations[0]);
+    const auto dilationW = static_cast<int64_t>(dilations[1]);
+    const auto padH = static_cast<int64_t>(padsBegin[0]);
+    const auto padW = static_cast<int64_t>(padsBegin[1]);
+
+    // every output image plane is accumulated by one thread from the kernel columns of its channel,
+    // in the same order as the reference implementation
+    context->getCpuParallel()->parallel_for2d(batchCount, channelCount, [&](int64_t batch, int64_t channel) {
+        T* image = out + (batch * channelCount + channel) * outH * outW;
+        std::fill_n(image, outH * outW, T(0));
+        for (int64_t kh = 0; kh < kernelH; kh++) {
+            for (int64_t kw = 0; kw < kernelW; kw++) {
+                const int64_t column = (channel * kernelH + kh) * kernelW + kw;
+                const T* columnData = data + (batch * channelsPerColumn + column) * columnH * columnW;
+                // the range of the column positions which are inside the image
+                const int64_t wOffset = kw * dilationW - padW;
+                const int64_t wBegin = std::max<int64_t>(0, (-wOffset + strideW - 1) / strideW);
+                const int64_t wEnd = std::min(columnW, wOffset >= outW ? 0 : (outW - wOffset + strideW - 1) / strideW);
+                for (int64_t h = 0; h < columnH; h++) {
+                    const int64_t imageH = h * strideH - padH + kh * dilationH;
+                    if (imageH < 0 || imageH >= outH) {
+                        continue;
+                    }
+                    const T* src = columnData + h * columnW;
+                    T* dst = image + imageH * outW;
+                    for (int64_t w = wBegin; w < wEnd; w++) {
+                        dst[w * strideW + wOffset] += src[w];
+                    }
+                }
+            }
+        }
+    });
 }
 
 namespace {
@@ -16,6 +16,8 @@
 namespace ov::intel_cpu {
 
 struct ReorderKey {
+    // the primitive is executed on the caller's stream, the scratchpad is allocated per execution
+    static constexpr bool shareable_between_streams = true;
     dnnl::memory::desc src;
     dnnl::memory::desc dest;
     [[nodiscard]] size_t hash() const;
@@ -35,6 +35,8 @@ public:
 
     enum Mode : uint8_t { BLOCKS_FIRST = 0, DEPTH_FIRST = 1 };
     struct DepthToSpaceAttrs {
+        // the permute kernel keeps no per call state and takes the threading context as an argument
+        static constexpr bool shareable_between_streams = true;
         LayoutType layoutType = LayoutType::nspc;
         Mode mode = BLOCKS_FIRST;
         size_t blockSize = 0LU;
@@ -63,12 +63,14 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
         }
     }
 
+    // https://oneapi-src.github.io/oneDNN/dev_guide_int8_computations.html?highlight=128#inputs-of-the-same-type-s8
+    const auto src_wdt = srcWeightDesc->getPrecision();
+    const auto dst_wdt = dstWeightDesc->getPrecision();
+    const bool shiftSignedToUnsigned = needShiftSignedToUnsigned && src_wdt.is_integral_number() &&
+                                       src_wdt.is_signed() && dst_wdt.is_integral_number() && !dst_wdt.is_signed();
+
     auto create = [&]() {
-        // https://oneapi-src.github.io/oneDNN/dev_guide_int8_computations.html?highlight=128#inputs-of-the-same-type-s8
-        auto src_wdt = srcWeightDesc->getPrecision();
-        auto dst_wdt = dstWeightDesc->getPrecision();
-        if (needShiftSignedToUnsigned && src_wdt.is_integral_number() && src_wdt.is_signed() &&
-            dst_wdt.is_integral_number() && !dst_wdt.is_signed()) {
+        if (shiftSignedToUnsigned) {
             assert(src_wdt.bitwidth() == dst_wdt.bitwidth());
 
             // prevent reorderData from doing conversion
@@ -105,9 +107,16 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
 
     MemoryPtr ptr;
     if (globalWeightCache && dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
+        auto persistentKey = [&]() {
+            return DnnlExtensionUtils::computeWeightsContentHash(weightsMem, srcWeightDesc, dstWeightDesc) +
+                   (shiftSignedToUnsigned ? "_shifted" : "");
+        };
         ptr = MemoryPtr(
             *globalWeightCache->findOrCreate(DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc),
-                                             create));
+                                             create,
+                                             persistentKey,
+                                             eng,
+                                             dstWeightDesc));
     } else {
         ptr = create();
     }
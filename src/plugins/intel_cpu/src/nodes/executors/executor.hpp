@@ -61,6 +61,7 @@ public:
           implPriorities(std::move(implPriorities)),
           privateWeighCache(std::move(privateWeighCache)),
           numNumaNodes(graphContext->getNumNumaNodes()),
+          privateScratchPads(graphContext->hasPrivateScratchPads()),
           cpuParallel(graphContext->getCpuParallel()) {
         auto cpuStreamsExecutor = graphContext->getCPUStreamExecutor();
         curNumaNodeId = std::max(0, cpuStreamsExecutor ? cpuStreamsExecutor->get_numa_node_id() : curNumaNodeId);
@@ -73,6 +74,9 @@ public:
     }
 
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
+        if (privateScratchPads) {
+            return std::make_shared<DnnlScratchPad>(engine, curNumaNodeId);
+        }
         return scratchPads[curNumaNodeId];
     }
 
@@ -112,6 +116,8 @@ private:
     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache;
     int numNumaNodes;
     int curNumaNodeId = -1;
+    // the executor gets its own scratch pad (CPU_INTER_OP_PARALLEL mode only)
+    bool privateScratchPads = false;
     std::shared_ptr<CpuParallel> cpuParallel;
 };
 
@@ -4,27 +4,58 @@
 
 #include "lora.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "cpu_memory.h"
+#include "cpu_shape.h"
 #include "graph_context.h"
 #include "memory_desc/blocked_memory_desc.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
 #include "node.h"
+#include "nodes/common/blocked_desc_creator.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/executor_factory.hpp"
+#include "nodes/executors/matmul_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
 #include "nodes/input.h"
 #include "nodes/node_config.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
 #include "ov_ops/lora_subgraph.hpp"
 #include "shape_inference/shape_inference_pass_through.hpp"
+#include "utils/general_utils.h"
 
 namespace ov::intel_cpu::node {
 
+namespace {
+// the rows of an adapter are padded, so a few GEMM primitives serve all the numbers of rows
+size_t normalizeRows(size_t rows) {
+    if (rows < 512) {
+        return rnd_up(rows, 16);
+    }
+    if (rows < 1024) {
+        return rnd_up(rows, 32);
+    }
+    return rnd_up(rows, 256);
+}
+}  // namespace
+
 bool LoRA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!ov::is_type<ov::op::internal::LoraSubgraph>(op)) {
@@ -51,9 +82,30 @@ LoRA::LoRA(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& contex
                     op->get_friendly_name());
 
     m_body = loraModel->get_function();
+    m_multiAdapter = loraModel->is_multi_adapter();
 }
 
 void LoRA::selectOptimalPrimitiveDescriptor() {
+    if (m_multiAdapter) {
+        // the main flow is updated inPlace by the low-rank updates of the rows,
+        // the data is kept in the precision of the main flow
+        auto precision = getOriginalInputPrecisionAtPort(0);
+        if (none_of(precision, ov::element::bf16, ov::element::f16)) {
+            precision = ov::element::f32;
+        }
+        supportedPrimitiveDescriptors.clear();
+        addSupportedPrimDesc({{LayoutType::ncsp, precision},
+                              {LayoutType::ncsp, precision},
+                              {LayoutType::ncsp, precision},
+                              {LayoutType::ncsp, precision},
+                              {LayoutType::ncsp, precision},
+                              {LayoutType::ncsp, ov::element::i32}},
+                             {{LayoutType::ncsp, precision, false, 0}},
+                             impl_desc_type::undef);
+        selectPrimitiveDescriptorByIndex(0);
+        return;
+    }
+
     // for the input configuration, just always use the parent configuration
     std::vector<PortConfig> inConfs;
     std::vector<Input::InputConfig> graphInputConfig;
@@ -100,6 +152,10 @@ void LoRA::selectOptimalPrimitiveDescriptor() {
 }
 
 int LoRA::registerToAllocationContext(int offset, AllocationContext& context) {
+    if (m_multiAdapter) {
+        return Node::registerToAllocationContext(offset, context);
+    }
+
     CPU_NODE_ASSERT(getOriginalInputsNumber() == m_graph.inputsNumber(),
                     "Number of node inputs must be equal the number of inner graph's inputs");
 
@@ -127,6 +183,35 @@ int LoRA::registerToAllocationContext(int offset, AllocationContext& context) {
 }
 
 void LoRA::createPrimitive() {
+    if (m_multiAdapter) {
+        // the rows of each adapter are multiplied by the same MatMul executors as in the inner graph,
+        // lowRank = input x A^T and update = lowRank x B^T
+        const auto precision = getSrcMemoryAtPort(0)->getDesc().getPrecision();
+        const auto& creator = BlockedDescCreator::getCommonCreators().at(LayoutType::ncsp);
+        const auto desc = creator->createSharedDesc(precision, Shape(ov::PartialShape::dynamic(2)));
+        const MemoryArgs memory{
+            {ARG_SRC, std::make_shared<Memory>(getEngine(), desc)},
+            {ARG_WEI, std::make_shared<Memory>(getEngine(), desc)},
+            {ARG_BIAS, MemoryDescUtils::makeEmptyMemory(context)},
+            {ARG_DST, std::make_shared<Memory>(getEngine(), desc)},
+        };
+        MatMulAttrs attrs;
+        attrs.transposeB = true;
+        const MemoryDescArgs descs{
+            {ARG_SRC, desc},
+            {ARG_WEI, desc},
+            {ARG_BIAS, MemoryDescUtils::makeEmptyDesc()},
+            {ARG_DST, desc},
+        };
+        auto executionContext = std::make_shared<ExecutorContext>(context, getImplPriority());
+        auto factory = std::make_shared<ExecutorFactory<MatMulAttrs>>(attrs, executionContext, descs);
+        m_executorA = factory->make(memory, false);
+        m_executorB = factory->make(memory, false);
+
+        Node::createPrimitive();
+        return;
+    }
+
     CPU_NODE_ASSERT(getOriginalInputsNumber() == m_graph.inputsNumber(),
                     "Number of node inputs must be equal the number of inner graph's inputs");
     // Workaround to avoid making LoRa node always executable (isExecutable() = true)
@@ -141,14 +226,177 @@ void LoRA::createPrimitive() {
 }
 
 void LoRA::execute([[maybe_unused]] const dnnl::stream& strm) {
+    if (m_multiAdapter) {
+        const auto precision = getSrcMemoryAtPort(0)->getDesc().getPrecision();
+        if (precision == ov::element::bf16) {
+            executeMultiAdapter<ov::bfloat16>();
+        } else if (precision == ov::element::f16) {
+            executeMultiAdapter<ov::float16>();
+        } else {
+            executeMultiAdapter<float>();
+        }
+        return;
+    }
     m_graph.Infer();
 }
 
+template <typename T>
+void LoRA::executeMultiAdapter() {
+    const auto& inputDims = getSrcMemoryAtPort(1)->getStaticDims();
+    const auto& poolADims = getSrcMemoryAtPort(2)->getStaticDims();
+    const auto& poolBDims = getSrcMemoryAtPort(4)->getStaticDims();
+    CPU_NODE_ASSERT(poolADims.size() == 3 && poolBDims.size() == 3, "expects adapters pools of rank 3");
+
+    const size_t K = inputDims.back();
+    const size_t adapters = poolADims[0];
+    const size_t rank = poolADims[1];
+    const size_t N = poolBDims[1];
+    const size_t rows = getSrcMemoryAtPort(5)->getShape().getElementsCount();
+    CPU_NODE_ASSERT(poolADims[2] == K && poolBDims[0] == adapters && poolBDims[2] == rank,
+                    "has inconsistent shapes of the adapters pools");
+    // the fusion accepts alpha of a dynamic shape, which may be broadcast to the ranks of an adapter at runtime
+    const size_t alphaSize = getSrcMemoryAtPort(3)->getShape().getElementsCount();
+    CPU_NODE_ASSERT(alphaSize == adapters * rank || alphaSize == adapters,
+                    "expects alpha of shape [adapters, 1, rank] or [adapters, 1, 1]");
+    const bool alphaPerRank = alphaSize == adapters * rank;
+    CPU_NODE_ASSERT(ov::shape_size(inputDims) == rows * K, "expects one adapter index per row of the LoRA input");
+    CPU_NODE_ASSERT(getDstMemoryAtPort(0)->getShape().getElementsCount() == rows * N,
+                    "expects the output of shape [rows, N]");
+
+    const auto* mainFlow = getSrcDataAtPortAs<const T>(0);
+    const auto* input = getSrcDataAtPortAs<const T>(1);
+    const auto* poolA = getSrcDataAtPortAs<const T>(2);
+    const auto* alpha = getSrcDataAtPortAs<const T>(3);
+    const auto* poolB = getSrcDataAtPortAs<const T>(4);
+    const auto* indices = getSrcDataAtPortAs<const int32_t>(5);
+    auto* dst = getDstDataAtPortAs<T>(0);
+    if (dst != mainFlow) {
+        std::copy_n(mainFlow, rows * N, dst);
+    }
+    if (rows == 0 || rank == 0) {
+        return;
+    }
+
+    // negative indices count the adapters from the end, as the indices of the gathers replaced by the fusion
+    auto adapterOf = [&](size_t row) {
+        const auto index = static_cast<int64_t>(indices[row]);
+        const auto adapter = index < 0 ? index + static_cast<int64_t>(adapters) : index;
+        if (adapter < 0 || adapter >= static_cast<int64_t>(adapters)) {
+            CPU_NODE_THROW("has adapter index ",
+                           index,
+                           " of row ",
+                           row,
+                           " out of the range [-",
+                           adapters,
+                           ", ",
+                           adapters,
+                           ")");
+        }
+        return static_cast<size_t>(adapter);
+    };
+
+    // group the rows by their adapters (counting sort keeps the order of the rows of an adapter)
+    m_rowsAdapter.resize(rows);
+    m_adapterOffsets.assign(adapters + 1, 0);
+    for (size_t row = 0; row < rows; row++) {
+        m_rowsAdapter[row] = adapterOf(row);
+        m_adapterOffsets[m_rowsAdapter[row] + 1]++;
+    }
+    for (size_t adapter = 0; adapter < adapters; adapter++) {
+        m_adapterOffsets[adapter + 1] += m_adapterOffsets[adapter];
+    }
+    m_rowsOrder.resize(rows);
+    {
+        auto cursors = m_adapterOffsets;
+        for (size_t row = 0; row < rows; row++) {
+            m_rowsOrder[cursors[m_rowsAdapter[row]]++] = row;
+        }
+    }
+
+    // the padding rows of an adapter are the rows of the next adapters, which are computed afterwards,
+    // or the zero rows past the last one
+    size_t paddedRows = rows;
+    for (size_t adapter = 0; adapter < adapters; adapter++) {
+        const size_t begin = m_adapterOffsets[adapter];
+        const size_t end = m_adapterOffsets[adapter + 1];
+        if (end > begin) {
+            paddedRows = std::max(paddedRows, begin + normalizeRows(end - begin));
+        }
+    }
+    m_rowsInput.resize(paddedRows * K * sizeof(T));
+    m_lowRank.resize(paddedRows * rank * sizeof(T));
+    m_rowsUpdate.resize(paddedRows * N * sizeof(T));
+    auto* rowsInput = reinterpret_cast<T*>(m_rowsInput.data());
+    auto* lowRank = reinterpret_cast<T*>(m_lowRank.data());
+    auto* rowsUpdate = reinterpret_cast<T*>(m_rowsUpdate.data());
+
+    const auto& cpuParallel = context->getCpuParallel();
+    cpuParallel->parallel_for(rows, [&](size_t i) {
+        std::memcpy(rowsInput + i * K, input + m_rowsOrder[i] * K, K * sizeof(T));
+    });
+    std::fill(rowsInput + rows * K, rowsInput + paddedRows * K, T{0});
+
+    const auto precision = getSrcMemoryAtPort(0)->getDesc().getPrecision();
+    const auto& creator = BlockedDescCreator::getCommonCreators().at(LayoutType::ncsp);
+    auto matrix = [&](const void* data, size_t height, size_t width) -> MemoryPtr {
+        return std::make_shared<Memory>(getEngine(),
+                                        creator->createSharedDesc(precision, Shape(VectorDims{height, width})),
+                                        data);
+    };
+    const auto bias = MemoryDescUtils::makeEmptyMemory(context);
+    auto multiply = [&bias](const ExecutorPtr& executor,
+                            const MemoryPtr& src,
+                            const MemoryPtr& wei,
+                            const MemoryPtr& dst) {
+        const MemoryArgs memory{{ARG_SRC, src}, {ARG_WEI, wei}, {ARG_BIAS, bias}, {ARG_DST, dst}};
+        executor->update(memory);
+        executor->execute(memory);
+    };
+
+    for (size_t adapter = 0; adapter < adapters; adapter++) {
+        const size_t begin = m_adapterOffsets[adapter];
+        const size_t end = m_adapterOffsets[adapter + 1];
+        if (end == begin) {
+            continue;
+        }
+        const size_t M = normalizeRows(end - begin);
+
+        // lowRank[row] = alpha[adapter] * (input[row] x A[adapter]^T)
+        multiply(m_executorA,
+                 matrix(rowsInput + begin * K, M, K),
+                 matrix(poolA + adapter * rank * K, rank, K),
+                 matrix(lowRank + begin * rank, M, rank));
+        const T* scales = alpha + (alphaPerRank ? adapter * rank : adapter);
+        cpuParallel->parallel_for(end - begin, [&](size_t i) {
+            T* row = lowRank + (begin + i) * rank;
+            for (size_t r = 0; r < rank; r++) {
+                row[r] = static_cast<T>(static_cast<float>(row[r]) * static_cast<float>(scales[alphaPerRank ? r : 0]));
+            }
+        });
+
+        // dst[row] += lowRank[row] x B[adapter]^T
+        multiply(m_executorB,
+                 matrix(lowRank + begin * rank, M, rank),
+                 matrix(poolB + adapter * N * rank, N, rank),
+                 matrix(rowsUpdate + begin * N, M, N));
+        cpuParallel->parallel_for(end - begin, [&](size_t i) {
+            const T* update = rowsUpdate + (begin + i) * N;
+            T* out = dst + m_rowsOrder[begin + i] * N;
+            for (size_t n = 0; n < N; n++) {
+                out[n] = static_cast<T>(static_cast<float>(out[n]) + static_cast<float>(update[n]));
+            }
+        });
+    }
+}
+
 void LoRA::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
 
 void LoRA::prepareParams() {
+    if (m_multiAdapter) {
+        return;
+    }
     for (size_t i = 0; i < getOriginalInputsNumber(); i++) {
         // since the external and internal descriptors are compatible, we may pass the descriptor
         subgraphMemoryPtrs[i]->redefineDesc(getSrcMemoryAtPort(i)->getDescPtr());
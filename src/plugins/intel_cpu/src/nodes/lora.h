@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -15,6 +16,7 @@
 #include "graph.h"
 #include "graph_context.h"
 #include "node.h"
+#include "nodes/executors/executor.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
 
@@ -39,7 +41,22 @@ public:
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
 private:
+    // computes the low-rank updates of the rows grouped by their adapters, the inner graph is not used
+    template <typename T>
+    void executeMultiAdapter();
+
     std::shared_ptr<const ov::Model> m_body;
+    bool m_multiAdapter = false;
+    // MatMul executors of the multi-adapter mode: input x A^T and lowRank x B^T
+    ExecutorPtr m_executorA;
+    ExecutorPtr m_executorB;
+    // scratch buffers of the multi-adapter mode, reused between the inferences
+    std::vector<uint8_t> m_rowsInput;
+    std::vector<uint8_t> m_lowRank;
+    std::vector<uint8_t> m_rowsUpdate;
+    std::vector<size_t> m_rowsAdapter;
+    std::vector<size_t> m_rowsOrder;
+    std::vector<size_t> m_adapterOffsets;
     std::vector<MemoryPtr> subgraphMemoryPtrs;
     Graph m_graph;
 };
@@ -4,6 +4,9 @@
 
 #include "roi_align_rotated.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -11,7 +14,6 @@
 #include <openvino/op/roi_align_rotated.hpp>
 #include <vector>
 
-#include "common/cpu_convert.h"
 #include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -21,8 +23,6 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
-#include "openvino/op/roi_align.hpp"
-#include "openvino/reference/roi_align.hpp"
 #include "shape_inference/shape_inference_cpu.hpp"
 
 namespace ov::intel_cpu::node {
@@ -71,36 +71,136 @@ template <ov::element::Type_t OV_TYPE>
 void ROIAlignRotated::executeImpl() {
     using T = typename ov::element_type_traits<OV_TYPE>::value_type;
 
-    const size_t batch_indices_size = getSrcMemoryAtPort(2)->getShape().getElementsCount();
-
-    std::vector<int64_t> batch_indices_vec_scaled_up(batch_indices_size);
-    cpu_parallel_convert(getSrcMemoryAtPort(2)->getData(),
-                         batch_indices_vec_scaled_up.data(),
-                         getSrcMemoryAtPort(2)->getPrecision(),
-                         ov::element::i64,
-                         batch_indices_size);
-
-    ov::reference::roi_align<T, ov::reference::roi_policy::ROIAlignRotatedOpDefPolicy>(
-        getSrcDataAtPortAs<const T>(0),
-        getSrcDataAtPortAs<const T>(1),
-        batch_indices_vec_scaled_up.data(),
-        getDstDataAtPortAs<T>(0),
-        ov::Shape{getSrcMemoryAtPort(0)->getStaticDims()},
-        ov::Shape{getSrcMemoryAtPort(1)->getStaticDims()},
-        ov::Shape{getSrcMemoryAtPort(2)->getStaticDims()},
-        ov::Shape{getDstMemoryAtPort(0)->getStaticDims()},
-        pooledH,
-        pooledW,
-        samplingRatio,
-        spatialScale,
-        ov::op::v3::ROIAlign::PoolingMode::AVG,
-        ov::op::v9::ROIAlign::AlignedMode::ASYMMETRIC,
-        clockwiseMode);
+    const auto* featureMaps = getSrcDataAtPortAs<const T>(0);
+    const auto* rois = getSrcDataAtPortAs<const float>(1);
+    const auto* batchIndices = getSrcDataAtPortAs<const int32_t>(2);
+    auto* out = getDstDataAtPortAs<T>(0);
+
+    const auto& featureDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const size_t channels = featureDims[1];
+    const size_t height = featureDims[2];
+    const size_t width = featureDims[3];
+    const size_t numRois = getSrcMemoryAtPort(1)->getStaticDims()[0];
+    const size_t bins = static_cast<size_t>(pooledH) * static_cast<size_t>(pooledW);
+    const auto& cpuParallel = context->getCpuParallel();
+
+    // The bilinear interpolation points of the samples are the same for all the channels, so they are computed once
+    // per ROI as the offsets in the feature map plane and the weights of the 4 neighbours of each sample
+    std::vector<std::vector<size_t>> roiOffsets(numRois);
+    std::vector<std::vector<T>> roiWeights(numRois);
+    std::vector<size_t> roiSamplesInBin(numRois);
+    std::atomic_bool negativeSampling{false};
+    cpuParallel->parallel_for(numRois, [&](size_t roi) {
+        const float* roiData = rois + roi * 5;
+        const auto scale = static_cast<T>(spatialScale);
+        const T centerX = static_cast<T>(roiData[0]) * scale - T{0.5F};
+        const T centerY = static_cast<T>(roiData[1]) * scale - T{0.5F};
+        const T roiWidth = static_cast<T>(roiData[2]) * scale;
+        const T roiHeight = static_cast<T>(roiData[3]) * scale;
+        const auto angle = static_cast<float>(clockwiseMode ? -roiData[4] : roiData[4]);
+        const auto cosAngle = static_cast<T>(std::cos(angle));
+        const auto sinAngle = static_cast<T>(std::sin(angle));
+        const T x1 = -roiWidth / T{2.0F};
+        const T y1 = -roiHeight / T{2.0F};
+
+        const T binWidth = roiWidth / static_cast<T>(pooledW);
+        const T binHeight = roiHeight / static_cast<T>(pooledH);
+        const int samplingX =
+            samplingRatio == 0 ? static_cast<int>(std::ceil(static_cast<float>(binWidth))) : samplingRatio;
+        const int samplingY =
+            samplingRatio == 0 ? static_cast<int>(std::ceil(static_cast<float>(binHeight))) : samplingRatio;
+        if (samplingX < 0 || samplingY < 0) {
+            negativeSampling = true;
+            return;
+        }
+        const auto samplesInBin = static_cast<size_t>(samplingX) * static_cast<size_t>(samplingY);
+        const T sampleDistanceX = binWidth / static_cast<T>(samplingX);
+        const T sampleDistanceY = binHeight / static_cast<T>(samplingY);
+
+        auto& offsets = roiOffsets[roi];
+        auto& weights = roiWeights[roi];
+        offsets.reserve(4 * samplesInBin * bins);
+        weights.reserve(4 * samplesInBin * bins);
+        roiSamplesInBin[roi] = samplesInBin;
+
+        for (int binY = 0; binY < pooledH; binY++) {
+            for (int binX = 0; binX < pooledW; binX++) {
+                for (int sampleY = 0; sampleY < samplingY; sampleY++) {
+                    const T preY = y1 + static_cast<T>(binY) * binHeight +
+                                   sampleDistanceY * (static_cast<T>(sampleY) + static_cast<T>(0.5F));
+                    for (int sampleX = 0; sampleX < samplingX; sampleX++) {
+                        const T preX = x1 + static_cast<T>(binX) * binWidth +
+                                       sampleDistanceX * (static_cast<T>(sampleX) + static_cast<T>(0.5F));
+                        T y = preY * cosAngle - preX * sinAngle + centerY;
+                        T x = preY * sinAngle + preX * cosAngle + centerX;
+
+                        if (x < T{-1.0F} || x > static_cast<T>(width) || y < T{-1.0F} || y > static_cast<T>(height)) {
+                            offsets.insert(offsets.end(), 4, 0);
+                            weights.insert(weights.end(), 4, T{0});
+                            continue;
+                        }
+                        x = std::max(x, T{0});
+                        y = std::max(y, T{0});
+
+                        auto yLow = static_cast<size_t>(y);
+                        auto xLow = static_cast<size_t>(x);
+                        size_t yHigh = yLow + 1;
+                        size_t xHigh = xLow + 1;
+                        if (yLow >= height - 1) {
+                            yHigh = yLow = height - 1;
+                            y = static_cast<T>(yLow);
+                        }
+                        if (xLow >= width - 1) {
+                            xHigh = xLow = width - 1;
+                            x = static_cast<T>(xLow);
+                        }
+                        offsets.push_back(yLow * width + xLow);
+                        offsets.push_back(yLow * width + xHigh);
+                        offsets.push_back(yHigh * width + xLow);
+                        offsets.push_back(yHigh * width + xHigh);
+
+                        const T ly = y - static_cast<T>(yLow);
+                        const T lx = x - static_cast<T>(xLow);
+                        const T hy = T{1.0F} - ly;
+                        const T hx = T{1.0F} - lx;
+                        weights.push_back(hy * hx);
+                        weights.push_back(hy * lx);
+                        weights.push_back(ly * hx);
+                        weights.push_back(ly * lx);
+                    }
+                }
+            }
+        }
+    });
+    CPU_NODE_ASSERT(!negativeSampling, "has negative sampling ratio");
+
+    // average pooling of the samples of each bin, the channels of the ROIs are processed in parallel
+    cpuParallel->parallel_for2d(numRois, channels, [&](size_t roi, size_t channel) {
+        const auto batch = static_cast<size_t>(batchIndices[roi]);
+        const T* plane = featureMaps + (batch * channels + channel) * height * width;
+        const auto& offsets = roiOffsets[roi];
+        const auto& weights = roiWeights[roi];
+        const size_t samplesInBin = roiSamplesInBin[roi];
+        const auto samplesCount = static_cast<T>(samplesInBin);
+        T* dst = out + (roi * channels + channel) * bins;
+
+        size_t sample = 0;
+        for (size_t bin = 0; bin < bins; bin++) {
+            T pooled = 0;
+            for (size_t i = 0; i < samplesInBin; i++, sample += 4) {
+                const T value = weights[sample] * plane[offsets[sample]] +
+                                weights[sample + 1] * plane[offsets[sample + 1]] +
+                                weights[sample + 2] * plane[offsets[sample + 2]] +
+                                weights[sample + 3] * plane[offsets[sample + 3]];
+                pooled += value / samplesCount;
+            }
+            dst[bin] = pooled;
+        }
+    });
 }
 
 void ROIAlignRotated::execute([[maybe_unused]] const dnnl::stream& strm) {
     const ov::element::Type type = getOriginalInputPrecisionAtPort(0);
-    executeImpl<ov::element::f32>();
 
 #define CASE(OV_TYPE)                        \
     case ov::element::OV_TYPE:               \
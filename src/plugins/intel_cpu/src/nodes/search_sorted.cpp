@@ -4,6 +4,8 @@
 
 #include "search_sorted.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -21,7 +23,6 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/op/search_sorted.hpp"
-#include "openvino/reference/search_sorted.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 #include "utils/general_utils.h"
@@ -94,12 +95,41 @@ void SearchSorted::executeDynamicImpl(const dnnl::stream& strm) {
 
 template <typename INPUT_TYPE, typename OUTPUT_TYPE>
 void SearchSorted::executeImpl() {
-    ov::reference::search_sorted<INPUT_TYPE, OUTPUT_TYPE>(getSrcDataAtPortAs<const INPUT_TYPE>(0),
-                                                          getSrcDataAtPortAs<const INPUT_TYPE>(1),
-                                                          getDstDataAtPortAs<OUTPUT_TYPE>(0),
-                                                          ov::Shape{getSrcMemoryAtPort(0)->getStaticDims()},
-                                                          ov::Shape{getSrcMemoryAtPort(1)->getStaticDims()},
-                                                          right_mode);
+    const auto* sorted = getSrcDataAtPortAs<const INPUT_TYPE>(0);
+    const auto* values = getSrcDataAtPortAs<const INPUT_TYPE>(1);
+    auto* out = getDstDataAtPortAs<OUTPUT_TYPE>(0);
+    const auto& sortedDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& valuesDims = getSrcMemoryAtPort(1)->getStaticDims();
+
+    // the sorted sequences are the innermost rows, a 1D sorted sequence is shared by all the values
+    const size_t sortedLen = sortedDims.back();
+    const size_t valuesLen = valuesDims.back();
+    const size_t rows = valuesLen == 0 ? 0 : getSrcMemoryAtPort(1)->getShape().getElementsCount() / valuesLen;
+    const bool sharedSorted = sortedDims.size() == 1;
+    // values are searched in blocks, so the sorted row stays in the cache
+    constexpr size_t valuesBlockSize = 256;
+    const size_t valuesBlocks = (valuesLen + valuesBlockSize - 1) / valuesBlockSize;
+
+    auto search = [&](auto compare) {
+        context->getCpuParallel()->parallel_for2d(rows, valuesBlocks, [&](size_t row, size_t block) {
+            const INPUT_TYPE* sortedBegin = sorted + (sharedSorted ? 0 : row * sortedLen);
+            const INPUT_TYPE* sortedEnd = sortedBegin + sortedLen;
+            const size_t end = std::min(valuesLen, (block + 1) * valuesBlockSize);
+            for (size_t i = row * valuesLen + block * valuesBlockSize; i < row * valuesLen + end; i++) {
+                out[i] = static_cast<OUTPUT_TYPE>(std::lower_bound(sortedBegin, sortedEnd, values[i], compare) -
+                                                  sortedBegin);
+            }
+        });
+    };
+    if (right_mode) {
+        search([](const INPUT_TYPE& a, const INPUT_TYPE& b) {
+            return a <= b;
+        });
+    } else {
+        search([](const INPUT_TYPE& a, const INPUT_TYPE& b) {
+            return a < b;
+        });
+    }
 }
 
 namespace {
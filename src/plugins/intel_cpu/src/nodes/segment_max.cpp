@@ -4,12 +4,16 @@
 
 #include "segment_max.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "cpu_types.h"
 #include "graph_context.h"
@@ -24,7 +28,6 @@
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/segment_max.hpp"
 #include "openvino/op/util/attr_types.hpp"
-#include "openvino/reference/segment_max.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 
@@ -134,15 +137,75 @@ bool SegmentMax::needShapeInfer() const {
 
 template <class T>
 void SegmentMax::executeImpl() {
-    const auto& data_shape = getSrcMemoryAtPort(0)->getStaticDims();
-    const auto& output_shape = getDstMemoryAtPort(0)->getShape().getStaticDims();
-    const auto empty_segment_value = fillMode == ov::op::FillMode::ZERO ? T(0) : std::numeric_limits<T>::lowest();
-    ov::reference::segment_max(getSrcDataAtPortAs<const T>(0),
-                               data_shape,
-                               getSrcDataAtPortAs<const int32_t>(1),
-                               getDstDataAtPortAs<T>(0),
-                               output_shape,
-                               empty_segment_value);
+    const auto& dataDims = getSrcMemoryAtPort(0)->getStaticDims();
+    const auto& outputDims = getDstMemoryAtPort(0)->getShape().getStaticDims();
+    const auto emptySegmentValue = fillMode == ov::op::FillMode::ZERO ? T(0) : std::numeric_limits<T>::lowest();
+    const auto* data = getSrcDataAtPortAs<const T>(0);
+    const auto* segmentIds = getSrcDataAtPortAs<const int32_t>(1);
+    auto* out = getDstDataAtPortAs<T>(0);
+
+    const size_t rows = dataDims[0];
+    const size_t numSegments = outputDims[0];
+    const size_t innerSize = std::accumulate(dataDims.begin() + 1, dataDims.end(), size_t{1}, std::multiplies<>());
+    const auto& cpuParallel = context->getCpuParallel();
+
+    // the rows of the segments which are present in the output, the segment ids are expected to be sorted
+    std::vector<size_t> segmentBegins(numSegments, rows);
+    std::vector<size_t> segmentEnds(numSegments, rows);
+    bool sorted = true;
+    for (size_t i = 0; i < rows; i++) {
+        const auto segment = static_cast<size_t>(segmentIds[i]);
+        if (segment >= numSegments) {
+            continue;
+        }
+        if (segmentBegins[segment] == rows) {
+            segmentBegins[segment] = i;
+        } else if (segmentEnds[segment] != i) {
+            sorted = false;
+        }
+        segmentEnds[segment] = i + 1;
+    }
+
+    auto maxRow = [&](const T* row, T* dst, size_t size) {
+        for (size_t j = 0; j < size; j++) {
+            dst[j] = row[j] > dst[j] ? row[j] : dst[j];
+        }
+    };
+
+    if (sorted) {
+        // every segment is a contiguous range of rows, the segments are reduced independently
+        cpuParallel->parallel_for(numSegments, [&](size_t segment) {
+            T* dst = out + segment * innerSize;
+            if (segmentBegins[segment] == rows) {
+                std::fill_n(dst, innerSize, emptySegmentValue);
+                return;
+            }
+            std::fill_n(dst, innerSize, std::numeric_limits<T>::lowest());
+            for (size_t i = segmentBegins[segment]; i < segmentEnds[segment]; i++) {
+                maxRow(data + i * innerSize, dst, innerSize);
+            }
+        });
+        return;
+    }
+
+    // the rows of a segment are interleaved with others, each thread reduces its own block of the inner dims
+    constexpr size_t innerBlockSize = 1024;
+    const size_t innerBlocks = (innerSize + innerBlockSize - 1) / innerBlockSize;
+    cpuParallel->parallel_for(innerBlocks, [&](size_t block) {
+        const size_t begin = block * innerBlockSize;
+        const size_t size = std::min(innerSize, begin + innerBlockSize) - begin;
+        for (size_t segment = 0; segment < numSegments; segment++) {
+            std::fill_n(out + segment * innerSize + begin,
+                        size,
+                        segmentBegins[segment] == rows ? emptySegmentValue : std::numeric_limits<T>::lowest());
+        }
+        for (size_t i = 0; i < rows; i++) {
+            const auto segment = static_cast<size_t>(segmentIds[i]);
+            if (segment < numSegments) {
+                maxRow(data + i * innerSize + begin, out + segment * innerSize + begin, size);
+            }
+        }
+    });
 }
 
 namespace {
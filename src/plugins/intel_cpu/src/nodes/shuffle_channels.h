@@ -33,6 +33,8 @@ public:
 
     void prepareParams() override;
     struct ShuffleChannelsAttributes {
+        // the permute kernel keeps no per call state and takes the threading context as an argument
+        static constexpr bool shareable_between_streams = true;
         LayoutType layoutType = LayoutType::nspc;
         int dataRank = 0;
         int axis = 0;
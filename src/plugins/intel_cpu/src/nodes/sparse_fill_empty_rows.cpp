@@ -4,12 +4,13 @@
 
 #include "sparse_fill_empty_rows.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
-#include <unordered_set>
+#include <vector>
 
 #include "cpu_types.h"
 #include "graph_context.h"
@@ -24,7 +25,6 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/sparse_fill_empty_rows.hpp"
-#include "openvino/reference/sparse_fill_empty_rows.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 
@@ -90,16 +90,13 @@ void SparseFillEmptyRows::executeDynamicImpl(const dnnl::stream& strm) {
 
     const auto* denseShapePtr = getSrcDataAtPortAs<const int32_t>(1);
     const auto numRows = static_cast<size_t>(denseShapePtr[0]);
+    const size_t indicesCount = indicesShape.getElementsCount() / 2;  // Divide by 2 because indices is [M, 2]
 
-    std::unordered_set<int32_t> existingRows;
-    size_t indicesCount = indicesShape.getElementsCount() / 2;  // Divide by 2 because indices is [M, 2]
-
-    const auto* indicesPtr = getSrcDataAtPortAs<const int32_t>(2);
-    for (size_t i = 0; i < indicesCount; i++) {
-        existingRows.insert(indicesPtr[i * 2]);
+    countRowsValues(getSrcDataAtPortAs<const int32_t>(2), indicesCount, numRows);
+    size_t emptyRowsCount = 0;
+    for (size_t row = 0; row < numRows; row++) {
+        emptyRowsCount += rowsBegins[row] == rowsBegins[row + 1] ? 1 : 0;
     }
-
-    size_t emptyRowsCount = numRows - existingRows.size();
     size_t valuesCount = valuesShape.getElementsCount();
     ov::Shape outputIndicesShape{valuesCount + emptyRowsCount, 2};
     ov::Shape outputValuesShape{valuesCount + emptyRowsCount};
@@ -115,16 +112,75 @@ struct SparseFillEmptyRowsContext {
 };
 }  // namespace
 
+void SparseFillEmptyRows::countRowsValues(const int32_t* indices, size_t valuesCount, size_t numRows) {
+    rowsBegins.assign(numRows + 1, 0);
+    for (size_t i = 0; i < valuesCount; i++) {
+        const auto row = indices[i * 2];
+        CPU_NODE_ASSERT(row >= 0 && static_cast<size_t>(row) < numRows,
+                        "has row index ",
+                        row,
+                        " out of the dense shape rows number ",
+                        numRows);
+        rowsBegins[row + 1]++;
+    }
+    for (size_t row = 0; row < numRows; row++) {
+        rowsBegins[row + 1] += rowsBegins[row];
+    }
+}
+
 template <typename T>
 void SparseFillEmptyRows::executeImpl() {
-    ov::reference::sparse_fill_empty_rows(getSrcDataAtPortAs<const T>(0),                        // values
-                                          getSrcMemoryAtPort(0)->getShape().getElementsCount(),  // values_size
-                                          getSrcDataAtPortAs<const int32_t>(1),                  // dense_shape
-                                          getSrcDataAtPortAs<const int32_t>(2),                  // indices
-                                          *getSrcDataAtPortAs<const T>(3),                       // default_value
-                                          getDstDataAtPortAs<int32_t>(0),                        // output_indices
-                                          getDstDataAtPortAs<T>(1),                              // output_values
-                                          getDstDataAtPortAs<bool>(2));                          // empty_row_indicator
+    const auto* values = getSrcDataAtPortAs<const T>(0);
+    const auto* indices = getSrcDataAtPortAs<const int32_t>(2);
+    const T defaultValue = *getSrcDataAtPortAs<const T>(3);
+    auto* outputIndices = getDstDataAtPortAs<int32_t>(0);
+    auto* outputValues = getDstDataAtPortAs<T>(1);
+    auto* emptyRowIndicator = getDstDataAtPortAs<bool>(2);
+
+    const size_t valuesCount = getSrcMemoryAtPort(0)->getShape().getElementsCount();
+    const auto numRows = static_cast<size_t>(getSrcDataAtPortAs<const int32_t>(1)[0]);
+
+    // group the values by their rows (counting sort), an empty row takes one output entry for the default value
+    countRowsValues(indices, valuesCount, numRows);
+    std::vector<size_t> order(valuesCount);
+    {
+        std::vector<size_t> cursors(rowsBegins.begin(), rowsBegins.end() - 1);
+        for (size_t i = 0; i < valuesCount; i++) {
+            order[cursors[indices[i * 2]]++] = i;
+        }
+    }
+    std::vector<size_t> outputBegins(numRows + 1, 0);
+    for (size_t row = 0; row < numRows; row++) {
+        outputBegins[row + 1] = outputBegins[row] + std::max<size_t>(rowsBegins[row + 1] - rowsBegins[row], 1);
+    }
+
+    context->getCpuParallel()->parallel_for(numRows, [&](size_t row) {
+        const size_t out = outputBegins[row];
+        const bool isEmpty = rowsBegins[row] == rowsBegins[row + 1];
+        emptyRowIndicator[row] = isEmpty;
+        if (isEmpty) {
+            outputIndices[out * 2] = static_cast<int32_t>(row);
+            outputIndices[out * 2 + 1] = 0;
+            outputValues[out] = defaultValue;
+            return;
+        }
+
+        // the values of the row are ordered by their columns
+        auto begin = order.begin() + rowsBegins[row];
+        auto end = order.begin() + rowsBegins[row + 1];
+        auto byColumn = [&](size_t a, size_t b) {
+            return indices[a * 2 + 1] < indices[b * 2 + 1];
+        };
+        if (!std::is_sorted(begin, end, byColumn)) {
+            std::stable_sort(begin, end, byColumn);
+        }
+        for (size_t i = 0; i < static_cast<size_t>(end - begin); i++) {
+            const size_t src = begin[i];
+            outputIndices[(out + i) * 2] = static_cast<int32_t>(row);
+            outputIndices[(out + i) * 2 + 1] = indices[src * 2 + 1];
+            outputValues[out + i] = values[src];
+        }
+    });
 }
 
 template <typename T>
@@ -6,9 +6,12 @@
 
 #include <node.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "graph_context.h"
 #include "openvino/core/node.hpp"
@@ -30,11 +33,16 @@ public:
     void execute(const dnnl::stream& strm) override;
 
 private:
+    // fills rowsBegins with the offsets of the rows values in the values grouped by the rows
+    void countRowsValues(const int32_t* indices, size_t valuesCount, size_t numRows);
+
     template <typename T>
     void executeImpl();
 
     template <typename T>
     struct SparseFillEmptyRowsExecute;
+
+    std::vector<size_t> rowsBegins;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -4,6 +4,7 @@
 
 #include "string_tensor_pack.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
@@ -20,7 +21,6 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/string_tensor_pack.hpp"
-#include "openvino/reference/string_tensor_pack.hpp"
 #include "selective_build.h"
 #include "shape_inference/shape_inference_cpu.hpp"
 
@@ -76,12 +76,15 @@ void StringTensorPack::executeDynamicImpl(const dnnl::stream& strm) {
 
 template <class T_idx>
 void StringTensorPack::executeImpl() {
-    const auto& data_shape = getSrcMemoryAtPort(0)->getStaticDims();
-    ov::reference::string_tensor_pack(getSrcDataAtPortAs<const T_idx>(0),
-                                      getSrcDataAtPortAs<const T_idx>(1),
-                                      getSrcDataAtPortAs<const uint8_t>(2),
-                                      getDstDataAtPortAs<std::string>(0),
-                                      ov::shape_size(data_shape));
+    const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
+    const auto* begins = getSrcDataAtPortAs<const T_idx>(0);
+    const auto* ends = getSrcDataAtPortAs<const T_idx>(1);
+    const auto* chars = getSrcDataAtPortAs<const char>(2);
+    auto* out = getDstDataAtPortAs<std::string>(0);
+    // the strings are independent, the output strings keep their capacity between the inferences
+    context->getCpuParallel()->parallel_for(stringCount, [&](size_t i) {
+        out[i].assign(chars + begins[i], chars + ends[i]);
+    });
 }
 
 namespace {
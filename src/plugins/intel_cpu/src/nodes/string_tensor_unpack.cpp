@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <numeric>
@@ -23,7 +24,6 @@
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/string_tensor_unpack.hpp"
-#include "openvino/reference/string_tensor_unpack.hpp"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
 
 namespace ov::intel_cpu::node {
@@ -87,10 +87,22 @@ void StringTensorUnpack::executeDynamicImpl(const dnnl::stream& strm) {
 
 void StringTensorUnpack::execute([[maybe_unused]] const dnnl::stream& strm) {
     const auto stringCount = ov::shape_size(getSrcMemoryAtPort(0)->getStaticDims());
-    ov::reference::string_tensor_unpack(getSrcDataAtPortAs<const std::string>(0),
-                                        getDstDataAtPortAs<int32_t>(0),
-                                        getDstDataAtPortAs<int32_t>(1),
-                                        getDstDataAtPortAs<uint8_t>(2),
-                                        stringCount);
+    const auto* data = getSrcDataAtPortAs<const std::string>(0);
+    auto* begins = getDstDataAtPortAs<int32_t>(0);
+    auto* ends = getDstDataAtPortAs<int32_t>(1);
+    auto* symbols = getDstDataAtPortAs<uint8_t>(2);
+
+    // the offsets are a prefix sum of the lengths, then the strings are copied to their offsets in parallel
+    int32_t offset = 0;
+    for (size_t i = 0; i < stringCount; ++i) {
+        begins[i] = offset;
+        offset += static_cast<int32_t>(data[i].length());
+        ends[i] = offset;
+    }
+    context->getCpuParallel()->parallel_for(stringCount, [&](size_t i) {
+        if (!data[i].empty()) {
+            std::memcpy(symbols + begins[i], data[i].data(), data[i].length());
+        }
+    });
 }
 }  // namespace ov::intel_cpu::node
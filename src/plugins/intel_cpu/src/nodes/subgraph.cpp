@@ -932,8 +932,9 @@ void Subgraph::prepareParams() {
         // compiled in JIT code
         // 2. Generate JIT code with this static data if needed
         // 3. Create SubgraphStaticExecutor
+        // The static code is immutable after the generation, so it is taken from the cache shared by the streams
         const auto& snippet_config = ov::as_type_ptr<CPURuntimeConfig>(snippet->update_runtime_config());
-        const auto code_gen_result = cache->getOrCreate(
+        const auto code_gen_result = context->getSnippetsCodeCache()->getOrCreate(
             SubgraphCodeGeneratorKey(subgraph_attrs, getBroadcastingMask(in_shapes), key.constant_repacked_mask),
             [this, &snippet_config](const SubgraphCodeGeneratorKey& key) -> std::shared_ptr<SubgraphCodeGenerator> {
                 return std::make_shared<SubgraphCodeGenerator>(key.attrs, snippet_config, external_ptrs_idces);
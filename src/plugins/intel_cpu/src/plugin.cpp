@@ -522,6 +522,9 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
     if (name == ov::internal::exclusive_async_requests.name()) {
         return engConfig.exclusiveAsyncRequests;
     }
+    if (name == ov::internal::streams_work_stealing.name()) {
+        return engConfig.streamsWorkStealing;
+    }
 
     if (name == ov::hint::dynamic_quantization_group_size) {
         return static_cast<decltype(ov::hint::dynamic_quantization_group_size)::value_type>(
@@ -628,6 +631,7 @@ ov::Any Plugin::get_ro_property(const std::string& name, [[maybe_unused]] const
             ov::PropertyName{ov::internal::caching_with_mmap.name(), ov::PropertyMutability::RO},
 #endif
             ov::PropertyName{ov::internal::exclusive_async_requests.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::internal::streams_work_stealing.name(), ov::PropertyMutability::RW},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::internal::compiled_model_runtime_properties_supported.name(),
                              ov::PropertyMutability::RO}};
@@ -819,7 +823,12 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model = std::make_shared<CompiledModel>(model,
+                                                          shared_from_this(),
+                                                          conf,
+                                                          loaded_from_cache,
+                                                          nullptr,
+                                                          deserializer.get_packed_weights());
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
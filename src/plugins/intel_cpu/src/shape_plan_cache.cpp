@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_plan_cache.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "cache/concurrent_lru_cache.h"
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+ShapePlanCache::ShapePlanCache(size_t capacity, std::vector<bool> replayable)
+    : m_capacity(capacity),
+      m_replayable(std::move(replayable)) {
+    OPENVINO_ASSERT(m_capacity > 0, "ShapePlanCache expects non-zero capacity");
+}
+
+ShapePlan& ShapePlanCache::get(uint64_t signature) {
+    auto it = m_index.find(signature);
+    if (it != m_index.end()) {
+        m_plans.splice(m_plans.begin(), m_plans, it->second);
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        return it->second->second;
+    }
+
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    if (m_plans.size() == m_capacity) {
+        m_index.erase(m_plans.back().first);
+        m_plans.pop_back();
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ShapePlan plan(m_replayable.size());
+    for (size_t i = 0; i < plan.size(); i++) {
+        plan[i].replayable = m_replayable[i];
+    }
+    m_plans.emplace_front(signature, std::move(plan));
+    m_index.emplace(signature, m_plans.begin());
+    m_size.store(m_plans.size(), std::memory_order_relaxed);
+    return m_plans.front().second;
+}
+
+CacheStatistics ShapePlanCache::getStatistics() const {
+    CacheStatistics stats;
+    stats.hits = m_hits.load(std::memory_order_relaxed);
+    stats.misses = m_misses.load(std::memory_order_relaxed);
+    stats.evictions = m_evictions.load(std::memory_order_relaxed);
+    stats.size = m_size.load(std::memory_order_relaxed);
+    return stats;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cache/concurrent_lru_cache.h"
+#include "cpu_types.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * Output dims of a dynamic node inferred for the recorded input dims.
+ */
+struct NodeShapePlan {
+    std::vector<VectorDims> inputDims;
+    std::vector<VectorDims> outputDims;
+    // the output dims are a function of the input dims only, so the recorded ones can be reused
+    bool replayable = false;
+};
+
+// per executable node of the graph
+using ShapePlan = std::vector<NodeShapePlan>;
+
+/**
+ * LRU cache of the shape plans of a dynamic graph, keyed by the signature of the graph input shapes.
+ * A plan is recorded by the first inference with a signature and replayed by the following ones, so the shape inference
+ * is skipped for the nodes whose input dims match the recorded ones and their output memory is redefined right away.
+ * The dims are still compared node by node, so a signature collision or a data dependent shape only makes the nodes
+ * infer their shapes again.
+ *
+ * Used by one inference at a time (the graph is locked by the request), the statistics may be read concurrently.
+ */
+class ShapePlanCache {
+public:
+    using Ptr = std::shared_ptr<ShapePlanCache>;
+
+    ShapePlanCache(size_t capacity, std::vector<bool> replayable);
+
+    // Returns the plan of the signature, an empty plan is added on a miss and is recorded by the inference
+    ShapePlan& get(uint64_t signature);
+
+    [[nodiscard]] CacheStatistics getStatistics() const;
+
+private:
+    size_t m_capacity;
+    std::vector<bool> m_replayable;
+    // the most recently used first
+    std::list<std::pair<uint64_t, ShapePlan>> m_plans;
+    std::unordered_map<uint64_t, std::list<std::pair<uint64_t, ShapePlan>>::iterator> m_index;
+
+    std::atomic<size_t> m_hits{0};
+    std::atomic<size_t> m_misses{0};
+    std::atomic<size_t> m_evictions{0};
+    std::atomic<size_t> m_size{0};
+};
+
+}  // namespace ov::intel_cpu
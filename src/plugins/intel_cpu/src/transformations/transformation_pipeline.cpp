@@ -42,6 +42,7 @@
 #include "openvino/op/grouped_matmul.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/max_pool.hpp"
+#include "openvino/op/mvn.hpp"
 #include "openvino/op/paged_attention.hpp"
 #include "openvino/op/reduce_max.hpp"
 #include "openvino/op/reduce_sum.hpp"
@@ -51,6 +52,7 @@
 #include "openvino/op/util/attr_types.hpp"
 #include "ov_ops/gather_compressed.hpp"
 #include "ov_ops/gather_matmul.hpp"
+#include "ov_ops/rms.hpp"
 
 // Common transformations
 #include "openvino/pass/constant_folding.hpp"
@@ -154,6 +156,7 @@
 #include "utils/precision_support.h"
 
 // Snippets
+#include "snippets/op/subgraph.hpp"
 #include "snippets/pass/collapse_subgraph.hpp"
 #include "snippets/pass/explicit_transpose_matmul_inputs.hpp"
 #include "snippets/pass/extract_reshapes_from_mha.hpp"
@@ -915,6 +918,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompression);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion);
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraMultiAdapterSubgraphFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
 
     manager.run_passes(model);
@@ -1459,7 +1463,13 @@ void Transformations::MainSnippets() {
                                                                  const ov::op::v1::ReduceMax,
                                                                  const ov::op::v1::ReduceSum>(n));
         };
-        return !is_unsupported(n) && !is_unsupported_by_common_tokenization(n);
+        // CPU MVN and RMSNorm nodes outperform the decomposed normalizations when they are standalone,
+        // so they are tokenized only to be fused with the producer Subgraph
+        auto is_standalone_normalization = [](const std::shared_ptr<const ov::Node>& n) {
+            return ov::is_type_any_of<const ov::op::v6::MVN, const ov::op::internal::RMS>(n) &&
+                   !ov::is_type<const snippets::op::Subgraph>(n->get_input_node_shared_ptr(0));
+        };
+        return !is_unsupported(n) && !is_unsupported_by_common_tokenization(n) && !is_standalone_normalization(n);
     };
 
     auto has_supported_tensors = [ignoreCallback](const std::shared_ptr<const ov::Node>& n) -> bool {
@@ -1504,7 +1514,8 @@ void Transformations::MainSnippets() {
                     (ov::is_type_any_of<const op::v1::Transpose,
                                         const op::v1::Broadcast,
                                         const op::v1::ReduceMax,
-                                        const op::v1::ReduceSum>(n)));
+                                        const op::v1::ReduceSum>(n))) ||
+                   (is_input && t.get_element_type().is_integral_number() && ov::is_type<const op::v6::MVN>(n));
         };
 
         const auto& inputs = n->inputs();
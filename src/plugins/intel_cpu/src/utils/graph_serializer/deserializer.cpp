@@ -40,6 +40,7 @@
 #include "openvino/util/xml_parse_utils.hpp"
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 #include "utils/codec_xor.hpp"
+#include "utils/graph_serializer/packed_weights.hpp"
 
 namespace ov::intel_cpu {
 
@@ -149,7 +150,16 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Blob from cache may have other header, so need to skip this.
     auto* buffer_base = reinterpret_cast<char*>(model_buffer->get_ptr());
 
-    const auto file_size = model_buffer->size();
+    auto file_size = model_buffer->size();
+    if (file_size >= packedWeightsTrailerSize) {
+        const auto section =
+            findPackedWeightsSection(buffer_base + file_size - packedWeightsTrailerSize, file_size);
+        if (section) {
+            // The packed weights are used in place and keep the blob alive
+            m_packed_weights = parsePackedWeights(buffer_base + section->offset, section->size, model_buffer);
+            file_size = section->modelEnd;
+        }
+    }
     pass::StreamSerialize::DataHeader hdr = {};
     std::memcpy(reinterpret_cast<char*>(&hdr), buffer_base, sizeof hdr);
 
@@ -209,7 +219,20 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
 
     const size_t hdr_pos = model_stream.tellg();
     model_stream.seekg(0, std::istream::end);
-    const size_t file_size = model_stream.tellg();
+    size_t file_size = model_stream.tellg();
+
+    if (file_size - hdr_pos >= packedWeightsTrailerSize) {
+        char trailer[packedWeightsTrailerSize];
+        model_stream.seekg(file_size - packedWeightsTrailerSize, std::istream::beg);
+        model_stream.read(trailer, packedWeightsTrailerSize);
+        if (const auto section = findPackedWeightsSection(trailer, file_size - hdr_pos)) {
+            auto section_buf = std::make_shared<ov::AlignedBuffer>(section->size, 64);
+            model_stream.seekg(hdr_pos + section->offset, std::istream::beg);
+            model_stream.read(section_buf->get_ptr<char>(), section->size);
+            m_packed_weights = parsePackedWeights(section_buf->get_ptr<char>(), section->size, section_buf);
+            file_size = hdr_pos + section->modelEnd;
+        }
+    }
     model_stream.seekg(hdr_pos, std::istream::beg);
 
     pass::StreamSerialize::DataHeader hdr = {};
@@ -14,6 +14,7 @@
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "utils/codec_xor.hpp"
+#include "weights_cache.hpp"
 
 namespace ov {
 class ICore;
@@ -89,6 +90,11 @@ public:
 
     void operator>>(std::shared_ptr<ov::Model>& model);
 
+    // Repacked weights stored in the blob for the current ISA, nullptr if there are none
+    [[nodiscard]] const PackedWeights::Ptr& get_packed_weights() const {
+        return m_packed_weights;
+    }
+
 protected:
     static void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
 
@@ -105,6 +111,7 @@ protected:
     CacheDecrypt m_cache_decrypt;
     bool m_decript_from_string;
     std::shared_ptr<ov::AlignedBuffer> m_origin_weights_buf;
+    PackedWeights::Ptr m_packed_weights;
 };
 
 }  //  namespace ov::intel_cpu
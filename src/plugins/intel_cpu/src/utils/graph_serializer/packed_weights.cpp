@@ -0,0 +1,151 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "packed_weights.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "openvino/core/except.hpp"
+#include "weights_cache.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+constexpr uint64_t kPackedWeightsMagic = 0x314B434150555043ULL;  // "CPUPACK1"
+constexpr uint64_t kPackedWeightsAlignment = 64;
+
+uint64_t alignUp(uint64_t value) {
+    return (value + kPackedWeightsAlignment - 1) / kPackedWeightsAlignment * kPackedWeightsAlignment;
+}
+
+void putU64(std::ostream& stream, uint64_t value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void putString(std::ostream& stream, const std::string& value) {
+    putU64(stream, value.size());
+    stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+void putPadding(std::ostream& stream, uint64_t size) {
+    static const char zeros[kPackedWeightsAlignment] = {};
+    stream.write(zeros, static_cast<std::streamsize>(size));
+}
+
+class SectionReader {
+public:
+    SectionReader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    uint64_t u64() {
+        uint64_t value = 0;
+        std::memcpy(&value, take(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    std::string string() {
+        const auto size = u64();
+        return {take(size), size};
+    }
+
+private:
+    const char* take(uint64_t size) {
+        OPENVINO_ASSERT(size <= m_size - m_pos, "[CPU] Packed weights section of the cache blob is corrupted");
+        const char* ptr = m_data + m_pos;
+        m_pos += size;
+        return ptr;
+    }
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+}  // namespace
+
+void writePackedWeights(std::ostream& stream,
+                        std::streampos blobBegin,
+                        const std::vector<std::pair<std::string, MemoryCPtr>>& weights) {
+    const auto modelEnd = static_cast<uint64_t>(stream.tellp() - blobBegin);
+    const auto sectionOffset = alignUp(modelEnd);
+    putPadding(stream, sectionOffset - modelEnd);
+
+    const auto isaTag = PackedWeights::isaTag();
+    uint64_t indexSize = 3 * sizeof(uint64_t) + isaTag.size();
+    for (const auto& [key, memory] : weights) {
+        indexSize += 3 * sizeof(uint64_t) + key.size();
+    }
+
+    putU64(stream, kPackedWeightsMagic);
+    putString(stream, isaTag);
+    putU64(stream, weights.size());
+    std::vector<uint64_t> offsets;
+    offsets.reserve(weights.size());
+    uint64_t offset = alignUp(indexSize);
+    for (const auto& [key, memory] : weights) {
+        offsets.push_back(offset);
+        putString(stream, key);
+        putU64(stream, offset);
+        putU64(stream, memory->getSize());
+        offset = alignUp(offset + memory->getSize());
+    }
+
+    uint64_t written = indexSize;
+    for (size_t i = 0; i < weights.size(); i++) {
+        const auto& memory = weights[i].second;
+        putPadding(stream, offsets[i] - written);
+        stream.write(static_cast<const char*>(memory->getData()), static_cast<std::streamsize>(memory->getSize()));
+        written = offsets[i] + memory->getSize();
+    }
+
+    putU64(stream, modelEnd);
+    putU64(stream, sectionOffset);
+    putU64(stream, kPackedWeightsMagic);
+}
+
+std::optional<PackedWeightsSection> findPackedWeightsSection(const char* trailer, size_t blobSize) {
+    if (blobSize < packedWeightsTrailerSize) {
+        return std::nullopt;
+    }
+    uint64_t values[3];
+    std::memcpy(values, trailer, sizeof(values));
+    const auto [modelEnd, sectionOffset, magic] = values;
+    if (magic != kPackedWeightsMagic || modelEnd > sectionOffset ||
+        sectionOffset > blobSize - packedWeightsTrailerSize) {
+        return std::nullopt;
+    }
+    return PackedWeightsSection{modelEnd, sectionOffset, blobSize - packedWeightsTrailerSize - sectionOffset};
+}
+
+PackedWeights::Ptr parsePackedWeights(const char* section, size_t size, std::shared_ptr<void> owner) {
+    SectionReader reader(section, size);
+    OPENVINO_ASSERT(reader.u64() == kPackedWeightsMagic, "[CPU] Packed weights section of the cache blob is corrupted");
+    if (reader.string() != PackedWeights::isaTag()) {
+        // The weights are repacked again for the current ISA
+        return nullptr;
+    }
+
+    auto packedWeights = std::make_shared<PackedWeights>(std::move(owner));
+    const auto count = reader.u64();
+    for (uint64_t i = 0; i < count; i++) {
+        auto key = reader.string();
+        const auto offset = reader.u64();
+        const auto weightsSize = reader.u64();
+        OPENVINO_ASSERT(offset <= size && weightsSize <= size - offset,
+                        "[CPU] Packed weights section of the cache blob is corrupted");
+        packedWeights->add(std::move(key), section + offset, weightsSize);
+    }
+    return packedWeights;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "weights_cache.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * Optional section of a compiled model blob with the repacked weights, appended after the model written by
+ * ModelSerializer. Offsets are relative to the beginning of the blob:
+ *
+ *   [model] [padding] [section: magic, ISA tag, entries (key, offset, size)] [weights] [trailer]
+ *
+ * The trailer stores where the model ends and where the section begins, so a blob without the trailer is read exactly
+ * as before. Every weight starts at a 64 bytes aligned offset.
+ */
+struct PackedWeightsSection {
+    size_t modelEnd;
+    size_t offset;
+    size_t size;
+};
+
+// Appends the section to a blob which begins at the stream position `blobBegin` and ends at the current position
+void writePackedWeights(std::ostream& stream,
+                        std::streampos blobBegin,
+                        const std::vector<std::pair<std::string, MemoryCPtr>>& weights);
+
+// Size of the trailer at the end of a blob with packed weights
+inline constexpr size_t packedWeightsTrailerSize = 3 * sizeof(uint64_t);
+
+// Locates the section by the trailer, i.e. the last packedWeightsTrailerSize bytes of a blob of `blobSize` bytes
+std::optional<PackedWeightsSection> findPackedWeightsSection(const char* trailer, size_t blobSize);
+
+// Parses a section read to `section`, returns nullptr if the weights were packed for another ISA
+PackedWeights::Ptr parsePackedWeights(const char* section, size_t size, std::shared_ptr<void> owner);
+
+}  // namespace ov::intel_cpu
@@ -11,6 +11,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
@@ -26,7 +27,10 @@ namespace ov::intel_cpu {
 
 class WeightlessWriter : public util::ConstantWriter {
 public:
-    explicit WeightlessWriter(util::ConstantWriter& other) : util::ConstantWriter(other), m_offset{} {}
+    explicit WeightlessWriter(util::ConstantWriter& other, bool weightless_mode = false)
+        : util::ConstantWriter(other),
+          m_offset{},
+          m_weightless_mode{weightless_mode} {}
 
     WeightlessWriter(std::ostream& bin_file) : util::ConstantWriter(bin_file), m_offset{} {}
 
@@ -49,6 +53,13 @@ public:
         return offset;
     }
 
+    // the weights of the constants are skipped per node in the weightless mode, so they are not prepared
+    void prepare(const std::vector<ConstantData>& constants) override {
+        if (!m_weightless_mode) {
+            util::ConstantWriter::prepare(constants);
+        }
+    }
+
     void skip_weights(bool skip_weights) {
         m_skip_weights = skip_weights;
     }
@@ -56,6 +67,7 @@ public:
 private:
     WeightlessWriter::FilePosition m_offset;
     bool m_skip_weights = false;
+    bool m_weightless_mode = false;
 };
 
 class XmlSerializer : public util::XmlSerializer {
@@ -77,7 +89,7 @@ public:
                               compress_to_fp16,
                               output_element_type,
                               data_is_temporary),
-          m_weightless_const_writer(constant_write_handler),
+          m_weightless_const_writer(constant_write_handler, wl_mode),
           m_weightless_mode(wl_mode) {}
 
 private:
@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "owner_only_file.hpp"
+
+#include <filesystem>
+#include <system_error>
+
+#include "openvino/core/except.hpp"
+
+#ifdef _WIN32
+#    include <fstream>
+#    include <ios>
+#else
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace ov::intel_cpu {
+
+void createOwnerOnlyDirectory(const std::filesystem::path& path) {
+    std::error_code ec;
+    if (std::filesystem::create_directories(path, ec)) {
+        std::filesystem::permissions(path, std::filesystem::perms::owner_all, ec);
+    }
+    OPENVINO_ASSERT(std::filesystem::is_directory(path), "Cannot create directory ", path);
+}
+
+void createOwnerOnlyFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    OPENVINO_ASSERT(file.is_open(), "Cannot create ", path);
+#else
+    const int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC | O_NOFOLLOW, S_IRUSR | S_IWUSR);
+    OPENVINO_ASSERT(fd != -1, "Cannot create ", path);
+    close(fd);
+#endif
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <filesystem>
+
+namespace ov::intel_cpu {
+
+/**
+ * Files of the plugin which may hold model or user data (shared weights, offloaded KV cache) are accessible to the
+ * current user only, whatever the umask of the process is.
+ */
+
+// Creates the directory with owner-only permissions. An existing directory is kept as is.
+void createOwnerOnlyDirectory(const std::filesystem::path& path);
+
+// Creates an empty file only the current user can access, fails if the file exists
+void createOwnerOnlyFile(const std::filesystem::path& path);
+
+}  // namespace ov::intel_cpu
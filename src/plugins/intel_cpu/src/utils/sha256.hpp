@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ov::intel_cpu {
+
+/**
+ * Incremental SHA-256 (FIPS 180-4)
+ *
+ * Identifies content that is shared with other processes (see SharedWeightsStorage), where a non-cryptographic hash
+ * collision would silently hand out foreign data.
+ */
+class Sha256 {
+public:
+    using Digest = std::array<uint8_t, 32>;
+
+    Sha256();
+
+    void update(const void* data, size_t size);
+    Digest finalize();
+
+    static std::string toHex(const Digest& digest);
+
+private:
+    void compress(const uint8_t* block);
+
+    std::array<uint32_t, 8> m_state;
+    std::array<uint8_t, 64> m_block{};
+    size_t m_blockSize = 0;
+    uint64_t m_totalSize = 0;
+};
+
+}  // namespace ov::intel_cpu
@@ -5,21 +5,259 @@
 #include "weights_cache.hpp"
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <random>
 #include <string>
+#include <system_error>
+#include <unordered_map>
 #include <utility>
-#ifdef CPU_DEBUG_CAPS
-#    include <vector>
-#endif
+#include <vector>
 
 #include "cpu_memory.h"
+#include "memory_desc/cpu_memory_desc.h"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/system_conf.hpp"
+#include "openvino/util/mmap_object.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/owner_only_file.hpp"
+#include "utils/sha256.hpp"
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
 
 namespace ov::intel_cpu {
 
+namespace {
+
+// Layout of a shared weights file: the header, the key, then the weights at a page aligned offset.
+struct SharedWeightsHeader {
+    static constexpr uint64_t kMagic = 0x315357555043564FULL;  // "OVCPUWS1"
+    static constexpr uint64_t kDataAlignment = 4096;
+
+    uint64_t magic = kMagic;
+    uint64_t keySize = 0;
+    uint64_t dataOffset = 0;
+    uint64_t dataSize = 0;
+};
+
+/**
+ * Read-only memory block over weights owned by another object (a file mapping, a cache blob). Keeps the owner alive.
+ */
+class ReadOnlyMemoryBlock : public IMemoryBlock {
+public:
+    ReadOnlyMemoryBlock(std::shared_ptr<void> owner, const void* data, size_t size)
+        : m_owner(std::move(owner)),
+          m_data(data),
+          m_size(size) {}
+
+    [[nodiscard]] void* getRawPtr() const noexcept override {
+        return const_cast<void*>(m_data);
+    }
+
+    void setExtBuff([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) override {
+        OPENVINO_THROW("Read-only weights memory cannot be redirected to another buffer");
+    }
+
+    bool resize(size_t size) override {
+        OPENVINO_ASSERT(size <= m_size, "Read-only weights memory cannot be resized");
+        return false;
+    }
+
+    [[nodiscard]] bool hasExtBuffer() const noexcept override {
+        return true;
+    }
+
+private:
+    std::shared_ptr<void> m_owner;
+    const void* m_data;
+    size_t m_size;
+};
+
+MemoryPtr makeReadOnlyMemory(std::shared_ptr<void> owner,
+                             const void* data,
+                             size_t size,
+                             const dnnl::engine& eng,
+                             const MemoryDescPtr& desc) {
+    auto block = std::make_shared<DnnlMemoryBlock>(std::make_unique<ReadOnlyMemoryBlock>(std::move(owner), data, size));
+    return std::make_shared<Memory>(eng, desc, block);
+}
+
+constexpr const char* kTemporarySuffix = ".tmp";
+// A temporary file this old is left over by a publisher that crashed before the rename
+constexpr auto kStaleTemporaryAge = std::chrono::hours(1);
+
+std::shared_ptr<ov::MappedMemory> mapOwnedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+    return ov::load_mmap_object(path);
+#else
+    // The directory may be writable by other users (e.g. /dev/shm): only a regular file created by this user and not
+    // accessible to anybody else is trusted. The checks are done on the opened descriptor, which is then mapped, so
+    // the file cannot be swapped in between
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC | O_NOFOLLOW);
+    if (fd == -1) {
+        return nullptr;
+    }
+    struct stat sb = {};
+    if (fstat(fd, &sb) != 0 || !S_ISREG(sb.st_mode) || sb.st_uid != geteuid() || (sb.st_mode & (S_IRWXG | S_IRWXO))) {
+        DEBUG_LOG("Shared weights file ", path, " is not owned exclusively by the current user, ignored");
+        close(fd);
+        return nullptr;
+    }
+    return ov::load_mmap_object(fd);
+#endif
+}
+
+MemoryPtr mapSharedWeights(const std::filesystem::path& path,
+                           const std::string& key,
+                           const dnnl::engine& eng,
+                           const MemoryDescPtr& desc) {
+    auto mapping = mapOwnedFile(path);
+    if (!mapping) {
+        return nullptr;
+    }
+    SharedWeightsHeader header;
+    if (mapping->size() < sizeof(header)) {
+        return nullptr;
+    }
+    std::memcpy(&header, mapping->data(), sizeof(header));
+    const bool valid = header.magic == SharedWeightsHeader::kMagic && header.keySize == key.size() &&
+                       sizeof(header) + header.keySize <= header.dataOffset && header.dataOffset <= mapping->size() &&
+                       header.dataSize == desc->getCurrentMemSize() &&
+                       header.dataSize <= mapping->size() - header.dataOffset &&
+                       std::memcmp(mapping->data() + sizeof(header), key.data(), key.size()) == 0;
+    if (!valid) {
+        return nullptr;
+    }
+    const auto* data = mapping->data() + header.dataOffset;
+    return makeReadOnlyMemory(std::move(mapping), data, header.dataSize, eng, desc);
+}
+
+}  // namespace
+
+SharedWeightsStorage::SharedWeightsStorage(std::filesystem::path dir, int socket_id)
+    : m_dir(std::move(dir)),
+      m_socketId(socket_id) {
+    createOwnerOnlyDirectory(m_dir);
+    removeStaleTemporaryFiles();
+}
+
+std::string SharedWeightsStorage::filePrefix() const {
+    return "ov_cpu_weights_" + std::to_string(m_socketId) + "_";
+}
+
+std::filesystem::path SharedWeightsStorage::filePath(const std::string& key) const {
+    Sha256 sha;
+    sha.update(key.data(), key.size());
+    return m_dir / (filePrefix() + Sha256::toHex(sha.finalize()) + ".bin");
+}
+
+void SharedWeightsStorage::removeStaleTemporaryFiles() const {
+    // Only the leftovers of crashed publishers are removed: the published files may be mapped by other processes
+    // at any time, see the class description on their eviction
+    const auto prefix = filePrefix();
+    const auto now = std::filesystem::file_time_type::clock::now();
+    std::error_code ec;
+    for (auto it = std::filesystem::directory_iterator(m_dir, ec); !ec && it != std::filesystem::directory_iterator();
+         it.increment(ec)) {
+        const auto name = it->path().filename().string();
+        if (name.rfind(prefix, 0) != 0 || it->path().extension() != kTemporarySuffix || !it->is_regular_file(ec)) {
+            continue;
+        }
+        const auto modified = it->last_write_time(ec);
+        if (!ec && now - modified > kStaleTemporaryAge) {
+            std::filesystem::remove(it->path(), ec);
+        }
+        ec.clear();
+    }
+}
+
+MemoryPtr SharedWeightsStorage::find(const std::string& key, const dnnl::engine& eng, const MemoryDescPtr& desc) const {
+    const auto path = filePath(key);
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec)) {
+        return nullptr;
+    }
+    try {
+        return mapSharedWeights(path, key, eng, desc);
+    } catch (const std::exception& e) {
+        DEBUG_LOG("Cannot map shared weights ", path, ": ", e.what());
+        return nullptr;
+    }
+}
+
+MemoryPtr SharedWeightsStorage::publish(const std::string& key, const dnnl::engine& eng, const IMemory& memory) const {
+    const auto path = filePath(key);
+    // The weights are written to a randomly named temporary file, which is then renamed over the final name in one
+    // step: concurrent publishers of the same weights write identical content and the last rename wins.
+    auto tmpPath = path;
+    tmpPath += "." + std::to_string(std::random_device{}()) + std::to_string(std::random_device{}()) + kTemporarySuffix;
+    std::error_code ec;
+    try {
+        SharedWeightsHeader header;
+        header.keySize = key.size();
+        header.dataOffset = (sizeof(header) + key.size() + SharedWeightsHeader::kDataAlignment - 1) /
+                            SharedWeightsHeader::kDataAlignment * SharedWeightsHeader::kDataAlignment;
+        header.dataSize = memory.getSize();
+        createOwnerOnlyFile(tmpPath);
+        {
+            std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+            OPENVINO_ASSERT(file.is_open(), "Cannot open ", tmpPath);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(key.data(), static_cast<std::streamsize>(key.size()));
+            const std::string padding(header.dataOffset - sizeof(header) - key.size(), '\0');
+            file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+            file.write(static_cast<const char*>(memory.getData()), static_cast<std::streamsize>(header.dataSize));
+            OPENVINO_ASSERT(file.good(), "Cannot write ", tmpPath);
+        }
+        std::filesystem::rename(tmpPath, path, ec);
+        std::filesystem::remove(tmpPath, ec);
+        // Even if the rename failed, another process may have published the same weights meanwhile
+        return mapSharedWeights(path, key, eng, memory.getDescPtr());
+    } catch (const std::exception& e) {
+        DEBUG_LOG("Cannot publish shared weights ", path, ": ", e.what());
+        std::filesystem::remove(tmpPath, ec);
+        return nullptr;
+    }
+}
+
+void PackedWeights::add(std::string key, const void* data, size_t size) {
+    m_weights[std::move(key)] = {data, size};
+}
+
+MemoryPtr PackedWeights::find(const std::string& key, const dnnl::engine& eng, const MemoryDescPtr& desc) const {
+    auto found = m_weights.find(key);
+    if (found == m_weights.end()) {
+        return nullptr;
+    }
+    const auto& [data, size] = found->second;
+    if (size != desc->getCurrentMemSize()) {
+        return nullptr;
+    }
+    // The blob is not necessarily aligned in memory (e.g. it is read from a stream into an unaligned buffer)
+    constexpr uintptr_t alignment = 64;
+    if (reinterpret_cast<uintptr_t>(data) % alignment != 0) {
+        auto memory = std::make_shared<Memory>(eng, desc);
+        std::memcpy(memory->getData(), data, size);
+        return memory;
+    }
+    return makeReadOnlyMemory(m_owner, data, size, eng, desc);
+}
+
+std::string PackedWeights::isaTag() {
+    return std::to_string(static_cast<int>(dnnl::get_effective_cpu_isa()));
+}
+
 WeightsSharing::SharedMemory::SharedMemory(std::unique_lock<std::mutex>&& lock,
                                            MemoryInfo::Ptr memory,
                                            MemoryPtr newPtr)
@@ -73,6 +311,49 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
                                           newPtr);
 }
 
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string& key,
+                                                               const std::function<MemoryPtr(void)>& create,
+                                                               const std::function<std::string(void)>& persistentKey,
+                                                               const dnnl::engine& eng,
+                                                               const MemoryDescPtr& desc) {
+    if (!storage && !packedWeights && !trackPackedWeights) {
+        return findOrCreate(key, create);
+    }
+    auto createShared = [&]() -> MemoryPtr {
+        const auto sharedKey = persistentKey();
+        auto memory = packedWeights ? packedWeights->find(sharedKey, eng, desc) : nullptr;
+        if (!memory && storage) {
+            memory = storage->find(sharedKey, eng, desc);
+        }
+        if (!memory) {
+            memory = create();
+            if (storage) {
+                if (auto published = storage->publish(sharedKey, eng, *memory)) {
+                    // The private copy is dropped in favor of the one shared with the other processes
+                    memory = published;
+                }
+            }
+        }
+        if (trackPackedWeights) {
+            // called under the guard lock by findOrCreate
+            trackedPackedWeights[sharedKey] = memory;
+        }
+        return memory;
+    };
+    return findOrCreate(key, createShared);
+}
+
+std::vector<std::pair<std::string, MemoryCPtr>> WeightsSharing::getPackedWeights() const {
+    std::vector<std::pair<std::string, MemoryCPtr>> retVal;
+    std::lock_guard<std::mutex> lock(guard);
+    for (const auto& [key, weakMemory] : trackedPackedWeights) {
+        if (auto memory = weakMemory.lock()) {
+            retVal.emplace_back(key, memory);
+        }
+    }
+    return retVal;
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
@@ -93,10 +374,16 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
+SocketsWeights::SocketsWeights(const std::string& sharedWeightsDir,
+                               const PackedWeights::Ptr& packedWeights,
+                               bool trackPackedWeights) {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
-        _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+        auto storage = sharedWeightsDir.empty()
+                           ? nullptr
+                           : std::make_shared<SharedWeightsStorage>(std::filesystem::path(sharedWeightsDir), socket_id);
+        _cache_map[socket_id] =
+            std::make_shared<WeightsSharing>(std::move(storage), packedWeights, trackPackedWeights);
     }
 }
 
@@ -112,6 +399,17 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
     return found->second;
 }
 
+std::vector<std::pair<std::string, MemoryCPtr>> SocketsWeights::getPackedWeights() const {
+    // Every socket holds its own copy of the same weights, one of them is enough
+    std::unordered_map<std::string, MemoryCPtr> unique;
+    for (const auto& item : _cache_map) {
+        for (auto& [key, memory] : item.second->getPackedWeights()) {
+            unique.emplace(std::move(key), std::move(memory));
+        }
+    }
+    return {unique.begin(), unique.end()};
+}
+
 #ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
     Statistics retVal = {0, 0};
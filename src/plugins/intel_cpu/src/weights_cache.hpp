@@ -6,6 +6,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <filesystem>
 #include <functional>
 #include <map>
 #include <memory>
@@ -16,6 +17,7 @@
 #include <vector>
 
 #include "cpu_memory.h"
+#include "memory_desc/cpu_memory_desc.h"
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -24,6 +26,75 @@
 //       classes at all.
 
 namespace ov::intel_cpu {
+/**
+ * Cross-process store of repacked weights
+ *
+ * Every weight is kept in its own file of a directory shared by the processes of the host (a tmpfs mount, e.g.
+ * /dev/shm, keeps the files in RAM) and is mapped read-only, so the processes running the same model share one
+ * physical copy of the packed weights. A file is named after a process independent key and is published atomically,
+ * so a reader never maps a partially written file.
+ *
+ * The key identifies the weights by their size and SHA-256 digest (see DnnlExtensionUtils::computeWeightsContentHash)
+ * and is stored in full in the file, a file is used only if the stored key, the size and the layout match. The files
+ * are created accessible to the owner only, and a file owned by another user or accessible to anybody else is ignored,
+ * so a foreign writer of a shared directory (e.g. /dev/shm) cannot inject weights.
+ *
+ * Eviction: a published file stays in the directory after the processes exit, so that a later run maps it instead of
+ * repacking, and is never removed by the plugin since other processes may map it at any time. Removing a file is safe
+ * at any moment (the processes mapping it keep their copy), so the directory is cleaned by the user or by the system
+ * (a tmpfs is emptied on reboot); the files of a model that is no longer run are not reclaimed otherwise. Temporary
+ * files left over by crashed publishers are removed when a storage is created.
+ *
+ * Is a thread and process safe
+ */
+class SharedWeightsStorage {
+public:
+    using Ptr = std::shared_ptr<SharedWeightsStorage>;
+
+    SharedWeightsStorage(std::filesystem::path dir, int socket_id);
+
+    // Maps the weights published under the key, returns nullptr if there are none
+    MemoryPtr find(const std::string& key, const dnnl::engine& eng, const MemoryDescPtr& desc) const;
+    // Publishes the content of the memory under the key and returns its mapped copy, returns nullptr on failure
+    MemoryPtr publish(const std::string& key, const dnnl::engine& eng, const IMemory& memory) const;
+
+private:
+    [[nodiscard]] std::string filePrefix() const;
+    [[nodiscard]] std::filesystem::path filePath(const std::string& key) const;
+    void removeStaleTemporaryFiles() const;
+
+    std::filesystem::path m_dir;
+    int m_socketId;
+};
+
+/**
+ * Repacked weights imported from a compiled model cache blob
+ *
+ * The weights are looked up by the same process independent key as in SharedWeightsStorage and are used in place,
+ * without a copy, when they are suitably aligned. The blob memory is kept alive as long as any of the weights is used.
+ * The weights are only valid for the CPU ISA they were packed for, see isaTag().
+ */
+class PackedWeights {
+public:
+    using Ptr = std::shared_ptr<PackedWeights>;
+
+    explicit PackedWeights(std::shared_ptr<void> owner) : m_owner(std::move(owner)) {}
+
+    void add(std::string key, const void* data, size_t size);
+    // Returns the weights stored under the key, or nullptr if there are none or their size does not match the desc
+    MemoryPtr find(const std::string& key, const dnnl::engine& eng, const MemoryDescPtr& desc) const;
+    [[nodiscard]] size_t size() const {
+        return m_weights.size();
+    }
+
+    // Identifies the CPU ISA the weights are packed for
+    static std::string isaTag();
+
+private:
+    std::shared_ptr<void> m_owner;
+    std::unordered_map<std::string, std::pair<const void*, size_t>> m_weights;
+};
+
 /**
  * Caching store of Memory objects
  * Will return a cached object or create new one
@@ -51,6 +122,13 @@ public:
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    explicit WeightsSharing(SharedWeightsStorage::Ptr storage = nullptr,
+                            PackedWeights::Ptr packedWeights = nullptr,
+                            bool trackPackedWeights = false)
+        : storage(std::move(storage)),
+          packedWeights(std::move(packedWeights)),
+          trackPackedWeights(trackPackedWeights) {}
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -71,8 +149,23 @@ public:
                                    const std::function<MemoryPtr(void)>& create,
                                    bool valid = true);
 
+    /**
+     * Same as findOrCreate for repacked weights described by `desc`. The weights imported from a cache blob or
+     * published to the cross-process storage under `persistentKey()` are used instead of being created, and the
+     * created ones are published. Unlike `key`, the persistent key must not depend on the process (e.g. on pointers)
+     * and it is only evaluated if the weights are not cached in the process yet.
+     */
+    SharedMemory::Ptr findOrCreate(const std::string& key,
+                                   const std::function<MemoryPtr(void)>& create,
+                                   const std::function<std::string(void)>& persistentKey,
+                                   const dnnl::engine& eng,
+                                   const MemoryDescPtr& desc);
+
     SharedMemory::Ptr get(const std::string& key) const;
 
+    // Repacked weights alive by their persistent keys, only tracked if enabled on construction
+    [[nodiscard]] std::vector<std::pair<std::string, MemoryCPtr>> getPackedWeights() const;
+
 #ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
@@ -80,6 +173,10 @@ public:
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    SharedWeightsStorage::Ptr storage;
+    PackedWeights::Ptr packedWeights;
+    bool trackPackedWeights;
+    std::unordered_map<std::string, std::weak_ptr<IMemory>> trackedPackedWeights;
 };
 
 /**
@@ -89,11 +186,18 @@ protected:
  */
 class SocketsWeights {
 public:
-    SocketsWeights();
+    // A non-empty directory shares the repacked weights with other processes through a SharedWeightsStorage.
+    // The packed weights imported from a cache blob are used on every socket.
+    explicit SocketsWeights(const std::string& sharedWeightsDir = {},
+                            const PackedWeights::Ptr& packedWeights = nullptr,
+                            bool trackPackedWeights = false);
 
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
 
+    // Repacked weights of all the sockets by their persistent keys, see WeightsSharing::getPackedWeights()
+    [[nodiscard]] std::vector<std::pair<std::string, MemoryCPtr>> getPackedWeights() const;
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] std::vector<std::pair<int, WeightsSharing::Statistics>> dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
@@ -2,8 +2,12 @@
 // SPDX-License-corer: Apache-2.0
 //
 
+#include <cstring>
+#include <sstream>
+
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
 #include "common_test_utils/test_common.hpp"
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/node_builders/constant.hpp"
@@ -11,7 +15,7 @@
 #include "openvino/opsets/opset9_decl.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/softmax.hpp"
-#include "openvino/opsets/opset9_decl.hpp"
+#include "internal_properties.hpp"
 
 namespace {
 
@@ -94,6 +98,43 @@ TEST_P(ExportOptimalNumStreams, OptimalNumStreams) {
     }
 }
 
+TEST(ExportPackedWeights, ImportedModelUsesPackedWeights) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto model = MakeMatMulModel();
+    ov::Core core;
+    const ov::AnyMap properties = {ov::num_streams(1), ov::intel_cpu::cpu_cache_packed_weights(true)};
+
+    auto compiled_model = core.compile_model(model, "CPU", properties);
+    const auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, {1, 4096});
+    auto infer = [&](ov::CompiledModel& network) {
+        auto request = network.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        return request.get_output_tensor();
+    };
+    const auto reference = infer(compiled_model);
+
+    std::stringstream exported_model;
+    compiled_model.export_model(exported_model);
+    std::stringstream exported_model_without_weights;
+    core.compile_model(model, "CPU", {ov::num_streams(1)}).export_model(exported_model_without_weights);
+    // the packed MatMul weights are appended to the blob
+    ASSERT_GT(exported_model.str().size(), exported_model_without_weights.str().size() + 4096 * 1024);
+
+    {
+        std::stringstream ss(exported_model.str());
+        auto imported_model = core.import_model(ss, "CPU", properties);
+        ov::test::utils::compare(reference, infer(imported_model));
+    }
+    {
+        const auto blob = exported_model.str();
+        ov::Tensor blob_tensor(ov::element::u8, {blob.size()});
+        std::memcpy(blob_tensor.data(), blob.data(), blob.size());
+        auto imported_model = core.import_model(blob_tensor, "CPU", properties);
+        ov::test::utils::compare(reference, infer(imported_model));
+    }
+}
+
 const std::vector<ov::AnyMap> testing_property_for_streams = {{ov::num_streams(1)}, {ov::num_streams(2)}};
 
 const std::vector<ov::AnyMap> testing_property_for_threads = {{ov::inference_num_threads(1)},
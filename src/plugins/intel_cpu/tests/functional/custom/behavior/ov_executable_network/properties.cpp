@@ -54,7 +54,18 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::key_cache_precision.name()),
         RO_property(ov::value_cache_precision.name()),
         RO_property(ov::key_cache_group_size.name()),
-        RO_property(ov::value_cache_group_size.name())
+        RO_property(ov::value_cache_group_size.name()),
+        RO_property(ov::intel_cpu::cpu_runtime_cache_shared.name()),
+        RO_property(ov::intel_cpu::cpu_snippets_code_cache_shared.name()),
+        RO_property(ov::intel_cpu::cpu_runtime_cache_statistics.name()),
+        RO_property(ov::intel_cpu::cpu_shared_weights_dir.name()),
+        RO_property(ov::intel_cpu::cpu_cache_packed_weights.name()),
+        RO_property(ov::intel_cpu::cpu_kv_cache_offload_dir.name()),
+        RO_property(ov::intel_cpu::cpu_kv_cache_resident_requests.name()),
+        RO_property(ov::intel_cpu::cpu_inter_op_parallel.name()),
+        RO_property(ov::intel_cpu::cpu_shape_plan_cache_capacity.name()),
+        RO_property(ov::intel_cpu::cpu_shape_plan_cache_statistics.name()),
+        RO_property(ov::intel_cpu::cpu_streams_statistics.name())
     };
 
     ov::Core ie;
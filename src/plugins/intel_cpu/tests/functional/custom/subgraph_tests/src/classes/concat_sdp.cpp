@@ -3,6 +3,9 @@
 //
 #include "concat_sdp.hpp"
 
+#include <filesystem>
+#include <optional>
+
 #include "common_test_utils/ov_tensor_utils.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/broadcast.hpp"
@@ -249,6 +252,12 @@ std::vector<std::vector<ov::Tensor>>
 ConcatSDPTest::run_test(const std::shared_ptr<ov::Model>& model, const ov::AnyMap& cfg) {
     compiledModel = core->compile_model(model, targetDevice, cfg);
     auto req = compiledModel.create_infer_request();
+    // With KV cache offloading, another request running between the iterations makes the first one offload its
+    // KV cache and read it back on the next iteration
+    std::optional<ov::InferRequest> other;
+    if (cfg.count("CPU_KV_CACHE_OFFLOAD_DIR")) {
+        other = compiledModel.create_infer_request();
+    }
     m_iter = 0;
     m_accum_L_q = 0;
     std::vector<std::vector<ov::Tensor>> all;
@@ -259,11 +268,16 @@ ConcatSDPTest::run_test(const std::shared_ptr<ov::Model>& model, const ov::AnyMa
             for (const auto& [node, tensor] : inputs) {
                 if (node->get_friendly_name() == name) {
                     req.set_tensor(port, tensor);
+                    if (other) {
+                        other->set_tensor(port, tensor);
+                    }
                     break;
                 }
             }
         }
-        req.infer();
+        // started asynchronously, so an offloaded KV cache is prefetched before the inference
+        req.start_async();
+        req.wait();
         std::vector<ov::Tensor> outs;
         for (const auto& port : compiledModel.outputs()) {
             const auto& src = req.get_tensor(port);
@@ -272,6 +286,9 @@ ConcatSDPTest::run_test(const std::shared_ptr<ov::Model>& model, const ov::AnyMa
             outs.push_back(std::move(c));
         }
         all.push_back(std::move(outs));
+        if (other) {
+            other->infer();
+        }
     }
     return all;
 }
@@ -282,11 +299,22 @@ void ConcatSDPTest::run() {
     // config keys so reference runs full-precision; keeps quant noise on actual side only.
     auto ref_config = configuration;
     for (const auto& key : {"KEY_CACHE_PRECISION", "VALUE_CACHE_PRECISION",
-                            "KEY_CACHE_QUANT_ALG", "VALUE_CACHE_QUANT_ALG"}) {
+                            "KEY_CACHE_QUANT_ALG", "VALUE_CACHE_QUANT_ALG",
+                            "CPU_KV_CACHE_OFFLOAD_DIR", "CPU_KV_CACHE_RESIDENT_REQUESTS"}) {
         ref_config.erase(key);
     }
     auto expected = run_test(functionRefs, ref_config);
     auto actual = run_test(function, configuration);
+    if (auto dir = configuration.find("CPU_KV_CACHE_OFFLOAD_DIR"); dir != configuration.end()) {
+        compiledModel = {};
+#ifndef _WIN32
+        // the offloaded KV cache holds user data
+        const auto perms = std::filesystem::status(dir->second.as<std::string>()).permissions();
+        EXPECT_EQ(perms & (std::filesystem::perms::group_all | std::filesystem::perms::others_all),
+                  std::filesystem::perms::none);
+#endif
+        std::filesystem::remove_all(dir->second.as<std::string>());
+    }
     for (size_t i = 0; i < actual.size(); ++i) {
         compare(expected[i], actual[i]);
     }
@@ -30,12 +30,17 @@ const ov::AnyMap cfg_u8_sym{
     {"KEY_CACHE_PRECISION", "u8"},
     {"VALUE_CACHE_PRECISION", "u8"},
 };
+// the KV cache of the idle request is moved to a file and read back on every iteration
+const ov::AnyMap cfg_offload{
+    {"CPU_KV_CACHE_OFFLOAD_DIR", "concat_sdp_kv_cache_offload"},
+    {"CPU_KV_CACHE_RESIDENT_REQUESTS", 1},
+};
 
 INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTest,
                          ConcatSDPTest,
                          ::testing::Combine(::testing::Values(ElementType::f32),
                                             ::testing::ValuesIn(inputShapes),
-                                            ::testing::Values(cfg_none, cfg_u8_sym),
+                                            ::testing::Values(cfg_none, cfg_u8_sym, cfg_offload),
                                             ::testing::Values(true, false),
                                             ::testing::Values<int64_t>(8),
                                             ::testing::Values<int64_t>(8)),
@@ -0,0 +1,163 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/activation.hpp"
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/max_pool.hpp"
+
+/*This test runs the following subgraph in the CPU_INTER_OP_PARALLEL mode:
+
+                      param
+                    /   |   \
+                   /    |    \
+              Conv1x1 Conv3x3 MaxPool
+                 |      |       |
+                Relu  Conv3x3 Conv1x1
+                  \     |      /  \
+                   \    |     /    \
+                     Concat       Add
+                       |           |
+                     Result      Result
+
+The branches are independent, so they are executed concurrently, while the memory of the intermediate tensors is
+reused between the branches by the memory solver.
+*/
+
+namespace ov {
+namespace test {
+
+class InterOpParallelTestBase : virtual public SubgraphBaseStaticTest {
+protected:
+    // Runs the model several times with new inputs and compares the outputs with the sequential execution: a race
+    // between the concurrently executed nodes does not necessarily show up in a single inference
+    void compare_with_sequential(size_t iterations) {
+        compile_model();
+        ASSERT_TRUE(compiledModel.get_property("CPU_INTER_OP_PARALLEL").as<bool>());
+        auto sequentialModel =
+            core->compile_model(function, targetDevice, ov::AnyMap{{"CPU_INTER_OP_PARALLEL", false}});
+        auto interOpRequest = compiledModel.create_infer_request();
+        auto sequentialRequest = sequentialModel.create_infer_request();
+
+        for (size_t iteration = 0; iteration < iterations; iteration++) {
+            for (const auto& param : function->get_parameters()) {
+                const auto tensor = ov::test::utils::create_and_fill_tensor(
+                    param->get_element_type(),
+                    param->get_shape(),
+                    ov::test::utils::InputGenerateData{-5, 10, 100, static_cast<int>(iteration)});
+                interOpRequest.set_tensor(param, tensor);
+                sequentialRequest.set_tensor(param, tensor);
+            }
+            interOpRequest.infer();
+            sequentialRequest.infer();
+            for (const auto& output : function->outputs()) {
+                ov::test::utils::compare(sequentialRequest.get_tensor(output), interOpRequest.get_tensor(output));
+            }
+        }
+    }
+};
+
+class InterOpParallelBranches : public InterOpParallelTestBase {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({"CPU_INTER_OP_PARALLEL", true});
+
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, ov::Shape{1, 16, 20, 20});
+
+        auto conv = [&](const ov::Output<ov::Node>& input, size_t kernel) {
+            const auto pad = static_cast<ptrdiff_t>(kernel / 2);
+            return ov::test::utils::make_convolution(input,
+                                                     precision,
+                                                     {kernel, kernel},
+                                                     {1, 1},
+                                                     {pad, pad},
+                                                     {pad, pad},
+                                                     {1, 1},
+                                                     ov::op::PadType::EXPLICIT,
+                                                     16);
+        };
+
+        auto branch1 =
+            ov::test::utils::make_activation(conv(param, 1), precision, ov::test::utils::ActivationTypes::Relu);
+        auto branch2 = conv(conv(param, 3), 3);
+        auto pool = std::make_shared<ov::op::v1::MaxPool>(param,
+                                                          ov::Strides{1, 1},
+                                                          ov::Shape{1, 1},
+                                                          ov::Shape{1, 1},
+                                                          ov::Shape{3, 3});
+        auto branch3 = conv(pool, 1);
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{branch1, branch2, branch3}, 1);
+        auto add = ov::test::utils::make_eltwise(branch3, param, ov::test::utils::EltwiseTypes::ADD);
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(concat),
+                                 std::make_shared<ov::op::v0::Result>(add)};
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "InterOpParallelBranches");
+    }
+};
+
+TEST_F(InterOpParallelBranches, smoke_CompareWithRefs) {
+    run();
+    ASSERT_TRUE(compiledModel.get_property("CPU_INTER_OP_PARALLEL").as<bool>());
+}
+
+TEST_F(InterOpParallelBranches, smoke_CompareWithSequential) {
+    compare_with_sequential(20);
+}
+
+/*The two branches are identical snippets, so the Subgraph nodes take the same executor from the runtime cache. The
+executor keeps per thread scratch buffers, so the branches must be ordered instead of being executed concurrently:
+
+          param0  param1    param2  param3
+              \    /            \    /
+              Multiply        Multiply
+                 |               |
+                Add             Add
+                 |               |
+               Sigmoid         Sigmoid
+                   \           /
+                      Concat
+                        |
+                      Result
+*/
+class InterOpParallelSharedSnippets : public InterOpParallelTestBase {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({"CPU_INTER_OP_PARALLEL", true});
+
+        const auto precision = ov::element::f32;
+        const ov::Shape shape{1, 32, 16, 16};
+        ov::ParameterVector params;
+        for (size_t i = 0; i < 4; i++) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+
+        auto branch = [&](const ov::Output<ov::Node>& lhs, const ov::Output<ov::Node>& rhs) {
+            auto multiply = ov::test::utils::make_eltwise(lhs, rhs, ov::test::utils::EltwiseTypes::MULTIPLY);
+            auto add = ov::test::utils::make_eltwise(multiply, lhs, ov::test::utils::EltwiseTypes::ADD);
+            return ov::test::utils::make_activation(add, precision, ov::test::utils::ActivationTypes::Sigmoid);
+        };
+
+        auto concat = std::make_shared<ov::op::v0::Concat>(
+            ov::OutputVector{branch(params[0], params[1]), branch(params[2], params[3])},
+            1);
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(concat)},
+                                               params,
+                                               "InterOpParallelSharedSnippets");
+    }
+};
+
+TEST_F(InterOpParallelSharedSnippets, smoke_CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 2);
+    compare_with_sequential(20);
+}
+
+}  // namespace test
+}  // namespace ov
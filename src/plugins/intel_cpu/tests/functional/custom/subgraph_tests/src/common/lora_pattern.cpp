@@ -2,16 +2,22 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include "common_test_utils/node_builders/constant.hpp"
 #include "common_test_utils/node_builders/convolution.hpp"
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/ov_tensor_utils.hpp"
+#include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/system_conf.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "utils/cpu_test_utils.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/gather.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/squeeze.hpp"
 #include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
 
 namespace ov {
 namespace test {
@@ -314,5 +320,109 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_Conv, LoraPatternConvolutionCPU
                                  ::testing::ValuesIn(states_policies)),
                          LoraPatternBaseCPUTest::getTestCaseName);
 
+class LoraMultiAdapterCPUTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        using ov::test::utils::InputGenerateData;
+
+        auto param_x = std::make_shared<ov::op::v0::Parameter>(netType, ov::PartialShape{-1, K});
+        auto param_indices = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+        auto weights = ov::test::utils::make_constant(netType, {N, K}, InputGenerateData(-1, 2, 1000, 1));
+        auto tx = std::make_shared<ov::op::v0::MatMul>(param_x, weights, false, true);
+
+        // adapters pools stored once, the matrices of each row are gathered by its adapter index
+        auto gather = [&](const ov::Shape& pool_shape, int seed) {
+            auto pool = ov::test::utils::make_constant(netType, pool_shape, InputGenerateData(-1, 2, 1000, seed));
+            auto axis = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{}, {0});
+            return std::make_shared<ov::op::v8::Gather>(pool, param_indices, axis);
+        };
+        auto axis_1 = ov::op::v0::Constant::create(ov::element::i32, ov::Shape{1}, {1});
+        auto unsqueeze = std::make_shared<ov::op::v0::Unsqueeze>(param_x, axis_1);
+        auto mm_a = std::make_shared<ov::op::v0::MatMul>(unsqueeze, gather({adapters, rank, K}, 2), false, true);
+        auto mul = std::make_shared<ov::op::v1::Multiply>(mm_a, gather({adapters, 1, rank}, 3));
+        auto mm_b = std::make_shared<ov::op::v0::MatMul>(mul, gather({adapters, N, rank}, 4), false, true);
+        auto squeeze = std::make_shared<ov::op::v0::Squeeze>(mm_b, axis_1);
+        auto tz = std::make_shared<ov::op::v1::Add>(tx, squeeze);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{tz}, ov::ParameterVector{param_x, param_indices});
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        SubgraphBaseTest::generate_inputs(targetInputStaticShapes);
+        // interleave the adapters, so the rows of an adapter are not contiguous
+        auto& indices = inputs.at(function->get_parameters()[1]);
+        auto* indices_data = indices.data<int32_t>();
+        for (size_t i = 0; i < indices.get_size(); ++i) {
+            indices_data[i] = static_cast<int32_t>((i * 7) % adapters);
+        }
+    }
+
+    static constexpr size_t K = 64ul;
+    static constexpr size_t N = 300ul;
+    static constexpr size_t rank = 8ul;
+    static constexpr size_t adapters = 5ul;
+};
+
+TEST_F(LoraMultiAdapterCPUTest, smoke_LoRA_CPU_MultiAdapter) {
+    init_input_shapes({{{-1, K}, {{1, K}, {37, K}, {3, K}}}, {{-1}, {{1}, {37}, {3}}}});
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Gather", 0);
+}
+
+// the negative indices of the gathers count the adapters from the end
+class LoraMultiAdapterNegativeIndicesCPUTest : public LoraMultiAdapterCPUTest {
+protected:
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        LoraMultiAdapterCPUTest::generate_inputs(targetInputStaticShapes);
+        auto& indices = inputs.at(function->get_parameters()[1]);
+        auto* indices_data = indices.data<int32_t>();
+        for (size_t i = 1; i < indices.get_size(); i += 2) {
+            indices_data[i] -= static_cast<int32_t>(adapters);
+        }
+    }
+};
+
+TEST_F(LoraMultiAdapterNegativeIndicesCPUTest, smoke_LoRA_CPU_MultiAdapter_NegativeIndices) {
+    init_input_shapes({{{-1, K}, {{1, K}, {37, K}, {3, K}}}, {{-1}, {{1}, {37}, {3}}}});
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+}
+
+// the LoRA node is followed by a MatMul, so it is not in the f32 tail of the graph
+class LoraMultiAdapterBF16CPUTest : public LoraMultiAdapterCPUTest {
+protected:
+    void SetUp() override {
+        LoraMultiAdapterCPUTest::SetUp();
+        using ov::test::utils::InputGenerateData;
+
+        const auto& result = function->get_results()[0];
+        auto weights = ov::test::utils::make_constant(netType, {K, N}, InputGenerateData(-1, 2, 1000, 5));
+        auto consumer = std::make_shared<ov::op::v0::MatMul>(result->input_value(0), weights, false, true);
+        result->input(0).replace_source_output(consumer);
+        function->validate_nodes_and_infer_types();
+
+        configuration.insert({ov::hint::inference_precision(ov::element::bf16)});
+        abs_threshold = 0.5f;
+        rel_threshold = 0.02f;
+    }
+};
+
+TEST_F(LoraMultiAdapterBF16CPUTest, smoke_LoRA_CPU_MultiAdapter_BF16) {
+    if (!ov::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+    init_input_shapes({{{-1, K}, {{1, K}, {37, K}, {3, K}}}, {{-1}, {{1}, {37}, {3}}}});
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "LoRA", 1);
+    // the low-rank updates are accumulated into the bf16 main flow, the LoRA inputs are not converted to f32
+    for (const auto& op : compiledModel.get_runtime_model()->get_ops()) {
+        if (op->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>() == "LoRA") {
+            EXPECT_EQ(op->get_rt_info().at(ov::exec_model_info::RUNTIME_PRECISION).as<ov::element::Type>(),
+                      ov::element::bf16);
+        }
+    }
+}
+
 }  // namespace test
 }  // namespace ov
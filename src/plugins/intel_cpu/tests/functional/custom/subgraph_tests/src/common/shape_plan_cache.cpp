@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/greater.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/non_zero.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/transpose.hpp"
+
+/*This test runs a dynamic model through alternating input shapes with the CPU_SHAPE_PLAN_CACHE_CAPACITY set:
+
+                 param
+               /       \
+         Multiply     Greater
+            |            |
+           Relu       NonZero   (data dependent output shape)
+            |            |
+        Transpose     Convert
+            |            |
+        ReduceSum    ReduceSum
+            |            |
+          Result       Result
+
+A repeated shape signature replays the recorded output dims of the shape agnostic nodes (Node::updateShapes with a
+NodeShapePlan), while the NonZero branch has different dims on every inference with new data and must infer them.
+The outputs are compared with the reference and with the same model compiled without the cache.
+*/
+
+namespace ov {
+namespace test {
+
+class ShapePlanCacheTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({"CPU_SHAPE_PLAN_CACHE_CAPACITY", 4});
+
+        // the signatures alternate, so the cached plans are hit
+        InputShape inputShape{{-1, -1, 8}, {{1, 4, 8}, {2, 7, 8}, {1, 4, 8}, {3, 5, 8}, {2, 7, 8}, {1, 4, 8}}};
+        init_input_shapes({inputShape});
+
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+
+        auto scale = ov::op::v0::Constant::create(precision, {}, {0.5f});
+        auto relu = std::make_shared<ov::op::v0::Relu>(std::make_shared<ov::op::v1::Multiply>(param, scale));
+        auto order = ov::op::v0::Constant::create(ov::element::i64, {3}, {0, 2, 1});
+        auto transpose = std::make_shared<ov::op::v1::Transpose>(relu, order);
+        auto sumAxis = ov::op::v0::Constant::create(ov::element::i64, {1}, {2});
+        auto sum = std::make_shared<ov::op::v1::ReduceSum>(transpose, sumAxis, true);
+
+        auto zero = ov::op::v0::Constant::create(precision, {}, {0.0f});
+        auto nonZero = std::make_shared<ov::op::v3::NonZero>(std::make_shared<ov::op::v1::Greater>(param, zero),
+                                                             ov::element::i32);
+        auto indices = std::make_shared<ov::op::v0::Convert>(nonZero, precision);
+        auto indicesAxis = ov::op::v0::Constant::create(ov::element::i64, {1}, {1});
+        auto indicesSum = std::make_shared<ov::op::v1::ReduceSum>(indices, indicesAxis, false);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{sum, indicesSum},
+                                               ov::ParameterVector{param},
+                                               "ShapePlanCache");
+    }
+
+    // Infers both models with the same new data for every shape and compares the outputs
+    void compare_with_disabled_cache() {
+        auto disabledModel =
+            core->compile_model(function, targetDevice, ov::AnyMap{{"CPU_SHAPE_PLAN_CACHE_CAPACITY", 0}});
+        auto cachedRequest = compiledModel.create_infer_request();
+        auto disabledRequest = disabledModel.create_infer_request();
+        const auto& param = function->get_parameters().front();
+
+        int seed = 0;
+        for (const auto& shapes : targetStaticShapes) {
+            const auto tensor = ov::test::utils::create_and_fill_tensor(
+                param->get_element_type(),
+                shapes.front(),
+                ov::test::utils::InputGenerateData{-5, 10, 1, ++seed});
+            cachedRequest.set_tensor(param, tensor);
+            disabledRequest.set_tensor(param, tensor);
+            cachedRequest.infer();
+            disabledRequest.infer();
+            for (const auto& output : function->outputs()) {
+                ov::test::utils::compare(disabledRequest.get_tensor(output), cachedRequest.get_tensor(output));
+            }
+        }
+    }
+};
+
+TEST_F(ShapePlanCacheTest, smoke_CompareWithRefs) {
+    run();
+    compare_with_disabled_cache();
+
+    const auto statistics =
+        compiledModel.get_property("CPU_SHAPE_PLAN_CACHE_STATISTICS").as<std::map<std::string, uint64_t>>();
+    ASSERT_GT(statistics.at("hits"), 0u);
+}
+
+}  // namespace test
+}  // namespace ov
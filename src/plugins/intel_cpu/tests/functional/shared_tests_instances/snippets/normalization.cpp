@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/normalization.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "openvino/runtime/system_conf.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+namespace {
+
+using NormalizationType = EltwiseNormalizationEltwiseFunction::NormalizationType;
+
+// the normalized (last) dimension must be static to be tokenized
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 4, 16}}},
+    {{}, {{2, 3, 37}}},
+    {{}, {{3, 8, 7}}},
+    {{}, {{1, 8, 1, 64}}},
+    {{-1, -1, 32}, {{1, 4, 32}, {2, 3, 32}, {1, 4, 32}}}
+};
+
+std::vector<ov::element::Type> precisions() {
+    std::vector<ov::element::Type> prc{ov::element::f32};
+    if (ov::with_cpu_x86_bfloat16())
+        prc.push_back(ov::element::bf16);
+    if (ov::with_cpu_x86_avx512_core_fp16())
+        prc.push_back(ov::element::f16);
+    return prc;
+}
+
+// Add, MVN and Multiply are fused into one Subgraph
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_EltwiseMVNEltwise, EltwiseNormalizationEltwise,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::Values(NormalizationType::MVN),
+                                 ::testing::Values(1e-5f),
+                                 ::testing::Values(ov::op::MVNEpsMode::INSIDE_SQRT, ov::op::MVNEpsMode::OUTSIDE_SQRT),
+                                 ::testing::ValuesIn(precisions()),
+                                 ::testing::Values(1),
+                                 ::testing::Values(1),
+                                 ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         EltwiseNormalizationEltwise::getTestCaseName);
+
+// the eps mode is not used by RMS
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_EltwiseRMSEltwise, EltwiseNormalizationEltwise,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::Values(NormalizationType::RMS),
+                                 ::testing::Values(1e-5f),
+                                 ::testing::Values(ov::op::MVNEpsMode::INSIDE_SQRT),
+                                 ::testing::ValuesIn(precisions()),
+                                 ::testing::Values(1),
+                                 ::testing::Values(1),
+                                 ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         EltwiseNormalizationEltwise::getTestCaseName);
+
+} // namespace
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -3,10 +3,12 @@
 //
 
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "cache/concurrent_lru_cache.h"
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
 #include "common_test_utils/test_assertions.hpp"
@@ -97,6 +99,87 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(ConcurrentLruCacheTests, Get) {
+    constexpr int capacity = 10;
+    ConcurrentLruCache<IntKey, int> cache(capacity, 1);
+    for (int i = 1; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits, static_cast<size_t>(capacity));
+    ASSERT_EQ(stats.misses, static_cast<size_t>(capacity - 1));
+    ASSERT_EQ(stats.evictions, static_cast<size_t>(capacity - 1));
+    ASSERT_EQ(stats.size, static_cast<size_t>(capacity));
+}
+
+TEST(ConcurrentLruCacheTests, LruPolicy) {
+    constexpr int capacity = 10;
+    ConcurrentLruCache<IntKey, int> cache(capacity, 1);
+    for (int i = 1; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = 21; i < 25; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < 4; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = 4; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+}
+
+TEST(ConcurrentLruCacheTests, Evict) {
+    constexpr int capacity = 64;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    OV_ASSERT_NO_THROW(cache.evict(capacity));
+    for (int i = 0; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    ASSERT_EQ(cache.getStatistics().size, 0U);
+
+    // the freed slots must be reused
+    for (int i = 0; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i + 1));
+    }
+    for (int i = 0; i < capacity; ++i) {
+        const int result = cache.get({i});
+        ASSERT_TRUE(result == int() || result == i + 1);
+    }
+}
+
+TEST(ConcurrentLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr int attempts = 10;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -197,6 +280,10 @@ struct StringKey {
 
     std::string data;
 };
+
+struct SharedIntKey : IntKey {
+    static constexpr bool shareable_between_streams = true;
+};
 } // namespace
 
 TEST(MultiCacheTests, GetOrCreate) {
@@ -380,3 +467,85 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SmokeConcurrentShared) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 100;
+    constexpr size_t numThreads = 16;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    MultiCache cache(capacity, true);
+
+    auto testRoutine = [&]() {
+        for (int j = 0; j < 10; ++j) {
+            for (int i = 0; i < capacity; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, numThreads * 10 * capacity);
+    ASSERT_GE(stats.misses, static_cast<size_t>(capacity));
+    ASSERT_LE(stats.size, static_cast<size_t>(capacity));
+}
+
+TEST(MultiCacheTests, StreamCacheSharesOnlyShareableKeys) {
+    constexpr int capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto sharedIntBuilder = [&](const SharedIntKey& key) { return std::make_shared<int>(key.data); };
+
+    auto shared = std::make_shared<MultiCache>(capacity, true);
+    MultiCache firstStream(capacity, shared);
+    MultiCache secondStream(capacity, shared);
+
+    auto first = firstStream.getOrCreate(SharedIntKey{{1}}, sharedIntBuilder);
+    ASSERT_EQ(first.second, CacheEntryBase::LookUpStatus::Miss);
+    auto second = secondStream.getOrCreate(SharedIntKey{{1}}, sharedIntBuilder);
+    ASSERT_EQ(second.second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(first.first, second.first);
+
+    // the objects with per call state are never handed to another stream
+    first = firstStream.getOrCreate(IntKey{1}, intBuilder);
+    ASSERT_EQ(first.second, CacheEntryBase::LookUpStatus::Miss);
+    second = secondStream.getOrCreate(IntKey{1}, intBuilder);
+    ASSERT_EQ(second.second, CacheEntryBase::LookUpStatus::Miss);
+    ASSERT_NE(first.first, second.first);
+    ASSERT_EQ(firstStream.getOrCreate(IntKey{1}, intBuilder).second, CacheEntryBase::LookUpStatus::Hit);
+
+    const auto stats = shared->getStatistics();
+    ASSERT_EQ(stats.hits, 1u);
+    ASSERT_EQ(stats.misses, 1u);
+}
+
+TEST(MultiCacheTests, ValueRecorderCollectsNotShareableValues) {
+    constexpr int capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto sharedIntBuilder = [&](const SharedIntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity, std::make_shared<MultiCache>(capacity, true));
+    const auto outside = cache.getOrCreate(IntKey{1}, intBuilder).first;
+
+    MultiCache::ValueRecorder recorder;
+    const auto created = cache.getOrCreate(IntKey{2}, intBuilder).first;
+    const auto found = cache.getOrCreate(IntKey{1}, intBuilder).first;
+    // immutable objects shared between streams do not order the nodes taking them
+    cache.getOrCreate(SharedIntKey{{3}}, sharedIntBuilder);
+
+    const std::vector<const void*> expected{created.get(), found.get()};
+    ASSERT_EQ(recorder.values(), expected);
+    ASSERT_EQ(found, outside);
+}
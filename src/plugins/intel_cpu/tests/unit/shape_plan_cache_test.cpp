@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "shape_plan_cache.h"
+
+using namespace ov::intel_cpu;
+
+TEST(ShapePlanCacheTest, NewPlanTakesReplayableFlags) {
+    ShapePlanCache cache(2, {true, false, true});
+    const auto& plan = cache.get(1);
+
+    ASSERT_EQ(plan.size(), 3U);
+    EXPECT_TRUE(plan[0].replayable);
+    EXPECT_FALSE(plan[1].replayable);
+    EXPECT_TRUE(plan[2].replayable);
+    EXPECT_TRUE(plan[0].inputDims.empty());
+    EXPECT_TRUE(plan[0].outputDims.empty());
+}
+
+TEST(ShapePlanCacheTest, RecordedPlanIsReturnedOnHit) {
+    ShapePlanCache cache(2, {true});
+    auto& recorded = cache.get(1);
+    recorded[0].inputDims = {{1, 16}};
+    recorded[0].outputDims = {{1, 32}};
+
+    const auto& replayed = cache.get(1);
+    EXPECT_EQ(&replayed, &recorded);
+    EXPECT_EQ(replayed[0].outputDims, (std::vector<VectorDims>{{1, 32}}));
+
+    const auto stats = cache.getStatistics();
+    EXPECT_EQ(stats.hits, 1U);
+    EXPECT_EQ(stats.misses, 1U);
+    EXPECT_EQ(stats.size, 1U);
+}
+
+TEST(ShapePlanCacheTest, LeastRecentlyUsedPlanIsEvicted) {
+    ShapePlanCache cache(2, {true});
+    cache.get(1)[0].inputDims = {{1}};
+    cache.get(2)[0].inputDims = {{2}};
+    // makes the plan 2 the least recently used one
+    cache.get(1);
+    cache.get(3);
+
+    EXPECT_EQ(cache.get(1)[0].inputDims, (std::vector<VectorDims>{{1}}));
+    EXPECT_TRUE(cache.get(2)[0].inputDims.empty());
+
+    const auto stats = cache.getStatistics();
+    EXPECT_EQ(stats.hits, 2U);
+    EXPECT_EQ(stats.misses, 4U);
+    EXPECT_EQ(stats.evictions, 2U);
+    EXPECT_EQ(stats.size, 2U);
+}
+
+TEST(ShapePlanCacheTest, ThrowsOnZeroCapacity) {
+    EXPECT_THROW(ShapePlanCache(0, {}), ov::Exception);
+}
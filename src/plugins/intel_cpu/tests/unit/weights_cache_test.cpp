@@ -0,0 +1,181 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/common_utils.hpp"
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "utils/sha256.hpp"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+class SharedWeightsStorageTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_dir = ov::test::utils::generateTestFilePrefix() + "_shared_weights";
+        m_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{16, 8});
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_dir);
+    }
+
+    // Simulates the repacking of the weights: counts the calls and fills the memory with a known pattern
+    std::function<MemoryPtr(void)> creator(int& calls) {
+        return [this, &calls]() {
+            ++calls;
+            auto memory = std::make_shared<Memory>(m_eng, m_desc);
+            auto* data = memory->getDataAs<float>();
+            std::iota(data, data + m_desc->getShape().getElementsCount(), 0.0F);
+            return memory;
+        };
+    }
+
+    static bool hasPattern(const MemoryPtr& memory) {
+        const auto* data = memory->getDataAs<const float>();
+        for (size_t i = 0; i < memory->getShape().getElementsCount(); i++) {
+            if (data[i] != static_cast<float>(i)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::string m_dir;
+    dnnl::engine m_eng{dnnl::engine::kind::cpu, 0};
+    MemoryDescPtr m_desc;
+};
+
+}  // namespace
+
+TEST_F(SharedWeightsStorageTest, SecondCacheMapsPublishedWeights) {
+    // Two caches over the same directory stand for two processes running the same model
+    WeightsSharing first(std::make_shared<SharedWeightsStorage>(m_dir, 0));
+    WeightsSharing second(std::make_shared<SharedWeightsStorage>(m_dir, 0));
+    auto persistentKey = []() {
+        return std::string("weights_0");
+    };
+
+    int firstCalls = 0;
+    auto firstMemory =
+        static_cast<MemoryPtr>(*first.findOrCreate("0x1000", creator(firstCalls), persistentKey, m_eng, m_desc));
+    EXPECT_EQ(firstCalls, 1);
+    ASSERT_TRUE(hasPattern(firstMemory));
+
+    // The process local key differs, but the persistent key matches: the weights are mapped, not repacked again
+    int secondCalls = 0;
+    auto secondMemory =
+        static_cast<MemoryPtr>(*second.findOrCreate("0x2000", creator(secondCalls), persistentKey, m_eng, m_desc));
+    EXPECT_EQ(secondCalls, 0);
+    ASSERT_TRUE(hasPattern(secondMemory));
+    EXPECT_TRUE(secondMemory->getMemoryBlock()->hasExtBuffer());
+}
+
+TEST_F(SharedWeightsStorageTest, DifferentSocketsDoNotShare) {
+    WeightsSharing socket0(std::make_shared<SharedWeightsStorage>(m_dir, 0));
+    WeightsSharing socket1(std::make_shared<SharedWeightsStorage>(m_dir, 1));
+    auto persistentKey = []() {
+        return std::string("weights_0");
+    };
+
+    int calls = 0;
+    auto memory0 = static_cast<MemoryPtr>(*socket0.findOrCreate("a", creator(calls), persistentKey, m_eng, m_desc));
+    auto memory1 = static_cast<MemoryPtr>(*socket1.findOrCreate("a", creator(calls), persistentKey, m_eng, m_desc));
+    EXPECT_EQ(calls, 2);
+    EXPECT_TRUE(hasPattern(memory0));
+    EXPECT_TRUE(hasPattern(memory1));
+}
+
+TEST_F(SharedWeightsStorageTest, MismatchedDescriptorIsRepacked) {
+    SharedWeightsStorage storage(m_dir, 0);
+    int calls = 0;
+    auto created = creator(calls)();
+    ASSERT_NE(storage.publish("weights_0", m_eng, *created), nullptr);
+
+    auto otherDesc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{4, 8});
+    EXPECT_EQ(storage.find("weights_0", m_eng, otherDesc), nullptr);
+    EXPECT_EQ(storage.find("weights_1", m_eng, m_desc), nullptr);
+    EXPECT_NE(storage.find("weights_0", m_eng, m_desc), nullptr);
+}
+
+#ifndef _WIN32
+TEST_F(SharedWeightsStorageTest, FilesAreOwnerOnly) {
+    SharedWeightsStorage storage(m_dir, 0);
+    int calls = 0;
+    ASSERT_NE(storage.publish("weights_0", m_eng, *creator(calls)()), nullptr);
+
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(m_dir)) {
+        files.push_back(entry.path());
+    }
+    ASSERT_EQ(files.size(), 1U);
+    const auto others = std::filesystem::perms::group_all | std::filesystem::perms::others_all;
+    EXPECT_EQ(std::filesystem::status(files[0]).permissions() & others, std::filesystem::perms::none);
+
+    // A file other users can write to may have been replaced by them: it is not trusted
+    std::filesystem::permissions(files[0], std::filesystem::perms::others_write, std::filesystem::perm_options::add);
+    EXPECT_EQ(storage.find("weights_0", m_eng, m_desc), nullptr);
+}
+
+TEST_F(SharedWeightsStorageTest, StaleTemporaryFilesAreRemoved) {
+    std::filesystem::create_directories(m_dir);
+    const auto stale = std::filesystem::path(m_dir) / "ov_cpu_weights_0_0.bin.1.tmp";
+    const auto recent = std::filesystem::path(m_dir) / "ov_cpu_weights_0_0.bin.2.tmp";
+    std::ofstream(stale).put('\0');
+    std::ofstream(recent).put('\0');
+    std::filesystem::last_write_time(stale, std::filesystem::file_time_type::clock::now() - std::chrono::hours(2));
+
+    SharedWeightsStorage storage(m_dir, 0);
+    EXPECT_FALSE(std::filesystem::exists(stale));
+    EXPECT_TRUE(std::filesystem::exists(recent));
+}
+#endif
+
+TEST(Sha256Test, KnownDigests) {
+    auto digest = [](const std::string& message) {
+        Sha256 sha;
+        sha.update(message.data(), message.size());
+        return Sha256::toHex(sha.finalize());
+    };
+    EXPECT_EQ(digest(""), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    EXPECT_EQ(digest("abc"), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    EXPECT_EQ(digest("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"),
+              "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+
+    // The digest does not depend on how the message is split into updates
+    const std::string million(1000000, 'a');
+    Sha256 sha;
+    for (size_t i = 0; i < million.size(); i += 777) {
+        sha.update(million.data() + i, std::min<size_t>(777, million.size() - i));
+    }
+    EXPECT_EQ(Sha256::toHex(sha.finalize()), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST_F(SharedWeightsStorageTest, NoStorageKeepsWeightsPrivate) {
+    WeightsSharing cache;
+    int calls = 0;
+    auto persistentKey = []() -> std::string {
+        ADD_FAILURE() << "The persistent key must not be computed without a storage";
+        return {};
+    };
+    auto memory = static_cast<MemoryPtr>(*cache.findOrCreate("a", creator(calls), persistentKey, m_eng, m_desc));
+    EXPECT_EQ(calls, 1);
+    EXPECT_FALSE(memory->getMemoryBlock()->hasExtBuffer());
+    EXPECT_TRUE(!std::filesystem::exists(m_dir) || std::filesystem::is_empty(m_dir));
+}
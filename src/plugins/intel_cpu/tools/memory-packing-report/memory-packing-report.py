@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2018-2026 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import argparse
+import csv
+import glob
+import os
+import subprocess
+import sys
+import tempfile
+
+RECORDS = ['MemoryManagerStatic', 'MemoryManagerNonOverlappingSets', 'MemoryManagerIO']
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Report achieved vs. optimal intermediate memory of the CPU plugin '
+                                                 'for a corpus of IR models')
+    parser.add_argument('--format', '-f', choices=['no', 'csv', 'md'], default='no', required=False, help="print data using format")
+    parser.add_argument('--infer', action='store_true', help="run one inference to size the dynamic memory blocks too")
+    parser.add_argument('--single', action='store_true', help=argparse.SUPPRESS)
+    parser.add_argument('models', type=str, nargs='+', help="IR .xml files or directories searched for them recursively")
+    return parser.parse_args()
+
+
+def collect_models(paths):
+    models = []
+    for path in paths:
+        if os.path.isdir(path):
+            models.extend(sorted(glob.glob(os.path.join(path, '**', '*.xml'), recursive=True)))
+        else:
+            models.append(path)
+    return models
+
+
+def compile_model(model_path, infer):
+    # runs in a child process: the memory statistics are dumped when the compiled model is destroyed
+    import numpy as np
+    import openvino as ov
+
+    core = ov.Core()
+    compiled = core.compile_model(model_path, 'CPU', {'NUM_STREAMS': 1})
+    if infer and all(model_input.get_partial_shape().is_static for model_input in compiled.inputs):
+        request = compiled.create_infer_request()
+        for model_input in compiled.inputs:
+            request.set_tensor(model_input, ov.Tensor(np.zeros(model_input.get_shape(),
+                                                               dtype=model_input.get_element_type().to_dtype())))
+        request.infer()
+    del compiled
+
+
+def parse_statistics(csv_path):
+    # only the first graph is taken into account, all of them share the same memory layout
+    stats = {}
+    graphs = 0
+    with open(csv_path, newline='') as csvfile:
+        for row in csv.reader(csvfile, delimiter=';'):
+            if row and row[0].startswith('Memory stats for graph name'):
+                graphs += 1
+            if graphs != 1 or not row or row[0] not in RECORDS:
+                continue
+            total, optimal = stats.get(row[0], (0, 0))
+            stats[row[0]] = (total + int(row[3]), optimal + int(row[4]))
+    return stats
+
+
+def measure(model_path, infer):
+    with tempfile.TemporaryDirectory() as dump_dir:
+        env = dict(os.environ, OV_CPU_MEMORY_STATISTICS_PATH=os.path.join(dump_dir, 'stats.csv'))
+        cmd = [sys.executable, os.path.abspath(__file__), '--single'] + (['--infer'] if infer else []) + [model_path]
+        subprocess.run(cmd, env=env, check=True)
+        dumps = glob.glob(os.path.join(dump_dir, '*.csv'))
+        if not dumps:
+            raise RuntimeError('No memory statistics were dumped. Is the CPU plugin built with -DENABLE_DEBUG_CAPS=ON?')
+        return parse_statistics(dumps[0])
+
+
+def print_table(rows, format):
+    header = ['Model', 'Record', 'Total size [bytes]', 'Optimal total size [bytes]', 'Overhead [%]']
+    if format == 'csv':
+        print(';'.join(header))
+        for row in rows:
+            print(';'.join(str(item) for item in row))
+    elif format == 'md':
+        print('| ' + ' | '.join(header) + ' |')
+        print('|' + '---|' * len(header))
+        for row in rows:
+            print('| ' + ' | '.join(str(item) for item in row) + ' |')
+    else:
+        widths = [max(len(str(item)) for item in column) for column in zip(header, *rows)]
+        for row in [header] + rows:
+            print('  '.join(str(item).rjust(width) for item, width in zip(row, widths)))
+
+
+def overhead(total, optimal):
+    return round((total - optimal) * 100.0 / optimal, 2) if optimal else 0.0
+
+
+if __name__ == "__main__":
+    args = parse_args()
+
+    if args.single:
+        compile_model(args.models[0], args.infer)
+        sys.exit(0)
+
+    rows = []
+    corpus_total = corpus_optimal = 0
+    for model_path in collect_models(args.models):
+        stats = measure(model_path, args.infer)
+        for record in RECORDS:
+            if record in stats:
+                total, optimal = stats[record]
+                rows.append([os.path.basename(model_path), record, total, optimal, overhead(total, optimal)])
+        # I/O blocks are not packed, so only the reusable intermediate memory counts towards the corpus score
+        for record in RECORDS[:2]:
+            total, optimal = stats.get(record, (0, 0))
+            corpus_total += total
+            corpus_optimal += optimal
+    rows.append(['Total', 'intermediate', corpus_total, corpus_optimal, overhead(corpus_total, corpus_optimal)])
+    print_table(rows, args.format)
@@ -17,6 +17,8 @@ class WeightlessWriter : public ov::util::ConstantWriter {
 public:
     explicit WeightlessWriter(ov::util::ConstantWriter& other) : ov::util::ConstantWriter(other) {}
 
+    void prepare(const std::vector<ConstantData>&) override {}
+
     FilePosition write(const char*, size_t, size_t&, bool, ov::element::Type, bool) override {
         return 0;
     }
@@ -41,6 +41,9 @@ protected:
     size_t num_streams;
     size_t num_requests;
     size_t num_batch;
+    // minimize timeout to reduce test time
+    uint32_t timeout_ms = 1;
+    ov::AnyMap batch_config;
     std::vector<std::shared_ptr<ov::Model>> fn_ptrs;
 
     void SetUp() override {
@@ -73,8 +76,8 @@ protected:
                 config.insert(ov::num_streams(static_cast<int32_t>(num_streams)));
                 config.insert(ov::hint::inference_precision(ov::element::f32));
             }
-            // minimize timeout to reduce test time
-            config.insert(ov::auto_batch_timeout(1));
+            config.insert(ov::auto_batch_timeout(timeout_ms));
+            config.insert(batch_config.begin(), batch_config.end());
 
             auto compiled_model = core->compile_model(model, std::string(ov::test::utils::DEVICE_BATCH) + ":" +
                                                       target_device + "(" + std::to_string(num_batch) + ")",
@@ -148,6 +151,22 @@ public:
     }
 };
 
+// The requests which are left when the timeout expires are copied into a smaller power-of-two batch and its outputs
+// are scattered back to them. The timeout is long enough for all the requests to arrive, so the remainder of the
+// requests modulo the batch size is always executed by the timeout path.
+class AutoBatching_Test_PartialBatches : public AutoBatching_Test {
+public:
+    void SetUp() override {
+        AutoBatching_Test::SetUp();
+        timeout_ms = 200;
+        batch_config = {{"AUTO_BATCH_PARTIAL_BATCHES", true}};
+    };
+
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchTwoNetsParams> &obj) {
+        return AutoBatching_Test::getTestCaseName(obj);
+    }
+};
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
     TestAutoBatch();
@@ -157,6 +176,11 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
     TestAutoBatch();
 }
+
+TEST_P(AutoBatching_Test_PartialBatches, compareAutoBatchingToSingleBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    TestAutoBatch();
+}
 }  // namespace behavior
 }  // namespace test
 }  // namespace ov
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shared_test_classes/base/snippets_test_utils.hpp"
+#include "subgraph_normalization.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+typedef std::tuple<
+        InputShape,                                              // Input 0 and 1 Shape
+        EltwiseNormalizationEltwiseFunction::NormalizationType,  // MVN or RMS
+        float,                                                   // epsilon
+        ov::op::MVNEpsMode,                                      // MVN epsilon mode
+        ov::element::Type,                                       // Element type
+        size_t,                                                  // Expected num nodes
+        size_t,                                                  // Expected num subgraphs
+        std::string                                              // Target Device
+> EltwiseNormalizationEltwiseParams;
+
+// The callback mode is not ignored: the normalization is tokenized only because its producer is a Subgraph
+class EltwiseNormalizationEltwise : public testing::WithParamInterface<EltwiseNormalizationEltwiseParams>,
+                                    virtual public SnippetsTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EltwiseNormalizationEltwiseParams>& obj);
+
+protected:
+    void SetUp() override;
+};
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/common_utils.hpp"
+#include "snippets/normalization.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::string EltwiseNormalizationEltwise::getTestCaseName(
+    const testing::TestParamInfo<ov::test::snippets::EltwiseNormalizationEltwiseParams>& obj) {
+    const auto& [inputShapes, normType, eps, epsMode, type, num_nodes, num_subgraphs, targetDevice] = obj.param;
+
+    std::ostringstream result;
+    result << "IS=" << ov::test::utils::partialShape2str({inputShapes.first}) << "_";
+    result << "TS=";
+    for (const auto& shape : inputShapes.second) {
+        result << "(" << ov::test::utils::vec2str(shape) << ")_";
+    }
+    result << "Norm=" << normType << "_";
+    result << "epsilon=" << eps << "_";
+    result << "epsMode=" << epsMode << "_";
+    result << "T=" << type << "_";
+    result << "#N=" << num_nodes << "_";
+    result << "#S=" << num_subgraphs << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void EltwiseNormalizationEltwise::SetUp() {
+    const auto& [inputShape, normType, eps, epsMode, type, _ref_num_nodes, _ref_num_subgraphs, _targetDevice] =
+        this->GetParam();
+    ref_num_nodes = _ref_num_nodes;
+    ref_num_subgraphs = _ref_num_subgraphs;
+    targetDevice = _targetDevice;
+
+    init_input_shapes({inputShape, inputShape});
+
+    auto f = ov::test::snippets::EltwiseNormalizationEltwiseFunction(inputDynamicShapes, normType, eps, epsMode, type);
+    function = f.getOriginal();
+    setInferenceType(type);
+
+    if (type == ov::element::bf16) {
+        abs_threshold = 5e-2;
+        rel_threshold = 2e-2;
+    } else if (type == ov::element::f16) {
+        abs_threshold = 2e-2;
+        rel_threshold = 1e-2;
+    } else {
+        abs_threshold = 1e-4;
+    }
+}
+
+TEST_P(EltwiseNormalizationEltwise, CompareWithRefImpl) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    validateNumSubgraphs();
+}
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
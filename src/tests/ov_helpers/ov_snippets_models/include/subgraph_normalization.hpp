@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/mvn.hpp"
+#include "snippets_helpers.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+/* Graph:
+ *       Parameter
+ *           |
+ *    MVN (over the last dimension)
+ *           |
+ *         Result
+ */
+class MVNFunction : public SnippetsFunctionBase {
+public:
+    explicit MVNFunction(const std::vector<PartialShape>& inputShapes, float eps)
+        : SnippetsFunctionBase(inputShapes), epsilon(eps) {
+        OPENVINO_ASSERT(input_shapes.size() == 1, "Got invalid number of input shapes");
+    }
+
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+    std::shared_ptr<ov::Model> initLowered() const override;
+
+private:
+    float epsilon;
+};
+
+/* Graph:
+ *       Parameter   Parameter (gamma)
+ *              \    /
+ *               RMS
+ *                |
+ *              Result
+ */
+class RMSFunction : public SnippetsFunctionBase {
+public:
+    explicit RMSFunction(const std::vector<PartialShape>& inputShapes, float eps)
+        : SnippetsFunctionBase(inputShapes), epsilon(eps) {
+        OPENVINO_ASSERT(input_shapes.size() == 2, "Got invalid number of input shapes");
+    }
+
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+    std::shared_ptr<ov::Model> initLowered() const override;
+
+private:
+    float epsilon;
+};
+
+/* Graph:
+ *     Parameter   Parameter
+ *           \     /   |
+ *             Add     |
+ *              |      |
+ *        MVN or RMS   |
+ *              |     /
+ *            Multiply
+ *              |
+ *            Result
+ * The normalization is done over the last dimension, the RMS gamma of shape [N] is broadcast.
+ */
+class EltwiseNormalizationEltwiseFunction : public SnippetsFunctionBase {
+public:
+    enum class NormalizationType { MVN, RMS };
+
+    explicit EltwiseNormalizationEltwiseFunction(const std::vector<PartialShape>& inputShapes,
+                                                 NormalizationType type,
+                                                 float eps,
+                                                 ov::op::MVNEpsMode epsMode,
+                                                 ov::element::Type_t precision)
+        : SnippetsFunctionBase(inputShapes, precision), normalization_type(type), epsilon(eps), eps_mode(epsMode) {
+        OPENVINO_ASSERT(input_shapes.size() == 2, "Got invalid number of input shapes");
+        OPENVINO_ASSERT(input_shapes[0].rank().is_static() && input_shapes[0][input_shapes[0].size() - 1].is_static(),
+                        "The normalized dimension must be static");
+    }
+
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+
+private:
+    NormalizationType normalization_type;
+    float epsilon;
+    ov::op::MVNEpsMode eps_mode;
+};
+
+std::ostream& operator<<(std::ostream& os, EltwiseNormalizationEltwiseFunction::NormalizationType type);
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
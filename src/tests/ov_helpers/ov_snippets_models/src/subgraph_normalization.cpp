@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_normalization.hpp"
+#include "common_test_utils/data_utils.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "openvino/op/mvn.hpp"
+#include "ov_ops/rms.hpp"
+#include "snippets/op/result.hpp"
+#include <snippets/op/reduce.hpp>
+#include <snippets/op/powerstatic.hpp>
+#include <snippets/op/scalar.hpp>
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::shared_ptr<ov::Model> MVNFunction::initOriginal() const {
+    auto data = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    const auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {-1});
+    const auto mvn = std::make_shared<ov::op::v6::MVN>(data, axes, true, epsilon, ov::op::MVNEpsMode::INSIDE_SQRT);
+    return std::make_shared<ov::Model>(OutputVector{mvn}, ParameterVector{data});
+}
+
+std::shared_ptr<ov::Model> MVNFunction::initLowered() const {
+    auto data = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    const auto axis = input_shapes[0].size() - 1;
+    const float size_inv = 1.0f / static_cast<float>(input_shapes[0][axis].get_length());
+
+    const auto reduce_sum = std::make_shared<ov::snippets::op::ReduceSum>(data, axis);
+    const auto size_inv_node = std::make_shared<ov::snippets::op::Scalar>(element::f32, Shape{1}, size_inv);
+    const auto mean = std::make_shared<ov::op::v1::Multiply>(reduce_sum, size_inv_node);
+    const auto sub_mean = std::make_shared<ov::op::v1::Subtract>(data, mean);
+    const auto sqr = std::make_shared<ov::snippets::op::PowerStatic>(sub_mean, 2.0f);
+    const auto sqr_reduce_sum = std::make_shared<ov::snippets::op::ReduceSum>(sqr, axis);
+    const auto size_inv_node_aux = std::make_shared<ov::snippets::op::Scalar>(element::f32, Shape{1}, size_inv);
+    const auto variance = std::make_shared<ov::op::v1::Multiply>(sqr_reduce_sum, size_inv_node_aux);
+    const auto eps_node = std::make_shared<ov::snippets::op::Scalar>(element::f32, Shape{1}, epsilon);
+    const auto eps_add = std::make_shared<ov::op::v1::Add>(variance, eps_node);
+    const auto stddev = std::make_shared<ov::op::v0::Sqrt>(eps_add);
+    const auto stddev_inv = std::make_shared<ov::snippets::op::PowerStatic>(stddev, -1.f);
+    const auto mvn = std::make_shared<ov::op::v1::Multiply>(sub_mean, stddev_inv);
+    const auto snippets_result = std::make_shared<ov::snippets::op::Result>(mvn);
+
+    return std::make_shared<ov::Model>(OutputVector{snippets_result}, ParameterVector{data});
+}
+
+std::shared_ptr<ov::Model> RMSFunction::initOriginal() const {
+    auto data = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto gamma = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    const auto rms = std::make_shared<ov::op::internal::RMS>(data, gamma, epsilon);
+    return std::make_shared<ov::Model>(OutputVector{rms}, ParameterVector{data, gamma});
+}
+
+std::shared_ptr<ov::Model> RMSFunction::initLowered() const {
+    auto data = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto gamma = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    const auto axis = input_shapes[0].size() - 1;
+    const float size_inv = 1.0f / static_cast<float>(input_shapes[0][axis].get_length());
+
+    const auto sqr = std::make_shared<ov::snippets::op::PowerStatic>(data, 2.0f);
+    const auto sqr_reduce_sum = std::make_shared<ov::snippets::op::ReduceSum>(sqr, axis);
+    const auto size_inv_node = std::make_shared<ov::snippets::op::Scalar>(element::f32, Shape{1}, size_inv);
+    const auto sqr_mean = std::make_shared<ov::op::v1::Multiply>(sqr_reduce_sum, size_inv_node);
+    const auto eps_node = std::make_shared<ov::snippets::op::Scalar>(element::f32, Shape{1}, epsilon);
+    const auto eps_add = std::make_shared<ov::op::v1::Add>(sqr_mean, eps_node);
+    const auto rms_value = std::make_shared<ov::op::v0::Sqrt>(eps_add);
+    const auto rms_inv = std::make_shared<ov::snippets::op::PowerStatic>(rms_value, -1.f);
+    const auto normalized = std::make_shared<ov::op::v1::Multiply>(data, rms_inv);
+    const auto scaled = std::make_shared<ov::op::v1::Multiply>(normalized, gamma);
+    const auto snippets_result = std::make_shared<ov::snippets::op::Result>(scaled);
+
+    return std::make_shared<ov::Model>(OutputVector{snippets_result}, ParameterVector{data, gamma});
+}
+
+std::shared_ptr<ov::Model> EltwiseNormalizationEltwiseFunction::initOriginal() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    const auto add = std::make_shared<ov::op::v1::Add>(data0, data1);
+
+    std::shared_ptr<ov::Node> normalization;
+    if (normalization_type == NormalizationType::MVN) {
+        const auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {-1});
+        normalization = std::make_shared<ov::op::v6::MVN>(add, axes, true, epsilon, eps_mode);
+    } else {
+        const auto& shape = input_shapes[0];
+        const auto gamma_shape = ov::Shape{static_cast<size_t>(shape[shape.size() - 1].get_length())};
+        const auto gamma_values = ov::test::utils::generate_float_numbers(ov::shape_size(gamma_shape), -2.f, 2.f);
+        const auto gamma = ov::op::v0::Constant::create(precision, gamma_shape, gamma_values);
+        normalization = std::make_shared<ov::op::internal::RMS>(add, gamma, epsilon);
+    }
+
+    const auto multiply = std::make_shared<ov::op::v1::Multiply>(normalization, data1);
+    return std::make_shared<ov::Model>(OutputVector{multiply}, ParameterVector{data0, data1});
+}
+
+std::ostream& operator<<(std::ostream& os, EltwiseNormalizationEltwiseFunction::NormalizationType type) {
+    return os << (type == EltwiseNormalizationEltwiseFunction::NormalizationType::MVN ? "MVN" : "RMS");
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
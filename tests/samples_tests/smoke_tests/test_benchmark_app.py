@@ -456,3 +456,87 @@ def test_benchmark_app_no_warmup_with_api_modes(sample_language, device, api, ca
     assert 'FPS' in output
     assert 'Skipping warmup inference due to -no_warmup flag' in output
     assert 'First inference took' not in output
+
+
+@pytest.mark.parametrize('device', get_devices())
+@pytest.mark.parametrize('arrivals', ['rate', 'trace'])
+def test_open_loop_latency_histogram(device, arrivals, tmp_path):
+    """Test open-loop arrivals with the latency histogram dump (C++ only)"""
+    param = opset.parameter([1, 3, 32, 32], ov.Type.f32, name='input')
+    result = opset.result(opset.relu(param), name='output')
+    model_path = tmp_path / 'relu.xml'
+    ov.save_model(ov.Model([result], [param], 'relu'), model_path)
+
+    if arrivals == 'rate':
+        arrival_args = ('-arrival_rate', '200', '-t', '1')
+    else:
+        trace_path = tmp_path / 'arrivals.txt'
+        trace_path.write_text('\n'.join(str(i * 2.5) for i in range(20)))
+        arrival_args = ('-arrival_trace', trace_path, '-t', '10')
+
+    histogram_path = tmp_path / 'latency_histogram.json'
+    output = get_cmd_output(
+        get_executable('C++'),
+        '-m', model_path,
+        '-d', device,
+        '-api', 'async',
+        *arrival_args,
+        '-latency_histogram', histogram_path,
+    )
+    assert 'FPS' in output
+    assert 'Response latency (from arrival, corrected for coordinated omission)' in output
+
+    with histogram_path.open(encoding='utf-8') as file:
+        histograms = json.load(file)
+    assert histograms['load'] == ('poisson' if arrivals == 'rate' else 'trace')
+    response_time = histograms['response_time']
+    assert response_time['count'] > 0
+    if arrivals == 'trace':
+        assert response_time['count'] == 20
+    assert response_time['p50'] <= response_time['p90'] <= response_time['p99'] <= response_time['p99.9']
+    assert sum(count for _, count in response_time['buckets']) == response_time['count']
+
+
+@pytest.mark.parametrize('device', get_devices())
+def test_llm_generation(device, tmp_path):
+    """Test the generation loop of a stateful LLM (C++ only)"""
+    input_ids = opset.parameter([-1, -1], ov.Type.i64, name='input_ids')
+    attention_mask = opset.parameter([-1, -1], ov.Type.i64, name='attention_mask')
+    position_ids = opset.parameter([-1, -1], ov.Type.i64, name='position_ids')
+    beam_idx = opset.parameter([-1], ov.Type.i32, name='beam_idx')
+    # the cache of the past tokens is kept in the model state, attention_mask must cover it
+    tokens = opset.unsqueeze(opset.convert(opset.add(input_ids, position_ids), ov.Type.f32), 2)
+    batch = opset.gather(opset.shape_of(input_ids), [0], 0)
+    empty_cache = opset.broadcast(np.float32(0), opset.concat([batch, opset.constant([0, 1], ov.Type.i64)], 0))
+    past = opset.gather(opset.read_value(empty_cache, 'past', ov.Type.f32, ov.PartialShape([-1, -1, 1])), beam_idx, 0)
+    present = opset.concat([past, tokens], 1)
+    cache = opset.assign(present, 'past')
+    mask = opset.unsqueeze(opset.convert(attention_mask, ov.Type.f32), 2)
+    logits = opset.reduce_sum(opset.multiply(present, mask), [1], True)
+    model = ov.Model([opset.result(logits, name='logits')], [cache],
+                     [input_ids, attention_mask, position_ids, beam_idx], 'tiny_llm')
+    model_path = tmp_path / 'tiny_llm.xml'
+    ov.save_model(model, model_path)
+
+    histogram_path = tmp_path / 'llm_histogram.json'
+    output = get_cmd_output(
+        get_executable('C++'),
+        '-m', model_path,
+        '-d', device,
+        '-llm_prompt', '8',
+        '-llm_new_tokens', '4',
+        '-nireq', '2',
+        '-niter', '4',
+        '-latency_histogram', histogram_path,
+    )
+    assert 'Time to first token' in output
+    assert 'tokens/s' in output
+
+    with histogram_path.open(encoding='utf-8') as file:
+        histograms = json.load(file)
+    assert histograms['load'] == 'llm'
+    assert histograms['sequences'] == 4
+    assert histograms['generated_tokens'] == 16
+    assert histograms['ttft']['count'] == 4
+    assert histograms['tpot']['count'] == 4
+    assert histograms['inter_token_latency']['count'] == 12